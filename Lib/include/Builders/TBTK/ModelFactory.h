@@ -25,12 +25,15 @@
 
 #include "TBTK/Geometry.h"
 #include "TBTK/Model.h"
+#include "TBTK/NeighborIndex.h"
 #include "TBTK/StateSet.h"
 #include "TBTK/StateTreeNode.h"
 #include "TBTK/UnitCell.h"
 
 #include <complex>
+#include <functional>
 #include <initializer_list>
+#include <vector>
 
 namespace TBTK{
 
@@ -69,13 +72,30 @@ public:
 		std::complex<double> t
 	);
 
-	/** Create a model from a StateSet. */
+	/** Create a model from a StateSet. A StateTreeNode is created
+	 *  internally to enumerate the pairs of states with overlapping
+	 *  extents, which are the only pairs for which matrix elements are
+	 *  calculated.
+	 *
+	 *  @param stateSet StateSet containing the states of the Model.
+	 *  @param o Operator to calculate matrix elements for.
+	 *
+	 *  @return Pointer to the created Model. */
 	static Model* createModel(
 		const StateSet &stateSet,
 		const AbstractOperator &o = DefaultOperator()
 	);
 
-	/** Create a model from a StateTreeNode. */
+	/** Create a model from a StateTreeNode. The matrix elements are
+	 *  calculated in parallel, which requires
+	 *  AbstractState::getMatrixElement() to be thread safe.
+	 *
+	 *  @param stateSet StateSet containing the states of the Model.
+	 *  @param stateTreeNode StateTreeNode containing the states of the
+	 *  StateSet, used to find the overlapping states.
+	 *  @param o Operator to calculate matrix elements for.
+	 *
+	 *  @return Pointer to the created Model. */
 	static Model* createModel(
 		const StateSet &stateSet,
 		const StateTreeNode &stateTreeNode,
@@ -117,6 +137,48 @@ public:
 		std::initializer_list<int> size
 	);
 
+	/** Add HoppingAmplitudes between all pairs of sites that are within
+	 *  a cutoff distance from each other. The pairs are found using a
+	 *  NeighborIndex built from the Geometry of the Model, and the
+	 *  amplitudeFunction is called once for every ordered pair (toIndex,
+	 *  fromIndex) and every periodic image within the cutoff. A
+	 *  HoppingAmplitude is added for every nonzero amplitude. Since both
+	 *  orderings of every pair are visited, the amplitudeFunction is
+	 *  responsible for returning Hermitian amplitudes. The pairs are
+	 *  processed in parallel and the amplitudeFunction therefore has to be
+	 *  thread safe. The HoppingAmplitudes are added to the Model in a
+	 *  deterministic order.
+	 *
+	 *  Note that the HoppingAmplitudes are added to a Model that already
+	 *  has been constructed. Every HoppingAmplitude is between Indices that
+	 *  already are in the Model and the basis is therefore unchanged, but
+	 *  the Model is modified after construction. Neither
+	 *  Model::sortHoppingAmplitudes() nor Model::constructCOO() can
+	 *  therefore have been called before this function, and Solvers and
+	 *  PropertyExtractors have to be set up after the HoppingAmplitudes
+	 *  have been added.
+	 *
+	 *  @param model The Model to add the HoppingAmplitudes to. The Model
+	 *  must have been constructed and have a Geometry.
+	 *  @param cutoff The cutoff distance.
+	 *  @param amplitudeFunction Function returning the amplitude for a
+	 *  hopping from fromIndex to toIndex, where displacement is the
+	 *  displacement from fromIndex to (the periodic image of) toIndex.
+	 *  @param periodicVectors Vectors under which the system is periodic.
+	 */
+	static void addHoppingAmplitudesWithinCutoff(
+		Model *model,
+		double cutoff,
+		const std::function<
+			std::complex<double>(
+				const Index &toIndex,
+				const Index &fromIndex,
+				const Vector3d &displacement
+			)
+		> &amplitudeFunction,
+		const std::vector<Vector3d> &periodicVectors = {}
+	);
+
 	/** Merge models. */
 	static Model* merge(
 		std::initializer_list<Model*> models
@@ -24,10 +24,11 @@
 #ifndef COM_DAFER45_TBTK_RECIPROCAL_LATTICE
 #define COM_DAFER45_TBTK_RECIPROCAL_LATTICE
 
+#include "TBTK/LinearStateTree.h"
 #include "TBTK/Model.h"
-#include "TBTK/StateTreeNode.h"
 #include "TBTK/UnitCell.h"
 
+#include <complex>
 #include <initializer_list>
 #include <vector>
 
@@ -84,6 +85,19 @@ public:
 		const std::vector<Index> &blockIndices
 	) const;
 
+	/** Calculate the momentum space amplitudes a_{k,to,from} for all
+	 *  pairs of states in the UnitCell without creating a Model. The
+	 *  amplitude for the pair p = from*getNumBands() + to and momentum m
+	 *  is stored at position p*momentums.size() + m. Here from and to are
+	 *  the positions of the states in the UnitCell.
+	 *
+	 *  @param momentums The momentums to calculate the amplitudes for.
+	 *
+	 *  @return The momentum space amplitudes. */
+	std::vector<std::complex<double>> calculateAmplitudes(
+		const std::vector<std::vector<double>> &momentums
+	) const;
+
 	/** Get reciprocal lattice vectors. */
 	const std::vector<std::vector<double>>& getReciprocalLatticeVectors() const;
 
@@ -99,8 +113,9 @@ private:
 	 *  elements before they are Fourier transformed to k-space. */
 	StateSet *realSpaceEnvironment;
 
-	/** StateTreeNode for quick access of states in realSpaceEnvironment. */
-	StateTreeNode *realSpaceEnvironmentStateTree;
+	/** LinearStateTree for quick access of states in
+	 *  realSpaceEnvironment. */
+	LinearStateTree *realSpaceEnvironmentStateTree;
 
 	/** StateSet containing the subset of states of realSpaceEnvironment
 	 *  that belongs to the reference unit cell. That is, the cell at the
@@ -111,6 +126,25 @@ private:
 	/** Reciprocal lattice vectors. */
 	std::vector<std::vector<double>> reciprocalLatticeVectors;
 
+	/** Real space hopping table. The real space matrix elements between
+	 *  the states in the reference cell and the states in the
+	 *  environment only has to be calculated once. They are therefore
+	 *  stored in a compact table from which the momentum space amplitudes
+	 *  are obtained as sum_R t_R*exp(ik*R). The entries for the orbital
+	 *  pair p = from*numBands + to are stored in the range
+	 *  [hoppingTableOffsets[p], hoppingTableOffsets[p+1]). */
+	std::vector<unsigned int> hoppingTableOffsets;
+
+	/** Lattice displacements R for the entries in the hopping table,
+	 *  stored with hoppingTableDimension components per entry. */
+	std::vector<double> hoppingTableDisplacements;
+
+	/** Matrix elements t_R for the entries in the hopping table. */
+	std::vector<std::complex<double>> hoppingTableAmplitudes;
+
+	/** Number of components of the displacements in the hopping table. */
+	unsigned int hoppingTableDimension;
+
 	/** Constant used to provide a margin that protects from roundoff
 	 *  errors. */
 	static constexpr double ROUNDOFF_MARGIN_MULTIPLIER = 1.01;
@@ -120,6 +154,9 @@ private:
 
 	/** Setup real space environment. */
 	void setupRealSpaceEnvironment(const UnitCell *unitCell);
+
+	/** Setup real space hopping table. */
+	void setupHoppingTable();
 };
 
 inline const std::vector<std::vector<double>>& ReciprocalLattice::getReciprocalLatticeVectors() const{
@@ -173,6 +173,9 @@ private:
 	/** Index to jump to (create). */
 	Index toIndex;
 
+	/** HoppingAmplitudeTree packs the HoppingAmplitudes into arrays when
+	 *  serializing in Serializable::Mode::Binary. */
+	friend class HoppingAmplitudeTree;
 };
 
 inline std::complex<double> HoppingAmplitude::getAmplitude() const{
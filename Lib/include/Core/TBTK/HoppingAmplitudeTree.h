@@ -28,6 +28,7 @@
 #include "TBTK/IndexTree.h"
 #include "TBTK/Serializable.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace TBTK{
@@ -478,6 +479,40 @@ private:
 	/** Returns (depth) first HoppingAmplitude as an example, in case of
 	 *  error while adding HoppingAmplitudes to the tree. */
 	HoppingAmplitude getFirstHA() const;
+
+	/** Flat arrays used to store the tree in Serializable::Mode::Binary.
+	 *  The nodes are stored in depth first order, and the
+	 *  HoppingAmplitudes are stored with their Indices packed into
+	 *  integer arrays rather than as one serialization string per
+	 *  HoppingAmplitude. */
+	class BinaryArrays{
+	public:
+		std::vector<int32_t> basisIndices;
+		std::vector<int32_t> basisSizes;
+		std::vector<bool> isPotentialBlockSeparators;
+		std::vector<uint32_t> numChildren;
+		std::vector<uint32_t> numHoppingAmplitudes;
+		std::vector<std::complex<double>> amplitudes;
+		std::vector<uint32_t> toIndexSizes;
+		std::vector<int32_t> toIndices;
+		std::vector<uint32_t> fromIndexSizes;
+		std::vector<int32_t> fromIndices;
+
+		/** Read positions used during deserialization. */
+		unsigned int nodePosition;
+		unsigned int hoppingAmplitudePosition;
+		unsigned int toIndexPosition;
+		unsigned int fromIndexPosition;
+	};
+
+	/** Append the node and its children to the BinaryArrays. Is called by
+	 *  HoppingAmplitudeTree::serialize() and is called recursively. */
+	void serializeBinary(BinaryArrays &binaryArrays) const;
+
+	/** Reconstruct the node and its children from the BinaryArrays. Is
+	 *  called by the serialization constructor and is called
+	 *  recursively. */
+	void deserializeBinary(BinaryArrays &binaryArrays);
 };
 
 inline int HoppingAmplitudeTree::getBasisSize() const{
@@ -0,0 +1,167 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file NeighborIndex.h
+ *  @brief Spatial index for finding all sites within a cutoff distance.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_NEIGHBOR_INDEX
+#define COM_DAFER45_TBTK_NEIGHBOR_INDEX
+
+#include "TBTK/Geometry.h"
+#include "TBTK/Index.h"
+#include "TBTK/Vector3d.h"
+
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Spatial index for finding all sites within a cutoff distance.
+ *
+ *  The NeighborIndex sorts the coordinates of a Geometry into a cell list
+ *  with cells that are at least as large as the cutoff. The neighbors of a
+ *  site are therefore found by only looking at the sites in the
+ *  surrounding cells, which makes it possible to find all pairs within the
+ *  cutoff in O(N) rather than O(N^2) time.
+ *
+ *  Periodic boundary conditions are supported by specifying the vectors
+ *  under which the system is periodic. The neighbors then also include
+ *  the periodic images of the sites that are within the cutoff, together
+ *  with the displacement to the image. The Geometry is referenced rather
+ *  than copied and has to remain unchanged for the lifetime of the
+ *  NeighborIndex. The NeighborIndex can be queried concurrently from
+ *  several threads. */
+class NeighborIndex{
+public:
+	/** Neighbor of a site. */
+	class Neighbor{
+	public:
+		/** Hilbert space index of the neighbor. */
+		unsigned int basisIndex;
+
+		/** Displacement from the site to the neighbor (or its
+		 *  periodic image). */
+		Vector3d displacement;
+
+		/** Distance to the neighbor. */
+		double distance;
+	};
+
+	/** Constructor.
+	 *
+	 *  @param geometry The Geometry to build the index for. Must have
+	 *  one, two, or three dimensions.
+	 *  @param cutoff The cutoff distance.
+	 *  @param periodicVectors Vectors under which the system is periodic.
+	 *  Components beyond the dimension of the Geometry are ignored. */
+	NeighborIndex(
+		const Geometry &geometry,
+		double cutoff,
+		const std::vector<Vector3d> &periodicVectors = {}
+	);
+
+	/** Get the cutoff distance.
+	 *
+	 *  @return The cutoff distance. */
+	double getCutoff() const;
+
+	/** Get the number of sites.
+	 *
+	 *  @return The number of sites. */
+	unsigned int getNumSites() const;
+
+	/** Get all sites (and periodic images) within the cutoff distance
+	 *  from a given site. The site itself is not included, but its
+	 *  periodic images are.
+	 *
+	 *  @param basisIndex The Hilbert space index of the site.
+	 *
+	 *  @return The neighbors of the site. */
+	std::vector<Neighbor> getNeighbors(unsigned int basisIndex) const;
+
+	/** Get all sites (and periodic images) within the cutoff distance
+	 *  from a given site.
+	 *
+	 *  @param index The physical Index of the site.
+	 *
+	 *  @return The neighbors of the site. */
+	std::vector<Neighbor> getNeighbors(const Index &index) const;
+private:
+	/** The Geometry. */
+	const Geometry *geometry;
+
+	/** Number of dimensions. */
+	unsigned int dimensions;
+
+	/** Number of sites. */
+	unsigned int numSites;
+
+	/** Cutoff distance. */
+	double cutoff;
+
+	/** Size of the cells. */
+	double cellSize;
+
+	/** Lower corner of the bounding box of the coordinates. */
+	double lower[3];
+
+	/** Number of cells in each direction. */
+	unsigned int numCells[3];
+
+	/** Sites ordered by cell. */
+	std::vector<unsigned int> cellSites;
+
+	/** Position in cellSites of the first site in each cell, with an
+	 *  extra element at the end that is equal to the number of sites. */
+	std::vector<unsigned int> cellStart;
+
+	/** Translations to the periodic images that can contain sites within
+	 *  the cutoff. The first translation is always zero. */
+	std::vector<Vector3d> translations;
+
+	/** Calculate the translations to the periodic images that need to be
+	 *  searched. */
+	void setupTranslations(
+		const std::vector<Vector3d> &periodicVectors,
+		const double *upper
+	);
+
+	/** Get the cell coordinate along a given dimension. */
+	int getCellCoordinate(double coordinate, unsigned int dimension) const;
+};
+
+inline double NeighborIndex::getCutoff() const{
+	return cutoff;
+}
+
+inline unsigned int NeighborIndex::getNumSites() const{
+	return numSites;
+}
+
+inline std::vector<NeighborIndex::Neighbor> NeighborIndex::getNeighbors(
+	const Index &index
+) const{
+	return getNeighbors(
+		(geometry->getCoordinates(index) - geometry->getCoordinates())
+			/dimensions
+	);
+}
+
+};	//End of namespace TBTK
+
+#endif
@@ -25,7 +25,9 @@
 
 #include "TBTK/Serializable.h"
 
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace TBTK{
@@ -75,10 +77,48 @@ public:
 	/** Get output path. */
 	const std::string& getPath() const;
 
+	/** Set a journal file through which reservations and completions are
+	 *  shared between processes. Every call to
+	 *  DataManager::reserveDataPoint() and DataManager::markCompleted()
+	 *  locks the journal, reads entries appended by other processes, and
+	 *  appends its own entry. Several processes running the same sweep
+	 *  can therefore reserve data points concurrently, and a restarted
+	 *  sweep continues where the previous one stopped. Reservations made
+	 *  by processes on the same host that no longer are running are
+	 *  released automatically.
+	 *
+	 *  @param journalFilename The journal file. Created if it does not
+	 *  exist.
+	 *
+	 *  @param reservationTimeout Time in seconds after which a
+	 *  reservation that has not been completed is released. Use
+	 *  DataManager::renewReservation() to keep long running
+	 *  reservations. A value of zero disables the timeout. */
+	void setJournal(
+		const std::string &journalFilename,
+		double reservationTimeout = 0
+	);
+
+	/** Get the journal file.
+	 *
+	 *  @return The journal file, or an empty string if no journal is
+	 *  used. */
+	const std::string& getJournal() const;
+
+	/** Enum class for specifying the file type of a data type. Results
+	 *  of the type SerializableJSON are stored in one file per data
+	 *  point. Results of the types SerializableBinary and
+	 *  SerializableHDF5 are serialized using Serializable::Mode::Binary
+	 *  and collected in a single file per data type and DataManager,
+	 *  respectively. They are buffered in memory and written in batches,
+	 *  see DataManager::setBatchSize(). SerializableHDF5 requires TBTK to
+	 *  be built with HDF5. */
 	enum class FileType {
 		Custom,
 		SerializableJSON,
-		PNG
+		PNG,
+		SerializableBinary,
+		SerializableHDF5
 	};
 
 	/** Add a data type to manage. */
@@ -99,6 +139,10 @@ public:
 	/** Reserve a data point. */
 	int reserveDataPoint(const std::string &dataTypes = "");
 
+	/** Renew a reservation to prevent it from timing out. [Only
+	 *  meaningful when a journal with a reservation timeout is used.] */
+	void renewReservation(const std::string &dataType, int id);
+
 	/** Get parameter for a given ID. */
 	std::vector<double> getParameters(int id) const;
 
@@ -109,7 +153,9 @@ public:
 	std::vector<unsigned int> getDataPoint(unsigned int id) const;
 
 	/** Get a (for this DataManager) unique filename that can be used to
-	 *  store and retreive a result. */
+	 *  store and retreive a result. For FileType::SerializableBinary and
+	 *  FileType::SerializableHDF5 the file is shared by all data points.
+	 */
 	std::string getFilename(const std::string &dataType, int id) const;
 
 	/** Mark data point completed. */
@@ -118,13 +164,61 @@ public:
 		int id
 	);
 
-	/** Complete save a Serializable result and mark it as completed. */
+	/** Complete save a Serializable result and mark it as completed. For
+	 *  FileType::SerializableBinary and FileType::SerializableHDF5 the
+	 *  result is buffered and only marked completed once it has been
+	 *  written to file. DataManager::close() must be called once every
+	 *  result has been completed to write the last batch. */
 	void complete(
 		const Serializable &serializable,
 		const std::string &dataType,
 		int id
 	);
 
+	/** Set the number of results that are buffered by
+	 *  DataManager::complete() before they are written to file. [Only
+	 *  used for FileType::SerializableBinary and
+	 *  FileType::SerializableHDF5.]
+	 *
+	 *  @param batchSize The number of results to buffer. */
+	void setBatchSize(unsigned int batchSize);
+
+	/** Get the batch size.
+	 *
+	 *  @return The number of results that are buffered before they are
+	 *  written to file. */
+	unsigned int getBatchSize() const;
+
+	/** Write buffered results to file and mark them completed. Called
+	 *  automatically when the batch is full. */
+	void flush();
+
+	/** Write the remaining buffered results to file and mark them
+	 *  completed. Should be called when the last result has been
+	 *  completed. The destructor does not write buffered results, since
+	 *  errors during the write can not be reported from a destructor.
+	 *  Results that are still buffered when the DataManager is destroyed
+	 *  are discarded with a warning and remain uncompleted. */
+	void close();
+
+	/** Get the serialization of a result that has been stored using
+	 *  DataManager::complete().
+	 *
+	 *  @param dataType The data type.
+	 *  @param id The ID of the data point.
+	 *
+	 *  @return The serialization, created with the mode returned by
+	 *  DataManager::getSerializationMode(). */
+	std::string getSerialization(const std::string &dataType, int id) const;
+
+	/** Get the mode with which results of a given data type are
+	 *  serialized by DataManager::complete().
+	 *
+	 *  @param dataType The data type.
+	 *
+	 *  @return The serialization mode. */
+	Mode getSerializationMode(const std::string &dataType) const;
+
 	/** Implements Serializable::serialize(). */
 	virtual std::string serialize(Mode mode) const;
 private:
@@ -161,6 +255,59 @@ private:
 	/** Table of data points that have been completed. */
 	std::vector<bool*> completedDataPoints;
 
+	/** Information about a reservation read from the journal. */
+	class Reservation{
+	public:
+		/** Time of the reservation in seconds since the epoch. */
+		double time;
+
+		/** Process ID of the reserving process. */
+		int processID;
+
+		/** Flag indicating whether the reserving process runs on the
+		 *  same host as this process. */
+		bool isLocal;
+	};
+
+	/** Journal file. Empty if no journal is used. */
+	std::string journalFilename;
+
+	/** Reservation timeout in seconds. Zero if disabled. */
+	double reservationTimeout;
+
+	/** Position in the journal up to which entries have been read. */
+	long long journalOffset;
+
+	/** Reservations read from the journal, indexed by data type index
+	 *  and ID. */
+	std::map<std::pair<unsigned int, unsigned int>, Reservation>
+		reservations;
+
+	/** Position from which the next search for a free data point
+	 *  starts. */
+	unsigned int reservationSearchStart;
+
+	/** Number of results to buffer before writing them to file. */
+	unsigned int batchSize;
+
+	/** Results that have been completed but not yet written to file,
+	 *  stored as pairs of IDs and serializations for each data type. */
+	std::vector<std::vector<std::pair<unsigned int, std::string>>>
+		pendingResults;
+
+	/** Total number of results in pendingResults. */
+	unsigned int numPendingResults;
+
+	/** Position and size of the results in the binary files for each data
+	 *  type. Built incrementally when reading. */
+	mutable std::vector<
+		std::map<unsigned int, std::pair<long long, long long>>
+	> binaryIndices;
+
+	/** Position in the binary files up to which the binary indices have
+	 *  been built. */
+	mutable std::vector<long long> binaryIndexOffsets;
+
 	/** Add data tables. */
 	void addDataTables();
 
@@ -172,6 +319,70 @@ private:
 		const std::string &dataType,
 		unsigned int id
 	);
+
+	/** Returns true if the data point is reserved and the reservation
+	 *  has not expired. */
+	bool isReserved(unsigned int dataTypeIndex, unsigned int id) const;
+
+	/** Lock the journal and read entries that have been appended since
+	 *  the last read.
+	 *
+	 *  @return File descriptor for the locked journal. */
+	int lockJournal();
+
+	/** Append reservation or completion entries to the journal.
+	 *
+	 *  @param fileDescriptor File descriptor returned by
+	 *  DataManager::lockJournal().
+	 *
+	 *  @param entryType 'R' for reservation and 'C' for completion.
+	 *  @param dataType The data type, or an empty string for all data
+	 *  types.
+	 *
+	 *  @param id The ID of the data point. */
+	void appendToJournal(
+		int fileDescriptor,
+		char entryType,
+		const std::string &dataType,
+		unsigned int id
+	);
+
+	/** Unlock the journal.
+	 *
+	 *  @param fileDescriptor File descriptor returned by
+	 *  DataManager::lockJournal(). */
+	void unlockJournal(int fileDescriptor);
+
+	/** Apply an entry read from the journal.
+	 *
+	 *  @param entry The entry without the trailing newline. */
+	void applyJournalEntry(const std::string &entry);
+
+	/** Append the pending results for a data type to its binary file.
+	 *
+	 *  @param dataTypeIndex The data type index. */
+	void flushBinary(unsigned int dataTypeIndex);
+
+	/** Write the pending results for a data type to the HDF5 file.
+	 *
+	 *  @param dataTypeIndex The data type index. */
+	void flushHDF5(unsigned int dataTypeIndex);
+
+	/** Read a result from a binary file.
+	 *
+	 *  @param dataTypeIndex The data type index.
+	 *  @param id The ID of the data point.
+	 *
+	 *  @return The serialization of the result. */
+	std::string readBinary(unsigned int dataTypeIndex, unsigned int id) const;
+
+	/** Read a result from the HDF5 file.
+	 *
+	 *  @param dataTypeIndex The data type index.
+	 *  @param id The ID of the data point.
+	 *
+	 *  @return The serialization of the result. */
+	std::string readHDF5(unsigned int dataTypeIndex, unsigned int id) const;
 };
 
 inline double DataManager::getLowerBound(unsigned int parameterIndex) const{
@@ -216,6 +427,14 @@ inline const std::string& DataManager::getPath() const{
 	return path;
 }
 
+inline const std::string& DataManager::getJournal() const{
+	return journalFilename;
+}
+
+inline unsigned int DataManager::getBatchSize() const{
+	return batchSize;
+}
+
 };	//End namespace TBTK
 
 #endif
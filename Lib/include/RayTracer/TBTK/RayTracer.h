@@ -141,6 +141,47 @@ public:
 
 	/** Save result to file. */
 	void save(std::string filename);
+
+	/** Render a sequence of Densities without opening any window and
+	 *  save the frames to the files filenamePrefix + frame number +
+	 *  filenameSuffix, where the frame number is padded with zeros. The
+	 *  site coordinates, the bounding volume hierarchy, and the sites hit
+	 *  by every ray are calculated once for the whole sequence, after
+	 *  which only the colors are recalculated for each frame. The frames
+	 *  are rendered in parallel and share a common color scale that is
+	 *  set by the minimum and maximum density in the sequence.
+	 *
+	 *  @param model The Model the Densities have been calculated for.
+	 *  @param densities The Densities to render. All Densities must be
+	 *  stored on the IndexDescriptor::Format::Custom format with the same
+	 *  Indices.
+	 *  @param filenamePrefix The part of the filenames that precedes the
+	 *  frame number.
+	 *  @param filenameSuffix The part of the filenames that follows the
+	 *  frame number. Determines the image format. */
+	void renderSequence(
+		const Model &model,
+		const std::vector<const Property::Density*> &densities,
+		const std::string &filenamePrefix,
+		const std::string &filenameSuffix = ".png"
+	);
+
+	/** Render a sequence of Magnetizations without opening any window.
+	 *  See renderSequence() for Densities for details.
+	 *
+	 *  @param model The Model the Magnetizations have been calculated
+	 *  for.
+	 *  @param magnetizations The Magnetizations to render.
+	 *  @param filenamePrefix The part of the filenames that precedes the
+	 *  frame number.
+	 *  @param filenameSuffix The part of the filenames that follows the
+	 *  frame number. */
+	void renderSequence(
+		const Model &model,
+		const std::vector<const Property::Magnetization*> &magnetizations,
+		const std::string &filenamePrefix,
+		const std::string &filenameSuffix = ".png"
+	);
 private:
 	/** Class for encoding RGB colors. */
 	class Color{
@@ -385,6 +426,98 @@ private:
 
 	RenderResult *renderResult;
 
+	/** Bounding volume hierarchy (BVH) over the spheres that represent
+	 *  the sites. The sites are recursively split in two halves along the
+	 *  longest axis of their bounding box, which allows a ray to be tested
+	 *  against O(log(N)) boxes rather than against every site. */
+	class BoundingVolumeHierarchy{
+	public:
+		/** Constructor.
+		 *
+		 *  @param coordinates The coordinates of the sites.
+		 *  @param radius The radius of the spheres. */
+		BoundingVolumeHierarchy(
+			const std::vector<Vector3d> &coordinates,
+			double radius
+		);
+
+		/** Get the site that is hit by a ray. If several sites are
+		 *  hit, the one closest to the ray source is returned.
+		 *
+		 *  @param raySource The source of the ray.
+		 *  @param rayDirection The direction of the ray.
+		 *
+		 *  @return The site that is hit, or -1 if no site is hit. */
+		int getClosestHit(
+			const Vector3d &raySource,
+			const Vector3d &rayDirection
+		) const;
+
+		/** Get the coordinate of a site.
+		 *
+		 *  @param site The site.
+		 *
+		 *  @return The coordinate of the site. */
+		const Vector3d& getCoordinate(unsigned int site) const;
+	private:
+		/** Node in the hierarchy. The first child of a node directly
+		 *  follows the node itself in the list of nodes. */
+		class Node{
+		public:
+			/** Bounding box of the site coordinates. */
+			double lower[3], upper[3];
+
+			/** The range [first, end) in sites covered by the
+			 *  node. */
+			unsigned int first, end;
+
+			/** Position of the second child, or zero for leaf
+			 *  nodes. */
+			unsigned int secondChild;
+
+			/** The axis along which the node is split. */
+			unsigned int axis;
+		};
+
+		/** Coordinates of the sites. */
+		std::vector<Vector3d> coordinates;
+
+		/** Radius of the spheres. */
+		double radius;
+
+		/** Sites ordered such that every node covers a continuous
+		 *  range. */
+		std::vector<unsigned int> sites;
+
+		/** Nodes. The root node is the first node. */
+		std::vector<Node> nodes;
+
+		/** Maximum number of sites in a leaf node. */
+		static constexpr unsigned int MAX_LEAF_SIZE = 4;
+
+		/** Recursively build the hierarchy for the sites in the range
+		 *  [first, end).
+		 *
+		 *  @return The position of the created node. */
+		unsigned int build(unsigned int first, unsigned int end);
+
+		/** Check whether a ray can hit a site inside the given node
+		 *  at a distance that is shorter than maxDistance. */
+		bool intersects(
+			const Node &node,
+			const double *raySource,
+			const double *rayDirection,
+			double maxDistance
+		) const;
+	};
+
+	/** Calculate the coordinate for each Index in an IndexDescriptor by
+	 *  averaging the coordinates of the matching Indices in the Model. */
+	std::vector<Vector3d> getCoordinates(
+		const IndexDescriptor &indexDescriptor,
+		const Model &model
+	) const;
+
 	/** Run rendering procedure. */
 	void render(
 		const IndexDescriptor &indexDescriptor,
@@ -396,16 +529,57 @@ private:
 
 	/** Trace a ray. */
 	Color trace(
-		const std::vector<Vector3d> &coordinates,
+		const BoundingVolumeHierarchy &boundingVolumeHierarchy,
 		const Vector3d &raySource,
 		const Vector3d &rayDirection,
 		const IndexTree &indexTree,
 		const std::vector<const FieldWrapper*> &fields,
 		std::vector<HitDescriptor> &hitDescriptors,
-		std::function<Material(HitDescriptor &hitDescriptor)> lambdaColorPicker,
+		const std::function<Material(HitDescriptor &hitDescriptor)> &lambdaColorPicker,
 		unsigned int deflections = 0
 	);
 
+	/** Trace a ray and its deflections without calculating any colors.
+	 *  The HitDescriptors for the consecutive hits are appended to hits,
+	 *  with the lazily calculated direction from object and impact
+	 *  position already calculated, such that they can be shaded
+	 *  concurrently. */
+	void traceHits(
+		const BoundingVolumeHierarchy &boundingVolumeHierarchy,
+		const Vector3d &raySource,
+		const Vector3d &rayDirection,
+		const IndexTree &indexTree,
+		std::vector<HitDescriptor> &hits,
+		unsigned int numDeflections
+	) const;
+
+	/** Calculate the color of a ray from the hits obtained using
+	 *  traceHits(). Gives the same result as trace() without fields. */
+	Color shadeHits(
+		std::vector<HitDescriptor> &hits,
+		const std::function<Material(HitDescriptor &hitDescriptor)> &lambdaColorPicker,
+		unsigned int numDeflections
+	) const;
+
+	/** Render a sequence of frames without opening any window. */
+	void renderSequence(
+		const IndexDescriptor &indexDescriptor,
+		const Model &model,
+		unsigned int numFrames,
+		std::function<Material(HitDescriptor &hitDescriptor, unsigned int frame)> &&lambdaColorPicker,
+		const std::string &filenamePrefix,
+		const std::string &filenameSuffix
+	);
+
+	/** Get the Material used to plot a Density. */
+	static Material getDensityMaterial(double density, double min, double max);
+
+	/** Get the Material used to plot a Magnetization. */
+	static Material getMagnetizationMaterial(
+		HitDescriptor &hitDescriptor,
+		const SpinMatrix &spinMatrix
+	);
+
 	/** Trace a ray trough a set of fields. */
 	Color traceFields(
 		const std::vector<const FieldWrapper*> &fields,
@@ -416,6 +590,9 @@ private:
 	/** Returns the canvas converted to char-type. */
 	cv::Mat getCharImage() const;
 
+	/** Returns the given canvas converted to char-type. */
+	static cv::Mat getCharImage(const cv::Mat &canvas);
+
 	/** Event handler for the interactive mode. */
 	class EventHandler{
 	public:
@@ -717,6 +894,12 @@ inline const Vector3d& RayTracer::HitDescriptor::getCoordinate() const{
 	return coordinate;
 }
 
+inline const Vector3d& RayTracer::BoundingVolumeHierarchy::getCoordinate(
+	unsigned int site
+) const{
+	return coordinates[site];
+}
+
 inline bool RayTracer::EventHandler::lock(
 	RayTracer *owner,
 	std::function<void(
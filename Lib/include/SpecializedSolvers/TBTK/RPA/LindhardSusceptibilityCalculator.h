@@ -85,8 +85,9 @@ private:
 	/** Slave constructor. */
 	LindhardSusceptibilityCalculator(
 		const MomentumSpaceContext &momentumSpaceContext,
-		int *kPlusQLookupTable,
-		double *fermiDiracLookupTable
+		const int *kPlusQLookupTable,
+		double *fermiDiracLookupTable,
+		SusceptibilityCache *susceptibilityCache
 	);
 
 	/** Calculate the susceptibility using the Lindhard function. */
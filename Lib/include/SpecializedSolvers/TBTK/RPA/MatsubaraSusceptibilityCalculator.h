@@ -71,7 +71,8 @@ private:
 	/** Slave constructor. */
 	MatsubaraSusceptibilityCalculator(
 		const MomentumSpaceContext &momentumSpaceContext,
-		int *kPlusQLookupTable
+		const int *kPlusQLookupTable,
+		SusceptibilityCache *susceptibilityCache
 	);
 
 	/** Calculate the susceptibility using the Matsubara sum. */
@@ -24,6 +24,7 @@
 #define COM_DAFER45_TBTK_MOMENTUM_SPACE_CONTEXT
 
 #include "TBTK/BrillouinZone.h"
+#include "TBTK/MemoryMappedFile.h"
 #include "TBTK/Solver/BlockDiagonalizer.h"
 #include "TBTK/PropertyExtractor/BlockDiagonalizer.h"
 
@@ -37,7 +38,10 @@ public:
 	/** Destructor. */
 	~MomentumSpaceContext();
 
-	/** Set model. */
+	/** Set model. The Model, BrillouinZone, number of mesh points, and
+	 *  number of orbitals cannot be changed once the k+q or k-q lookup
+	 *  tables have been generated, since the solvers that use the
+	 *  MomentumSpaceContext keep pointers to the lookup tables. */
 	void setModel(Model &model);
 
 	/** Get model. */
@@ -64,6 +68,47 @@ public:
 	/** Get number of orbitals. */
 	unsigned int getNumOrbitals() const;
 
+	/** Set whether only the irreducible part of the Brillouin zone should
+	 *  be diagonalized. The eigenvalues and eigenvectors for the
+	 *  remaining mesh points are then obtained from the irreducible mesh
+	 *  points using the symmetry operations of the BrillouinZone, which
+	 *  must be symmetries of the Model. If the BrillouinZone is reduced,
+	 *  the PropertyExtractor returned by
+	 *  getPropertyExtractorBlockDiagonalizer() only contains the blocks
+	 *  of the irreducible mesh points.
+	 *
+	 *  @param useIrreducibleBrillouinZone True to only diagonalize the
+	 *  irreducible part of the Brillouin zone.
+	 *  @param orbitalRepresentations The action of each of the symmetry
+	 *  operations of the BrillouinZone on the orbitals, given as
+	 *  numOrbitals x numOrbitals matrices U such that the amplitudes of
+	 *  an eigenstate at Rk are given by
+	 *  \f$\Psi_{Rk}(o) = \sum_{o'}U_{oo'}\Psi_{k}(o')\f$. If empty, the
+	 *  orbitals are assumed to be invariant under every symmetry
+	 *  operation. */
+	void setUseIrreducibleBrillouinZone(
+		bool useIrreducibleBrillouinZone,
+		const std::vector<Matrix<std::complex<double>>>
+			&orbitalRepresentations = {}
+	);
+
+	/** Get the irreducible part of the mesh. If the irreducible Brillouin
+	 *  zone is not used, every mesh point is irreducible.
+	 *
+	 *  @return The irreducible part of the mesh used in the last call to
+	 *  init(). */
+	const BrillouinZone::IrreducibleMesh& getIrreducibleMesh() const;
+
+	/** Set whether the Solver::BlockDiagonalizer should be kept after the
+	 *  eigenvalues and eigenvectors have been copied to the
+	 *  MomentumSpaceContext by init(). Not keeping the solver halves the
+	 *  memory that remains allocated after init() has finished, but
+	 *  makes getPropertyExtractorBlockDiagonalizer() unavailable.
+	 *
+	 *  @param keepSolver False to release the solver at the end of
+	 *  init(). True by default. */
+	void setKeepSolver(bool keepSolver);
+
 	/** Initialize the SusceptibilityCalculator. */
 	void init();
 
@@ -83,6 +128,26 @@ public:
 	/** Get Index corresponding to given k-vector. */
 	Index getKIndex(const std::vector<double> &k) const;
 
+	/** Get lookup table for the linear index of k+q. The table is
+	 *  generated the first time it is requested and is then shared by
+	 *  every solver that uses the MomentumSpaceContext. The element at
+	 *  position k*mesh.size() + q contains the first linear index of the
+	 *  block that corresponds to mesh[k] + mesh[q].
+	 *
+	 *  @return Pointer to the k+q lookup table, which remains valid for
+	 *  the lifetime of the MomentumSpaceContext. */
+	const int* getKPlusQLookupTable() const;
+
+	/** Get lookup table for the linear index of k-q. The table is
+	 *  generated the first time it is requested and is then shared by
+	 *  every solver that uses the MomentumSpaceContext. The element at
+	 *  position k*mesh.size() + q contains the first linear index of the
+	 *  block that corresponds to mesh[k] - mesh[q].
+	 *
+	 *  @return Pointer to the k-q lookup table, which remains valid for
+	 *  the lifetime of the MomentumSpaceContext. */
+	const int* getKMinusQLookupTable() const;
+
 	/** Get property extractor. */
 	const PropertyExtractor::BlockDiagonalizer& getPropertyExtractorBlockDiagonalizer() const;
 private:
@@ -101,8 +166,25 @@ private:
 	/** Number of orbitals. */
 	unsigned int numOrbitals;
 
+	/** Flag indicating whether only the irreducible part of the
+	 *  Brillouin zone is diagonalized. */
+	bool useIrreducibleBrillouinZone;
+
+	/** Action of the symmetry operations on the orbitals. */
+	std::vector<Matrix<std::complex<double>>> orbitalRepresentations;
+
+	/** Irreducible part of the mesh. */
+	BrillouinZone::IrreducibleMesh irreducibleMesh;
+
+	/** Model containing the blocks of the irreducible mesh points. */
+	Model *irreducibleModel;
+
 	/** Solver. */
-	Solver::BlockDiagonalizer solver;
+	Solver::BlockDiagonalizer *solver;
+
+	/** Flag indicating whether the solver and property extractor are
+	 *  kept after init(). */
+	bool keepSolver;
 
 	/** Property extractor. */
 	PropertyExtractor::BlockDiagonalizer *propertyExtractor;
@@ -117,9 +199,59 @@ private:
 	 *  initialized. */
 	bool isInitialized;
 
+	/** Lookup table for calculating k+q. */
+	mutable const int *kPlusQLookupTable;
+
+	/** Lookup table for calculating k-q. */
+	mutable const int *kMinusQLookupTable;
+
+	/** Cache file that the k+q lookup table is mapped from. Null if the
+	 *  lookup table is stored in ordinary memory. */
+	mutable MemoryMappedFile *kPlusQLookupTableFile;
+
+	/** Cache file that the k-q lookup table is mapped from. Null if the
+	 *  lookup table is stored in ordinary memory. */
+	mutable MemoryMappedFile *kMinusQLookupTableFile;
+
+	/** Get lookup table for k+q (sign = 1) or k-q (sign = -1). The
+	 *  table is generated the first time it is requested, in which case
+	 *  it is mapped from the cache if available, otherwise it is
+	 *  calculated and written to the cache. Can be called repeatedly and
+	 *  from multiple threads, and the lookup table is only generated
+	 *  once.
+	 *
+	 *  The cache is stored in binary files in the directory 'cache',
+	 *  which has to be created by the user for the cache to be used.
+	 *  The files are named by a key that is calculated from the basis and
+	 *  mesh type of the BrillouinZone, the number of mesh points, and the
+	 *  number of orbitals, which allows cache files for different systems
+	 *  to coexist. The files are first written to a temporary file that
+	 *  is then renamed, which makes it safe for several processes to
+	 *  share the same cache. */
+	const int* getKPlusMinusQLookupTable(int sign) const;
+
+	/** Get the key that identifies the k+q (sign = 1) or k-q (sign = -1)
+	 *  lookup table in the cache. */
+	unsigned long long getLookupTableCacheKey(int sign) const;
+
+	/** Assert that the k+q and k-q lookup tables have not been
+	 *  generated. Called whenever a parameter that the lookup tables
+	 *  depend on is changed.
+	 *
+	 *  @param functionName The name of the function that changes the
+	 *  parameter. */
+	void assertLookupTablesNotGenerated(
+		const std::string &functionName
+	) const;
+
+	/** Delete the k+q and k-q lookup tables. */
+	void clearLookupTables();
 };
 
 inline void MomentumSpaceContext::setModel(Model &model){
+	assertLookupTablesNotGenerated(
+		"MomentumSpaceContext::setModel()"
+	);
 	this->model = &model;
 
 	isInitialized = false;
@@ -132,6 +264,9 @@ inline const Model& MomentumSpaceContext::getModel() const{
 inline void MomentumSpaceContext::setBrillouinZone(
 	const BrillouinZone &brillouinZone
 ){
+	assertLookupTablesNotGenerated(
+		"MomentumSpaceContext::setBrillouinZone()"
+	);
 	this->brillouinZone = &brillouinZone;
 
 	isInitialized = false;
@@ -144,6 +279,9 @@ inline const BrillouinZone& MomentumSpaceContext::getBrillouinZone() const{
 inline void MomentumSpaceContext::setNumMeshPoints(
 	const std::vector<unsigned int> &numMeshPoints
 ){
+	assertLookupTablesNotGenerated(
+		"MomentumSpaceContext::setNumMeshPoints()"
+	);
 	this->numMeshPoints = numMeshPoints;
 	TBTKAssert(
 		brillouinZone != nullptr,
@@ -168,6 +306,9 @@ inline const std::vector<std::vector<double>>& MomentumSpaceContext::getMesh(
 }
 
 inline void MomentumSpaceContext::setNumOrbitals(unsigned int numOrbitals){
+	assertLookupTablesNotGenerated(
+		"MomentumSpaceContext::setNumOrbitals()"
+	);
 	this->numOrbitals = numOrbitals;
 
 	isInitialized = false;
@@ -177,6 +318,25 @@ inline unsigned int MomentumSpaceContext::getNumOrbitals() const{
 	return numOrbitals;
 }
 
+inline void MomentumSpaceContext::setUseIrreducibleBrillouinZone(
+	bool useIrreducibleBrillouinZone,
+	const std::vector<Matrix<std::complex<double>>> &orbitalRepresentations
+){
+	this->useIrreducibleBrillouinZone = useIrreducibleBrillouinZone;
+	this->orbitalRepresentations = orbitalRepresentations;
+
+	isInitialized = false;
+}
+
+inline const BrillouinZone::IrreducibleMesh&
+MomentumSpaceContext::getIrreducibleMesh() const{
+	return irreducibleMesh;
+}
+
+inline void MomentumSpaceContext::setKeepSolver(bool keepSolver){
+	this->keepSolver = keepSolver;
+}
+
 inline double MomentumSpaceContext::getEnergy(unsigned int state) const{
 	return energies[state];
 }
@@ -205,8 +365,44 @@ inline Index MomentumSpaceContext::getKIndex(
 	);
 }
 
+inline const int* MomentumSpaceContext::getKPlusQLookupTable() const{
+	return getKPlusMinusQLookupTable(1);
+}
+
+inline const int* MomentumSpaceContext::getKMinusQLookupTable() const{
+	return getKPlusMinusQLookupTable(-1);
+}
+
+inline void MomentumSpaceContext::clearLookupTables(){
+	if(kPlusQLookupTableFile != nullptr){
+		delete kPlusQLookupTableFile;
+		kPlusQLookupTableFile = nullptr;
+	}
+	else if(kPlusQLookupTable != nullptr){
+		delete [] kPlusQLookupTable;
+	}
+	kPlusQLookupTable = nullptr;
+
+	if(kMinusQLookupTableFile != nullptr){
+		delete kMinusQLookupTableFile;
+		kMinusQLookupTableFile = nullptr;
+	}
+	else if(kMinusQLookupTable != nullptr){
+		delete [] kMinusQLookupTable;
+	}
+	kMinusQLookupTable = nullptr;
+}
+
 inline const PropertyExtractor::BlockDiagonalizer& MomentumSpaceContext::getPropertyExtractorBlockDiagonalizer(
 ) const{
+	TBTKAssert(
+		propertyExtractor != nullptr,
+		"MomentumSpaceContext::getPropertyExtractorBlockDiagonalizer()",
+		"The property extractor is not available.",
+		"Make sure MomentumSpaceContext::init() has been called with"
+		<< " MomentumSpaceContext::setKeepSolver() set to true."
+	);
+
 	return *propertyExtractor;
 }
 
@@ -49,7 +49,10 @@ public:
 
 	/** Create slave RPASusceptibilityCalcuator. The slave reuses internal
 	 *  lookup tables used to speed up the calculations and should not be
-	 *  used after the generating master have been destructed. */
+	 *  used after the generating master have been destructed. The slave
+	 *  shares the susceptibility caches with the master, and the master
+	 *  and all of its slaves must therefore be set up with the same
+	 *  energies and interaction parameters. */
 	RPASusceptibilityCalculator* createSlave();
 
 	/** Precompute susceptibilities. Will calculate the susceptibility for
@@ -121,15 +124,40 @@ public:
 
 	/** Load susceptibilities. */
 	void loadSusceptibilities(const std::string &filename);
+
+	/** Set the maximum amount of memory that each of the susceptibility
+	 *  caches is allowed to use. Applies both to the caches for the RPA
+	 *  susceptibilities and to the cache for the bare susceptibility.
+	 *
+	 *  @param maxCacheSizeInBytes The maximum size in bytes. Zero means
+	 *  that the size is unlimited (default). */
+	void setMaxCacheSizeInBytes(size_t maxCacheSizeInBytes);
+
+	/** Set a directory to which susceptibilities that are evicted from
+	 *  the caches are written, rather than being discarded. Must be set
+	 *  before any susceptibility has been calculated.
+	 *
+	 *  @param cacheSpillDirectory Existing directory to write the evicted
+	 *  susceptibilities to. An empty string disables spilling (default).
+	 */
+	void setCacheSpillDirectory(const std::string &cacheSpillDirectory);
 private:
-	/** IndexedDataTree storing the RPA susceptibilities. */
-	IndexedDataTree<SerializableVector<std::complex<double>>> rpaSusceptibilityTree;
+	/** Cache storing the RPA susceptibilities. Owned by the master and
+	 *  shared with the slaves. */
+	SusceptibilityCache *rpaSusceptibilityCache;
+
+	/** Cache storing the RPA charge susceptibility. Owned by the master
+	 *  and shared with the slaves. */
+	SusceptibilityCache *rpaChargeSusceptibilityCache;
 
-	/** IndexedDataTree storing the RPA charge susceptibility. */
-	IndexedDataTree<SerializableVector<std::complex<double>>> rpaChargeSusceptibilityTree;
+	/** Cache storing the RPA spin susceptibility. Owned by the master and
+	 *  shared with the slaves. */
+	SusceptibilityCache *rpaSpinSusceptibilityCache;
 
-	/** IndexedDataTree storing the RPA spin susceptibility. */
-	IndexedDataTree<SerializableVector<std::complex<double>>> rpaSpinSusceptibilityTree;
+	/** Flag indicating whether the RPASusceptibilityCalculator is a
+	 *  master. Masters owns the caches shared between masters and slaves
+	 *  and are responsible for cleaning up. */
+	bool isMaster;
 
 	/** Energy type for the susceptibility. */
 	EnergyType energyType;
@@ -203,7 +231,10 @@ private:
 
 	/** Slave constructor. */
 	RPASusceptibilityCalculator(
-		SusceptibilityCalculator &susceptibilityCalculator
+		SusceptibilityCalculator &susceptibilityCalculator,
+		SusceptibilityCache *rpaSusceptibilityCache,
+		SusceptibilityCache *rpaChargeSusceptibilityCache,
+		SusceptibilityCache *rpaSpinSusceptibilityCache
 	);
 
 	/** Get Susceptibility result Index. */
@@ -319,9 +350,9 @@ inline void RPASusceptibilityCalculator::setEnergies(
 
 	this->energies = energies;
 
-	rpaSusceptibilityTree.clear();
-	rpaChargeSusceptibilityTree.clear();
-	rpaSpinSusceptibilityTree.clear();
+	rpaSusceptibilityCache->clear();
+	rpaChargeSusceptibilityCache->clear();
+	rpaSpinSusceptibilityCache->clear();
 }
 
 inline void RPASusceptibilityCalculator::setEnergiesAreInversionSymmetric(
@@ -387,6 +418,24 @@ inline void RPASusceptibilityCalculator::loadSusceptibilities(
 	susceptibilityCalculator->loadSusceptibilities(filename);
 }
 
+inline void RPASusceptibilityCalculator::setMaxCacheSizeInBytes(
+	size_t maxCacheSizeInBytes
+){
+	susceptibilityCalculator->setMaxCacheSizeInBytes(maxCacheSizeInBytes);
+	rpaSusceptibilityCache->setMaxSizeInBytes(maxCacheSizeInBytes);
+	rpaChargeSusceptibilityCache->setMaxSizeInBytes(maxCacheSizeInBytes);
+	rpaSpinSusceptibilityCache->setMaxSizeInBytes(maxCacheSizeInBytes);
+}
+
+inline void RPASusceptibilityCalculator::setCacheSpillDirectory(
+	const std::string &cacheSpillDirectory
+){
+	susceptibilityCalculator->setCacheSpillDirectory(cacheSpillDirectory);
+	rpaSusceptibilityCache->setSpillDirectory(cacheSpillDirectory);
+	rpaChargeSusceptibilityCache->setSpillDirectory(cacheSpillDirectory);
+	rpaSpinSusceptibilityCache->setSpillDirectory(cacheSpillDirectory);
+}
+
 inline std::vector<std::complex<double>> RPASusceptibilityCalculator::calculateRPASusceptibility(
 		const std::vector<double> &k,
 		const std::vector<int> &orbitalIndices
@@ -428,33 +477,33 @@ inline std::vector<std::complex<double>> RPASusceptibilityCalculator::calculateS
 
 inline void RPASusceptibilityCalculator::setU(std::complex<double> U){
 	this->U = U;
-	rpaSusceptibilityTree.clear();
-	rpaChargeSusceptibilityTree.clear();
-	rpaSpinSusceptibilityTree.clear();
+	rpaSusceptibilityCache->clear();
+	rpaChargeSusceptibilityCache->clear();
+	rpaSpinSusceptibilityCache->clear();
 	interactionAmplitudesAreGenerated = false;
 }
 
 inline void RPASusceptibilityCalculator::setUp(std::complex<double> Up){
 	this->Up = Up;
-	rpaSusceptibilityTree.clear();
-	rpaChargeSusceptibilityTree.clear();
-	rpaSpinSusceptibilityTree.clear();
+	rpaSusceptibilityCache->clear();
+	rpaChargeSusceptibilityCache->clear();
+	rpaSpinSusceptibilityCache->clear();
 	interactionAmplitudesAreGenerated = false;
 }
 
 inline void RPASusceptibilityCalculator::setJ(std::complex<double> J){
 	this->J = J;
-	rpaSusceptibilityTree.clear();
-	rpaChargeSusceptibilityTree.clear();
-	rpaSpinSusceptibilityTree.clear();
+	rpaSusceptibilityCache->clear();
+	rpaChargeSusceptibilityCache->clear();
+	rpaSpinSusceptibilityCache->clear();
 	interactionAmplitudesAreGenerated = false;
 }
 
 inline void RPASusceptibilityCalculator::setJp(std::complex<double> Jp){
 	this->Jp = Jp;
-	rpaSusceptibilityTree.clear();
-	rpaChargeSusceptibilityTree.clear();
-	rpaSpinSusceptibilityTree.clear();
+	rpaSusceptibilityCache->clear();
+	rpaChargeSusceptibilityCache->clear();
+	rpaSpinSusceptibilityCache->clear();
 	interactionAmplitudesAreGenerated = false;
 }
 
@@ -100,11 +100,14 @@ private:
 	/** ElectronFluctuationVertexCalculator. */
 	std::vector<ElectronFluctuationVertexCalculator*> electronFluctuationVertexCalculators;
 
-	/** Lookup table for calculating k+q. */
-	int *kMinusQLookupTable;
+	/** Lookup table for calculating k-q. Owned by the
+	 *  MomentumSpaceContext. */
+	const int *kMinusQLookupTable;
 
 	/** Generate lookup table for the k-q linear index. Can be called
-	 *  repeatedly, and the lookup table is only generated once. */
+	 *  repeatedly, and the lookup table is only generated once. The
+	 *  lookup table is owned by the MomentumSpaceContext and is shared
+	 *  with all other solvers that use the same context. */
 	void generateKMinusQLookupTable();
 
 	/** Returns the linear index for k+q. */
@@ -0,0 +1,215 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file SusceptibilityCache.h
+ *  @brief Thread safe and memory bounded cache for susceptibilities.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_SUSCEPTIBILITY_CACHE
+#define COM_DAFER45_TBTK_SUSCEPTIBILITY_CACHE
+
+#include "TBTK/Index.h"
+#include "TBTK/IndexedDataTree.h"
+#include "TBTK/SerializableVector.h"
+
+#include <complex>
+#include <ios>
+#include <string>
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Thread safe and memory bounded cache for susceptibilities.
+ *
+ *  The SusceptibilityCache stores vectors of complex numbers under Indices
+ *  and can be accessed concurrently from several threads. This allows a
+ *  master calculator and its slaves to share the results that have already
+ *  been calculated, rather than each recalculating them. To reduce the
+ *  contention between threads, the entries are distributed over a number
+ *  of shards that are locked independently of each other.
+ *
+ *  The memory used by the cache can be limited by setting a maximum size.
+ *  Each shard is then allowed to use an equal part of the memory, and the
+ *  least recently used entries in a shard are evicted when it grows beyond
+ *  its part. If a spill directory has been set, evicted entries are written
+ *  to disk instead of being discarded and are read back the next time they
+ *  are requested. An entry that is spilled again reuses its old slot in the
+ *  spill file, and slots that are left behind when the size of an entry
+ *  changes are reused by other entries of the same size. The spill files
+ *  therefore only grow beyond the size needed to hold all spilled entries
+ *  if the entries have many different sizes. The spill files are removed
+ *  when the cache is cleared or destroyed. */
+class SusceptibilityCache{
+public:
+	/** Constructor.
+	 *
+	 *  @param numShards The number of shards to distribute the entries
+	 *  over. */
+	SusceptibilityCache(unsigned int numShards = 64);
+
+	/** Copy constructor. Deleted since the shards hold locks and files
+	 *  that cannot be shared. */
+	SusceptibilityCache(
+		const SusceptibilityCache &susceptibilityCache
+	) = delete;
+
+	/** Destructor. */
+	~SusceptibilityCache();
+
+	/** Assignment operator. Deleted since the shards hold locks and
+	 *  files that cannot be shared. */
+	SusceptibilityCache& operator=(
+		const SusceptibilityCache &susceptibilityCache
+	) = delete;
+
+	/** Add data to the cache. Replaces any data that is already stored
+	 *  under the same Index.
+	 *
+	 *  @param data The data to add.
+	 *  @param index The Index to store the data under. */
+	void add(
+		const std::vector<std::complex<double>> &data,
+		const Index &index
+	);
+
+	/** Add all data stored in an IndexedDataTree to the cache.
+	 *
+	 *  @param indexedDataTree The IndexedDataTree to add the data from. */
+	void add(
+		const IndexedDataTree<
+			SerializableVector<std::complex<double>>
+		> &indexedDataTree
+	);
+
+	/** Get data from the cache.
+	 *
+	 *  @param data Vector to write the data to.
+	 *  @param index The Index of the data.
+	 *
+	 *  @return True if the data was found in the cache, otherwise false.
+	 *  The data is left unchanged if it is not found. */
+	bool get(std::vector<std::complex<double>> &data, const Index &index);
+
+	/** Remove all entries from the cache. */
+	void clear();
+
+	/** Set the maximum amount of memory that the cache is allowed to
+	 *  use. Entries are evicted immediately if the cache already uses
+	 *  more memory than the new limit. The memory used is estimated from
+	 *  the size of the data and Indices, and the bookkeeping overhead of
+	 *  the containers is not included.
+	 *
+	 *  @param maxSizeInBytes The maximum size in bytes. Zero means that
+	 *  the size is unlimited (default). */
+	void setMaxSizeInBytes(size_t maxSizeInBytes);
+
+	/** Get the maximum amount of memory that the cache is allowed to use.
+	 *
+	 *  @return The maximum size in bytes, or zero if the size is
+	 *  unlimited. */
+	size_t getMaxSizeInBytes() const;
+
+	/** Get the amount of memory currently used by the entries that are
+	 *  kept in memory.
+	 *
+	 *  @return The size in bytes. */
+	size_t getSizeInBytes() const;
+
+	/** Set a directory to write evicted entries to. The cache must be
+	 *  empty when the directory is set.
+	 *
+	 *  @param spillDirectory Existing directory to write the evicted
+	 *  entries to. An empty string disables spilling, in which case
+	 *  evicted entries are discarded (default). */
+	void setSpillDirectory(const std::string &spillDirectory);
+
+	/** Get the directory that evicted entries are written to.
+	 *
+	 *  @return The spill directory, or an empty string if spilling is
+	 *  disabled. */
+	const std::string& getSpillDirectory() const;
+
+	/** Get all entries in the cache, including the entries that have
+	 *  been spilled to disk, as an IndexedDataTree.
+	 *
+	 *  @return An IndexedDataTree containing all entries. */
+	IndexedDataTree<
+		SerializableVector<std::complex<double>>
+	> getIndexedDataTree();
+private:
+	/** Part of the cache that is protected by a common lock. Defined in
+	 *  the source file to keep the OpenMP dependency out of the header. */
+	class Shard;
+
+	/** Number of shards. */
+	unsigned int numShards;
+
+	/** The shards. */
+	Shard *shards;
+
+	/** Maximum size in bytes. Zero means unlimited. */
+	size_t maxSizeInBytes;
+
+	/** Directory to write evicted entries to. */
+	std::string spillDirectory;
+
+	/** Identifier used to give the spill files unique names. */
+	unsigned int id;
+
+	/** Get the shard that an Index belongs to. */
+	Shard& getShard(const Index &index);
+
+	/** Lock a shard. */
+	static void lock(Shard &shard);
+
+	/** Unlock a shard. */
+	static void unlock(Shard &shard);
+
+	/** Evict the least recently used entries until the shard uses less
+	 *  memory than its part of the maximum size. The most recently used
+	 *  entry is never evicted. Assumes that the shard is locked. */
+	void evict(Shard &shard);
+
+	/** Write the least recently used entry to the spill file. Assumes
+	 *  that the shard is locked. */
+	void spillLast(Shard &shard);
+
+	/** Read an entry from the spill file. Assumes that the shard is
+	 *  locked. */
+	void readSpilled(
+		Shard &shard,
+		std::streamoff position,
+		std::vector<std::complex<double>> &data
+	);
+
+	/** Remove all entries from a shard and delete its spill file.
+	 *  Assumes that the shard is locked. */
+	void clear(Shard &shard);
+};
+
+inline size_t SusceptibilityCache::getMaxSizeInBytes() const{
+	return maxSizeInBytes;
+}
+
+inline const std::string& SusceptibilityCache::getSpillDirectory() const{
+	return spillDirectory;
+}
+
+};	//End of namespace TBTK
+
+#endif
@@ -27,6 +27,7 @@
 #include "TBTK/IndexedDataTree.h"
 #include "TBTK/InteractionAmplitude.h"
 #include "TBTK/RPA/MomentumSpaceContext.h"
+#include "TBTK/RPA/SusceptibilityCache.h"
 #include "TBTK/Resource.h"
 #include "TBTK/SerializableVector.h"
 #include "TBTK/UnitHandler.h"
@@ -62,7 +63,13 @@ public:
 
 	/** Create slave SusceptibilityCalcuator. The slave reuses internal
 	 *  lookup tables used to speed up the calculations and should not be
-	 *  used after the generating master have been destructed. */
+	 *  used after the generating master have been destructed. The slave
+	 *  also shares the susceptibility cache with the master, which allows
+	 *  the master and slaves to be used concurrently from different
+	 *  threads without recalculating each others results. The master and
+	 *  all of its slaves must therefore be set up with the same energies,
+	 *  and changing the energies of one of them clears the cache for all
+	 *  of them. */
 	virtual SusceptibilityCalculator* createSlave() = 0;
 
 	/** Calculate the susceptibility. */
@@ -93,7 +100,8 @@ public:
 
 	/** Generate lookup table for the k+q linear index. Can be called
 	 *  repeatedly, and the lookup table is only generated the first time.
-	 */
+	 *  The lookup table is owned by the MomentumSpaceContext and is
+	 *  shared with all other solvers that use the same context. */
 	void generateKPlusQLookupTable();
 
 	/** Enum class for indicating whether the energy is an arbitrary comlex
@@ -141,21 +149,36 @@ public:
 
 	/** Load susceptibilities. */
 	void loadSusceptibilities(const std::string &filename);
+
+	/** Set the maximum amount of memory that the susceptibility cache is
+	 *  allowed to use. The least recently used susceptibilities are
+	 *  evicted from the cache when the limit is reached. The cache is
+	 *  shared between the master and its slaves.
+	 *
+	 *  @param maxCacheSizeInBytes The maximum size in bytes. Zero means
+	 *  that the size is unlimited (default). */
+	void setMaxCacheSizeInBytes(size_t maxCacheSizeInBytes);
+
+	/** Set a directory to which susceptibilities that are evicted from
+	 *  the cache are written, rather than being discarded. Must be set
+	 *  before any susceptibility has been calculated.
+	 *
+	 *  @param cacheSpillDirectory Existing directory to write the evicted
+	 *  susceptibilities to. An empty string disables spilling (default).
+	 */
+	void setCacheSpillDirectory(const std::string &cacheSpillDirectory);
 protected:
 	/** Slave constructor. */
 	SusceptibilityCalculator(
 		Algorithm algorithm,
 		const MomentumSpaceContext &momentumSpaceContext,
-		int *kPlusQLookupTable/*,
-		double *fermiDiracLookupTable*/
+		const int *kPlusQLookupTable,
+		SusceptibilityCache *susceptibilityCache
 	);
 
 	/** Returns true if the SusceptibilityCalculator is a master. */
 	bool getIsMaster() const;
 
-	/** Returns the k+q lookup table. */
-	int* getKPlusQLookupTable();
-
 	/** Returns the k+q lookup table. */
 	const int* getKPlusQLookupTable() const;
 
@@ -165,8 +188,8 @@ protected:
 		const std::vector<int> &orbitalIndices
 	) const;
 
-	/** Get susceptibility tree. */
-	const IndexedDataTree<SerializableVector<std::complex<double>>>& getSusceptibilityTree() const;
+	/** Get susceptibility cache. */
+	SusceptibilityCache& getSusceptibilityCache() const;
 
 	/** Returns the linear index for k+q. */
 	template<bool useKPlusQLookupTable>
@@ -188,8 +211,9 @@ protected:
 	/** Clear cache. */
 	void clearCache();
 private:
-	/** IndexedDataTree storing the bare susceptibilities. */
-	IndexedDataTree<SerializableVector<std::complex<double>>> susceptibilityTree;
+	/** Cache storing the bare susceptibilities. Owned by the master and
+	 *  shared with the slaves. */
+	SusceptibilityCache *susceptibilityCache;
 
 	/** Algorithm. */
 	Algorithm algorithm;
@@ -208,8 +232,9 @@ private:
 	/** Momentum space context. */
 	const MomentumSpaceContext *momentumSpaceContext;
 
-	/** Lookup table for calculating k+q. */
-	int *kPlusQLookupTable;
+	/** Lookup table for calculating k+q. Owned by the
+	 *  MomentumSpaceContext. */
+	const int *kPlusQLookupTable;
 
 	/** Flag indicating whether the SusceptibilityCalculator is a master.
 	 *  Masters owns resources shared between masters and slaves and is
@@ -256,7 +281,7 @@ inline void SusceptibilityCalculator::setEnergies(
 	const std::vector<std::complex<double>> &energies
 ){
 	this->energies = energies;
-	susceptibilityTree.clear();
+	susceptibilityCache->clear();
 }
 
 inline const std::vector<std::complex<double>>& SusceptibilityCalculator::getEnergies() const{
@@ -279,7 +304,9 @@ inline void SusceptibilityCalculator::saveSusceptibilities(
 ) const{
 	Resource resource;
 	resource.setData(
-		susceptibilityTree.serialize(Serializable::Mode::JSON)
+		susceptibilityCache->getIndexedDataTree().serialize(
+			Serializable::Mode::JSON
+		)
 	);
 	resource.write(filename);
 }
@@ -289,12 +316,27 @@ inline void SusceptibilityCalculator::loadSusceptibilities(
 ){
 	Resource resource;
 	resource.read(filename);
-	susceptibilityTree = IndexedDataTree<SerializableVector<std::complex<double>>>(
-		resource.getData(),
-		Serializable::Mode::JSON
+	susceptibilityCache->clear();
+	susceptibilityCache->add(
+		IndexedDataTree<SerializableVector<std::complex<double>>>(
+			resource.getData(),
+			Serializable::Mode::JSON
+		)
 	);
 }
 
+inline void SusceptibilityCalculator::setMaxCacheSizeInBytes(
+	size_t maxCacheSizeInBytes
+){
+	susceptibilityCache->setMaxSizeInBytes(maxCacheSizeInBytes);
+}
+
+inline void SusceptibilityCalculator::setCacheSpillDirectory(
+	const std::string &cacheSpillDirectory
+){
+	susceptibilityCache->setSpillDirectory(cacheSpillDirectory);
+}
+
 inline std::vector<std::complex<double>> SusceptibilityCalculator::calculateSusceptibility(
 		const std::vector<double> &k,
 		const std::vector<int> &orbitalIndices
@@ -309,17 +351,13 @@ inline std::vector<std::complex<double>> SusceptibilityCalculator::calculateSusc
 }
 
 inline void SusceptibilityCalculator::clearCache(){
-	susceptibilityTree.clear();
+	susceptibilityCache->clear();
 }
 
 inline bool SusceptibilityCalculator::getIsMaster() const{
 	return isMaster;
 }
 
-inline int* SusceptibilityCalculator::getKPlusQLookupTable(){
-	return kPlusQLookupTable;
-}
-
 inline const int* SusceptibilityCalculator::getKPlusQLookupTable() const{
 	return kPlusQLookupTable;
 }
@@ -355,8 +393,9 @@ inline int SusceptibilityCalculator::getKPlusQLinearIndex<true>(
 	];
 }
 
-inline const IndexedDataTree<SerializableVector<std::complex<double>>>& SusceptibilityCalculator::getSusceptibilityTree() const{
-	return susceptibilityTree;
+inline SusceptibilityCache& SusceptibilityCalculator::getSusceptibilityCache(
+) const{
+	return *susceptibilityCache;
 }
 
 };	//End of namespace TBTK
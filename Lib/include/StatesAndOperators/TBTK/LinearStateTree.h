@@ -0,0 +1,215 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file LinearStateTree.h
+ *  @brief Flattened static tree for quick access of multiple States.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_LINEAR_STATE_TREE
+#define COM_DAFER45_TBTK_LINEAR_STATE_TREE
+
+#include "TBTK/AbstractState.h"
+#include "TBTK/StateSet.h"
+#include "TBTK/StateTreeNode.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <cmath>
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Flattened static tree for quick access of multiple States.
+ *
+ *  The LinearStateTree is a read only version of a StateTreeNode tree that
+ *  is stored in a few contiguous arrays rather than as a tree of
+ *  separately allocated nodes. The nodes are stored in depth first order
+ *  with the children of each node ordered such that the nodes appear in
+ *  Morton (Z-) order, and each node stores the position of the node that
+ *  follows after its subtree. A query is therefore a single forward sweep
+ *  over the nodes that skips the subtrees that do not overlap with the
+ *  queried region. The coordinates and extents of the states are copied
+ *  into the tree, so that the states themselves do not need to be
+ *  accessed until they are known to overlap with the region.
+ *
+ *  The overlapping states can either be written to a caller provided
+ *  buffer or passed to a visitor, neither of which requires any memory
+ *  to be allocated per query. The LinearStateTree can be queried
+ *  concurrently from several threads. Like the StateTreeNode, it does not
+ *  own the states, which must remain unchanged for the lifetime of the
+ *  LinearStateTree. The states are returned in the same order as by
+ *  StateTreeNode::getOverlappingStates(). */
+class LinearStateTree{
+public:
+	/** Constructor.
+	 *
+	 *  @param stateTreeNode The StateTreeNode to flatten. */
+	LinearStateTree(const StateTreeNode &stateTreeNode);
+
+	/** Constructor. Creates a StateTreeNode from the StateSet and
+	 *  flattens it.
+	 *
+	 *  @param stateSet StateSet containing the states to store in the
+	 *  tree.
+	 *  @param maxDepth Maximum depth of the tree.
+	 *  @param centerShiftMultiplier See StateTreeNode. */
+	LinearStateTree(
+		const StateSet &stateSet,
+		int maxDepth = 10,
+		double centerShiftMultiplier = 3.14
+	);
+
+	/** Get the number of states in the tree.
+	 *
+	 *  @return The number of states in the tree. */
+	unsigned int getNumStates() const;
+
+	/** Get all states that have a finite overlap with the region centered
+	 *  at 'coordinates' and with extent 'extent'. The buffer is cleared
+	 *  before the states are added to it, which allows the same buffer to
+	 *  be reused for several queries without reallocation.
+	 *
+	 *  @param coordinates The center of the region.
+	 *  @param extent The extent of the region.
+	 *  @param overlappingStates Buffer to write the states to. */
+	void getOverlappingStates(
+		const std::vector<double> &coordinates,
+		double extent,
+		std::vector<const AbstractState*> &overlappingStates
+	) const;
+
+	/** Get the overlapping states for several regions in parallel. The
+	 *  regions are given by the coordinates and extents of the states
+	 *  passed as argument.
+	 *
+	 *  @param states States defining the regions.
+	 *
+	 *  @return The overlapping states for each of the regions. */
+	std::vector<std::vector<const AbstractState*>> getOverlappingStates(
+		const std::vector<AbstractState*> &states
+	) const;
+
+	/** Call a visitor for every state that has a finite overlap with the
+	 *  region centered at 'coordinates' and with extent 'extent'.
+	 *
+	 *  @param coordinates The center of the region. Must have the same
+	 *  number of components as the coordinates of the states in the tree.
+	 *  @param extent The extent of the region.
+	 *  @param visitor Callable object on the form
+	 *  visitor(const AbstractState *state). */
+	template<typename Visitor>
+	void visitOverlappingStates(
+		const double *coordinates,
+		double extent,
+		Visitor &&visitor
+	) const;
+private:
+	/** Node in the flattened tree. */
+	class Node{
+	public:
+		/** Position of the node's first state in the state arrays. */
+		unsigned int firstState;
+
+		/** Position after the node's last state in the state arrays.
+		 */
+		unsigned int endState;
+
+		/** Position of the node that follows after the node's
+		 *  subtree. */
+		unsigned int next;
+
+		/** Radius of the sphere circumscribing the node. */
+		double radius;
+	};
+
+	/** Number of coordinates per state. */
+	unsigned int dimensions;
+
+	/** Nodes in depth first order. */
+	std::vector<Node> nodes;
+
+	/** Node centers, stored with 'dimensions' components per node. */
+	std::vector<double> nodeCenters;
+
+	/** States ordered by node. */
+	std::vector<const AbstractState*> states;
+
+	/** State coordinates, stored with 'dimensions' components per state.
+	 */
+	std::vector<double> stateCoordinates;
+
+	/** State extents. */
+	std::vector<double> stateExtents;
+
+	/** Flatten a StateTreeNode and its children. Empty subtrees are left
+	 *  out.
+	 *
+	 *  @return True if the StateTreeNode or any of its children contains
+	 *  states. */
+	bool flatten(const StateTreeNode &stateTreeNode);
+};
+
+inline unsigned int LinearStateTree::getNumStates() const{
+	return states.size();
+}
+
+template<typename Visitor>
+void LinearStateTree::visitOverlappingStates(
+	const double *coordinates,
+	double extent,
+	Visitor &&visitor
+) const{
+	unsigned int n = 0;
+	while(n < nodes.size()){
+		const Node &node = nodes[n];
+
+		//Skip the subtree if the region does not overlap with the
+		//sphere circumscribing the node.
+		const double *center = &nodeCenters[n*dimensions];
+		double distance = 0.;
+		for(unsigned int c = 0; c < dimensions; c++){
+			double difference = coordinates[c] - center[c];
+			distance += difference*difference;
+		}
+		distance = sqrt(distance);
+		if(distance > node.radius + extent){
+			n = node.next;
+			continue;
+		}
+
+		for(unsigned int s = node.firstState; s < node.endState; s++){
+			const double *stateCoordinate
+				= &stateCoordinates[s*dimensions];
+			double distance = 0.;
+			for(unsigned int c = 0; c < dimensions; c++){
+				double difference
+					= coordinates[c] - stateCoordinate[c];
+				distance += difference*difference;
+			}
+			distance = sqrt(distance);
+
+			if(distance <= extent + stateExtents[s])
+				visitor(states[s]);
+		}
+
+		n++;
+	}
+}
+
+};	//End of namespace TBTK
+
+#endif
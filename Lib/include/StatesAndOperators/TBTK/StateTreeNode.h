@@ -84,6 +84,10 @@ public:
 	/** Get radius. */
 	double getRadius() const;
 private:
+	/** The LinearStateTree flattens the StateTreeNode and its children
+	 *  and therefore needs access to the internal structure. */
+	friend class LinearStateTree;
+
 	/** Child nodes. */
 	std::vector<StateTreeNode*> stateTreeNodes;
 
@@ -23,15 +23,35 @@
 #ifndef COM_DAFER45_TBTK_ABSTRACT_PROPERTY
 #define COM_DAFER45_TBTK_ABSTRACT_PROPERTY
 
+#include "TBTK/MemoryMappedFile.h"
 #include "TBTK/Property/IndexDescriptor.h"
 #include "TBTK/SpinMatrix.h"
 #include "TBTK/TBTKMacros.h"
 
 #include "TBTK/json.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
 namespace TBTK{
 namespace Property{
 
+/** Open a Property that has been written to file using
+ *  AbstractProperty::mapToFile(). Only the metadata is deserialized, while
+ *  the data is accessed directly in the memory mapped file.
+ *
+ *  @param filename The name of the file.
+ *  @param writable If true, modifications of the data are written back to
+ *  the file.
+ *
+ *  @return The memory mapped Property. */
+template<typename PropertyType>
+PropertyType openMemoryMapped(
+	const std::string &filename,
+	bool writable = false
+);
+
 /** @brief Abstract Property class.
  *
  *  The AbstractProperty provides a generic storage for data of different type
@@ -86,7 +106,19 @@ namespace Property{
  *  blocks are stored in when containing data for multiple @link Index Indices
  *  @endlink is such that if the @link Index Indices@endlink are added to an
  *  IndexTree, they appear in the order of the corresponding linear indices
- *  obtained from the IndexTree. */
+ *  obtained from the IndexTree.
+ *
+ *  <b>Memory mapped storage:</b><br/>
+ *  By default the data is stored in memory. For large Properties the data
+ *  can instead be stored in a memory mapped file by calling
+ *  AbstractProperty::mapToFile(). The data is then paged in and out by the
+ *  operating system and is never required to fit in RAM. A file created in
+ *  this way can later be opened without deserializing the data using
+ *  Property::openMemoryMapped(). The data of a memory mapped Property is
+ *  accessed through the function operators or
+ *  AbstractProperty::getDataPointer(), while AbstractProperty::getData()
+ *  and AbstractProperty::getDataRW() only work for data stored in memory.
+ *  Copies of a memory mapped Property store their data in memory. */
 template<
 	typename DataType,
 	bool isFundamental = std::is_fundamental<DataType>::value,
@@ -105,19 +137,34 @@ public:
 	 *  number of blocks times the block size. */
 	unsigned int getSize() const;
 
-	/** Get data.
+	/** Get data. [Does not work for memory mapped Properties.]
 	 *
 	 *  @return The data on the raw format described in the detailed
 	 *  description. */
 	const std::vector<DataType>& getData() const;
 
 	/** Get data. Same as AbstractProperty::getData(), but with write
-	 *  access.
+	 *  access. [Does not work for memory mapped Properties.]
 	 *
 	 *  @return The data on the raw format described in the detailed
 	 *  description. */
 	std::vector<DataType>& getDataRW();
 
+	/** Get a pointer to the data. Unlike AbstractProperty::getData(),
+	 *  this works both for data stored in memory and for memory mapped
+	 *  data.
+	 *
+	 *  @return Pointer to the first element of the data on the raw format
+	 *  described in the detailed description. */
+	const DataType* getDataPointer() const;
+
+	/** Get a pointer to the data. Same as
+	 *  AbstractProperty::getDataPointer(), but with write access.
+	 *
+	 *  @return Pointer to the first element of the data on the raw format
+	 *  described in the detailed description. */
+	DataType* getDataPointerRW();
+
 	/** Get the dimension of the data. [Only works for the Ranges format.]
 	 *
 	 *  @return The dimension of the grid that the data is calculated on.
@@ -283,6 +330,26 @@ public:
 	 *  bounds access.*/
 	void setDefaultValue(const DataType &defaultValue);
 
+	/** Move the data to a memory mapped file. The Property is written to
+	 *  the file and the memory used for the data is released, after which
+	 *  all access to the data goes directly to the file. The file can
+	 *  later be opened using Property::openMemoryMapped(). [Not supported
+	 *  for bool or non-trivially copyable data types.]
+	 *
+	 *  @param filename The name of the file to create. */
+	void mapToFile(const std::string &filename);
+
+	/** Get whether the data is stored in a memory mapped file.
+	 *
+	 *  @return True if the data is stored in a memory mapped file. */
+	bool getIsMemoryMapped() const;
+
+	/** Write modified data back to the memory mapped file. The operating
+	 *  system writes the data back eventually in any case, but this
+	 *  function can be used to ensure that the file is up to date.
+	 *  [Only meaningful for memory mapped Properties.] */
+	void syncMemoryMappedFile();
+
 	/** Implements Serializable::serialize(). */
 	virtual std::string serialize(Mode mode) const;
 protected:
@@ -420,6 +487,63 @@ private:
 	/** Default value used for out of bounds access. */
 	DataType defaultValue;
 
+	/** File storing the data when the Property is memory mapped. Equal
+	 *  to nullptr when the data is stored in AbstractProperty::data. */
+	MemoryMappedFile *memoryMappedFile = nullptr;
+
+	/** Pointer to the first data element in the memory mapped file. */
+	DataType *memoryMappedData = nullptr;
+
+	/** Number of data elements in the memory mapped file. */
+	unsigned int memoryMappedSize = 0;
+
+	/** Flag indicating whether the memory mapped file is writable. The
+	 *  data of a read only file is mapped without write permission and
+	 *  must not be accessed through the non-const data accessors. */
+	bool memoryMappedIsWritable = false;
+
+	/** Identifier at the beginning of memory mapped Property files. */
+	static constexpr const char *memoryMappedIdentifier = "TBTKMMAP";
+
+	/** Size of the fixed size part of the memory mapped file layout. The
+	 *  layout is given by the identifier, the serialization size, the
+	 *  data offset, and the number of data elements as 64-bit integers,
+	 *  followed by the element size and a byte order mark as 32-bit
+	 *  integers. After this follows the Serializable::Mode::Binary
+	 *  serialization of the Property without data. The data is stored at
+	 *  the data offset, which is aligned to a page boundary. */
+	static constexpr unsigned int memoryMappedLayoutSize = 40;
+
+	/** Byte order mark used to detect files written on machines with
+	 *  different endianness. */
+	static constexpr uint32_t memoryMappedByteOrderMark = 0x01020304;
+
+	/** Take ownership of a memory mapped file written by
+	 *  AbstractProperty::mapToFile() and use it as data storage.
+	 *
+	 *  @param memoryMappedFile The memory mapped file. */
+	void attachMemoryMappedFile(MemoryMappedFile *memoryMappedFile);
+
+	/** Release the memory mapped file. */
+	void detachMemoryMappedFile();
+
+	/** Read the serialization stored in a memory mapped Property file.
+	 *
+	 *  @param memoryMappedFile The memory mapped file.
+	 *
+	 *  @return The Serializable::Mode::Binary serialization of the
+	 *  Property without data. */
+	static std::string readMemoryMappedSerialization(
+		const MemoryMappedFile &memoryMappedFile
+	);
+
+	/** Allow openMemoryMapped() to attach the file. */
+	template<typename PropertyType>
+	friend PropertyType openMemoryMapped(
+		const std::string &filename,
+		bool writable
+	);
+
 	/** Function to be overloaded by Properties that support dynamic
 	 *  calculation. The overloading function should calculate the property
 	 *  for the given Index and write it into the provided block. If no
@@ -431,8 +555,44 @@ private:
 	 *  @param block Pointer to the first element of the block into which
 	 *  the Property should be written. */
 	virtual void calculateDynamically(const Index &index, DataType *block);
+
+	/** Serialize the AbstractProperty using Serializable::Mode::Binary.
+	 *  The data is written as a single array rather than element by
+	 *  element.
+	 *
+	 *  @return The serialization string. */
+	std::string serializeBinary() const;
+
+	/** Read the members that are not initialized in the initializer list
+	 *  of the serialization constructor from a binary serialization
+	 *  string.
+	 *
+	 *  @param serialization Serialization string created by
+	 *  AbstractProperty::serializeBinary(). */
+	void deserializeBinary(const std::string &serialization);
 };
 
+template<typename DataType, bool isFundamental, bool isSerializable>
+constexpr const char *AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::memoryMappedIdentifier;
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+constexpr unsigned int AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::memoryMappedLayoutSize;
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+constexpr uint32_t AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::memoryMappedByteOrderMark;
+
 template<typename DataType, bool isFundamental, bool isSerializable>
 inline unsigned int AbstractProperty<
 	DataType,
@@ -448,7 +608,10 @@ inline unsigned int AbstractProperty<
 	isFundamental,
 	isSerializable
 >::getSize() const{
-	return data.size();
+	if(memoryMappedFile == nullptr)
+		return data.size();
+	else
+		return memoryMappedSize;
 }
 
 template<typename DataType, bool isFundamental, bool isSerializable>
@@ -457,6 +620,13 @@ inline const std::vector<DataType>& AbstractProperty<
 	isFundamental,
 	isSerializable
 >::getData() const{
+	TBTKAssert(
+		memoryMappedFile == nullptr,
+		"AbstractProperty::getData()",
+		"The data is stored in a memory mapped file.",
+		"Use AbstractProperty::getDataPointer() instead."
+	);
+
 	return data;
 }
 
@@ -466,9 +636,50 @@ inline std::vector<DataType>& AbstractProperty<
 	isFundamental,
 	isSerializable
 >::getDataRW(){
+	TBTKAssert(
+		memoryMappedFile == nullptr,
+		"AbstractProperty::getDataRW()",
+		"The data is stored in a memory mapped file.",
+		"Use AbstractProperty::getDataPointerRW() instead."
+	);
+
 	return data;
 }
 
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline const DataType* AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::getDataPointer() const{
+	if(memoryMappedFile == nullptr)
+		return data.data();
+	else
+		return memoryMappedData;
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline DataType* AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::getDataPointerRW(){
+	if(memoryMappedFile == nullptr){
+		return data.data();
+	}
+	else{
+		TBTKAssert(
+			memoryMappedIsWritable,
+			"AbstractProperty::getDataPointerRW()",
+			"The memory mapped file is opened as read only.",
+			"Use Property::openMemoryMapped() with 'writable = true'"
+			<< " to modify the data."
+		);
+
+		return memoryMappedData;
+	}
+}
+
 template<typename DataType, bool isFundamental, bool isSerializable>
 inline unsigned int AbstractProperty<
 	DataType,
@@ -534,8 +745,10 @@ inline const DataType& AbstractProperty<
 	int indexOffset = getOffset(index);
 	if(indexOffset < 0)
 		return defaultValue;
-	else
+	else if(memoryMappedFile == nullptr)
 		return data[indexOffset + offset];
+	else
+		return memoryMappedData[indexOffset + offset];
 }
 
 template<typename DataType, bool isFundamental, bool isSerializable>
@@ -553,9 +766,20 @@ inline DataType& AbstractProperty<
 		defaultValueNonConst = defaultValue;
 		return defaultValueNonConst;
 	}
-	else{
+	else if(memoryMappedFile == nullptr){
 		return data[indexOffset + offset];
 	}
+	else{
+		TBTKAssert(
+			memoryMappedIsWritable,
+			"AbstractProperty::operator()",
+			"The memory mapped file is opened as read only.",
+			"Use Property::openMemoryMapped() with 'writable = true'"
+			<< " to modify the data."
+		);
+
+		return memoryMappedData[indexOffset + offset];
+	}
 }
 
 template<typename DataType, bool isFundamental, bool isSerializeable>
@@ -600,7 +824,10 @@ inline const DataType& AbstractProperty<
 	isFundamental,
 	isSerializable
 >::operator()(unsigned int offset) const{
-	return data[offset];
+	if(memoryMappedFile == nullptr)
+		return data[offset];
+	else
+		return memoryMappedData[offset];
 }
 
 template<typename DataType, bool isFundamental, bool isSerializable>
@@ -609,7 +836,20 @@ inline DataType& AbstractProperty<
 	isFundamental,
 	isSerializable
 >::operator()(unsigned int offset){
-	return data[offset];
+	if(memoryMappedFile == nullptr){
+		return data[offset];
+	}
+	else{
+		TBTKAssert(
+			memoryMappedIsWritable,
+			"AbstractProperty::operator()",
+			"The memory mapped file is opened as read only.",
+			"Use Property::openMemoryMapped() with 'writable = true'"
+			<< " to modify the data."
+		);
+
+		return memoryMappedData[offset];
+	}
 }
 
 template<typename DataType, bool isFundamental, bool isSerializable>
@@ -630,6 +870,272 @@ inline void AbstractProperty<
 	this->defaultValue = defaultValue;
 }
 
+template<typename DataType, bool isFundamental, bool isSerializable>
+void AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::mapToFile(const std::string &filename){
+	static_assert(
+		!std::is_same<DataType, bool>::value
+		&& std::is_trivially_copyable<DataType>::value,
+		"Memory mapped storage requires a trivially copyable DataType"
+		" other than bool."
+	);
+	TBTKAssert(
+		memoryMappedFile == nullptr,
+		"AbstractProperty::mapToFile()",
+		"The Property is already memory mapped.",
+		""
+	);
+
+	//Serialize the Property without data by temporarily moving the data
+	//out of the Property. serialize() is virtual and therefore includes
+	//the members of the derived Property. The data is moved back before
+	//anything else is done, such that it is not lost if writing the
+	//file fails.
+	std::vector<DataType> buffer;
+	buffer.swap(data);
+	std::string serialization;
+	try{
+		serialization = serialize(Mode::Binary);
+	}
+	catch(...){
+		data.swap(buffer);
+		throw;
+	}
+	data.swap(buffer);
+
+	const uint64_t pageSize = 4096;
+	uint64_t serializationSize = serialization.size();
+	uint64_t dataOffset = memoryMappedLayoutSize + serializationSize;
+	dataOffset = ((dataOffset + pageSize - 1)/pageSize)*pageSize;
+	uint64_t numElements = data.size();
+	uint32_t elementSize = sizeof(DataType);
+	uint32_t byteOrderMark = memoryMappedByteOrderMark;
+
+	MemoryMappedFile *file = new MemoryMappedFile(
+		filename,
+		dataOffset + numElements*sizeof(DataType)
+	);
+	char *memory = file->getDataRW();
+	std::memcpy(memory, memoryMappedIdentifier, 8);
+	std::memcpy(memory + 8, &serializationSize, 8);
+	std::memcpy(memory + 16, &dataOffset, 8);
+	std::memcpy(memory + 24, &numElements, 8);
+	std::memcpy(memory + 32, &elementSize, 4);
+	std::memcpy(memory + 36, &byteOrderMark, 4);
+	std::memcpy(
+		memory + memoryMappedLayoutSize,
+		serialization.data(),
+		serializationSize
+	);
+	std::memcpy(
+		memory + dataOffset,
+		data.data(),
+		numElements*sizeof(DataType)
+	);
+
+	//The data in memory is released first once the file is complete.
+	attachMemoryMappedFile(file);
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline bool AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::getIsMemoryMapped() const{
+	return memoryMappedFile != nullptr;
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline void AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::syncMemoryMappedFile(){
+	if(memoryMappedFile != nullptr)
+		memoryMappedFile->sync();
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+void AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::attachMemoryMappedFile(MemoryMappedFile *memoryMappedFile){
+	static_assert(
+		!std::is_same<DataType, bool>::value
+		&& std::is_trivially_copyable<DataType>::value,
+		"Memory mapped storage requires a trivially copyable DataType"
+		" other than bool."
+	);
+
+	const char *memory = memoryMappedFile->getData();
+	uint64_t dataOffset;
+	uint64_t numElements;
+	uint32_t elementSize;
+	std::memcpy(&dataOffset, memory + 16, 8);
+	std::memcpy(&numElements, memory + 24, 8);
+	std::memcpy(&elementSize, memory + 32, 4);
+	TBTKAssert(
+		elementSize == sizeof(DataType),
+		"AbstractProperty::attachMemoryMappedFile()",
+		"The file '" << memoryMappedFile->getFilename() << "' stores"
+		<< " elements of size " << elementSize << ", but the Property"
+		<< " has elements of size " << sizeof(DataType) << ".",
+		"Make sure the file is opened as the same Property type as it"
+		<< " was written from."
+	);
+	TBTKAssert(
+		numElements == blockSize*indexDescriptor.getSize()
+		&& dataOffset + numElements*elementSize
+			<= memoryMappedFile->getSize(),
+		"AbstractProperty::attachMemoryMappedFile()",
+		"The file '" << memoryMappedFile->getFilename() << "' is"
+		<< " corrupt or truncated.",
+		""
+	);
+
+	detachMemoryMappedFile();
+	data.clear();
+	data.shrink_to_fit();
+	this->memoryMappedFile = memoryMappedFile;
+	memoryMappedIsWritable = (
+		memoryMappedFile->getMode() == MemoryMappedFile::Mode::ReadWrite
+	);
+	if(memoryMappedIsWritable){
+		memoryMappedData = reinterpret_cast<DataType*>(
+			memoryMappedFile->getDataRW() + dataOffset
+		);
+	}
+	else{
+		//The const cast is safe since the non-const accessors assert
+		//that memoryMappedIsWritable is true before the pointer is
+		//handed out.
+		memoryMappedData = reinterpret_cast<DataType*>(
+			const_cast<char*>(memoryMappedFile->getData())
+			+ dataOffset
+		);
+	}
+	memoryMappedSize = numElements;
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline void AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::detachMemoryMappedFile(){
+	if(memoryMappedFile != nullptr){
+		delete memoryMappedFile;
+		memoryMappedFile = nullptr;
+		memoryMappedData = nullptr;
+		memoryMappedSize = 0;
+		memoryMappedIsWritable = false;
+	}
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+std::string AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::readMemoryMappedSerialization(
+	const MemoryMappedFile &memoryMappedFile
+){
+	const char *memory = memoryMappedFile.getData();
+	TBTKAssert(
+		memoryMappedFile.getSize() >= memoryMappedLayoutSize
+		&& std::memcmp(memory, memoryMappedIdentifier, 8) == 0,
+		"AbstractProperty::readMemoryMappedSerialization()",
+		"The file '" << memoryMappedFile.getFilename() << "' is not a"
+		<< " memory mapped Property file.",
+		"The file should be created using"
+		<< " AbstractProperty::mapToFile()."
+	);
+
+	uint64_t serializationSize;
+	uint32_t byteOrderMark;
+	std::memcpy(&serializationSize, memory + 8, 8);
+	std::memcpy(&byteOrderMark, memory + 36, 4);
+	TBTKAssert(
+		byteOrderMark == memoryMappedByteOrderMark,
+		"AbstractProperty::readMemoryMappedSerialization()",
+		"The file '" << memoryMappedFile.getFilename() << "' was"
+		<< " written on a machine with different byte order.",
+		""
+	);
+	TBTKAssert(
+		memoryMappedLayoutSize + serializationSize
+			<= memoryMappedFile.getSize(),
+		"AbstractProperty::readMemoryMappedSerialization()",
+		"The file '" << memoryMappedFile.getFilename() << "' is"
+		<< " corrupt or truncated.",
+		""
+	);
+
+	return std::string(
+		memory + memoryMappedLayoutSize,
+		serializationSize
+	);
+}
+
+template<typename PropertyType>
+PropertyType openMemoryMapped(const std::string &filename, bool writable){
+	MemoryMappedFile *memoryMappedFile = new MemoryMappedFile(
+		filename,
+		writable
+			? MemoryMappedFile::Mode::ReadWrite
+			: MemoryMappedFile::Mode::ReadOnly
+	);
+	PropertyType property(
+		PropertyType::readMemoryMappedSerialization(*memoryMappedFile),
+		Serializable::Mode::Binary
+	);
+	property.attachMemoryMappedFile(memoryMappedFile);
+
+	return property;
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline std::string AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::serializeBinary() const{
+	BinaryWriter writer("AbstractProperty");
+	writer.writeString(
+		"indexDescriptor",
+		indexDescriptor.serialize(Mode::Binary)
+	);
+	writer.write<uint32_t>("blockSize", blockSize);
+	if(memoryMappedFile == nullptr)
+		writer.writeArray("data", data);
+	else
+		writer.writeArray("data", memoryMappedData, memoryMappedSize);
+	writer.write("allowIndexOutOfBoundsAccess", allowIndexOutOfBoundsAccess);
+	writer.write("defaultValue", defaultValue);
+
+	return writer.getSerialization();
+}
+
+template<typename DataType, bool isFundamental, bool isSerializable>
+inline void AbstractProperty<
+	DataType,
+	isFundamental,
+	isSerializable
+>::deserializeBinary(const std::string &serialization){
+	BinaryReader reader(serialization);
+	blockSize = reader.read<uint32_t>("blockSize");
+	data = reader.readArray<DataType>("data");
+	allowIndexOutOfBoundsAccess = reader.read<bool>(
+		"allowIndexOutOfBoundsAccess"
+	);
+	defaultValue = reader.read<DataType>("defaultValue");
+}
+
 template<>
 inline std::string AbstractProperty<
 	bool,
@@ -660,10 +1166,13 @@ inline std::string AbstractProperty<
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -684,18 +1193,22 @@ inline std::string AbstractProperty<
 			indexDescriptor.serialize(mode)
 		);
 		j["blockSize"] = blockSize;
-		for(unsigned int n = 0; n < data.size(); n++)
-			j["data"].push_back(data[n]);
+		const char *dataPointer = getDataPointer();
+		for(unsigned int n = 0; n < getSize(); n++)
+			j["data"].push_back(dataPointer[n]);
 
 		j["allowIndexOutOfBoundsAccess"] = allowIndexOutOfBoundsAccess;
 		j["defaultValue"] = defaultValue;
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -716,18 +1229,22 @@ inline std::string AbstractProperty<
 			indexDescriptor.serialize(mode)
 		);
 		j["blockSize"] = blockSize;
-		for(unsigned int n = 0; n < data.size(); n++)
-			j["data"].push_back(data[n]);
+		const int *dataPointer = getDataPointer();
+		for(unsigned int n = 0; n < getSize(); n++)
+			j["data"].push_back(dataPointer[n]);
 
 		j["allowIndexOutOfBoundsAccess"] = allowIndexOutOfBoundsAccess;
 		j["defaultValue"] = defaultValue;
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -748,18 +1265,22 @@ inline std::string AbstractProperty<
 			indexDescriptor.serialize(mode)
 		);
 		j["blockSize"] = blockSize;
-		for(unsigned int n = 0; n < data.size(); n++)
-			j["data"].push_back(data[n]);
+		const float *dataPointer = getDataPointer();
+		for(unsigned int n = 0; n < getSize(); n++)
+			j["data"].push_back(dataPointer[n]);
 
 		j["allowIndexOutOfBoundsAccess"] = allowIndexOutOfBoundsAccess;
 		j["defaultValue"] = defaultValue;
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -780,18 +1301,22 @@ inline std::string AbstractProperty<
 			indexDescriptor.serialize(mode)
 		);
 		j["blockSize"] = blockSize;
-		for(unsigned int n = 0; n < data.size(); n++)
-			j["data"].push_back(data[n]);
+		const double *dataPointer = getDataPointer();
+		for(unsigned int n = 0; n < getSize(); n++)
+			j["data"].push_back(dataPointer[n]);
 
 		j["allowIndexOutOfBoundsAccess"] = allowIndexOutOfBoundsAccess;
 		j["defaultValue"] = defaultValue;
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -808,8 +1333,12 @@ inline std::string AbstractProperty<std::complex<double>, false, false>::seriali
 			indexDescriptor.serialize(mode)
 		);
 		j["blockSize"] = blockSize;
-		for(unsigned int n = 0; n < data.size(); n++){
-			std::string s = Serializable::serialize(data[n], mode);
+		const std::complex<double> *dataPointer = getDataPointer();
+		for(unsigned int n = 0; n < getSize(); n++){
+			std::string s = Serializable::serialize(
+				dataPointer[n],
+				mode
+			);
 			j["data"].push_back(s);
 		}
 
@@ -818,10 +1347,13 @@ inline std::string AbstractProperty<std::complex<double>, false, false>::seriali
 
 		return j.dump();
 	}
+	case Mode::Binary:
+		return serializeBinary();
 	default:
 		TBTKExit(
 			"AbstractProperty<DataType>::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -1010,7 +1542,16 @@ AbstractProperty<
 {
 	blockSize = abstractProperty.blockSize;
 
-	data = abstractProperty.data;
+	if(abstractProperty.memoryMappedFile == nullptr){
+		data = abstractProperty.data;
+	}
+	else{
+		data.assign(
+			abstractProperty.memoryMappedData,
+			abstractProperty.memoryMappedData
+				+ abstractProperty.memoryMappedSize
+		);
+	}
 
 	allowIndexOutOfBoundsAccess
 		= abstractProperty.allowIndexOutOfBoundsAccess;
@@ -1030,6 +1571,15 @@ AbstractProperty<
 
 	data = abstractProperty.data;
 
+	memoryMappedFile = abstractProperty.memoryMappedFile;
+	memoryMappedData = abstractProperty.memoryMappedData;
+	memoryMappedSize = abstractProperty.memoryMappedSize;
+	memoryMappedIsWritable = abstractProperty.memoryMappedIsWritable;
+	abstractProperty.memoryMappedFile = nullptr;
+	abstractProperty.memoryMappedData = nullptr;
+	abstractProperty.memoryMappedSize = 0;
+	abstractProperty.memoryMappedIsWritable = false;
+
 	allowIndexOutOfBoundsAccess
 		= abstractProperty.allowIndexOutOfBoundsAccess;
 }
@@ -1080,11 +1630,16 @@ inline AbstractProperty<int, true, false>::AbstractProperty(
 			);
 		}
 
+		break;
+	case Mode::Binary:
+		deserializeBinary(serialization);
+
 		break;
 	default:
 		TBTKExit(
 			"AbstractProperty::AbstractProperty()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -1136,11 +1691,16 @@ inline AbstractProperty<double, true, false>::AbstractProperty(
 			);
 		}
 
+		break;
+	case Mode::Binary:
+		deserializeBinary(serialization);
+
 		break;
 	default:
 		TBTKExit(
 			"AbstractProperty::AbstractProperty()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -1198,11 +1758,16 @@ inline AbstractProperty<std::complex<double>, false, false>::AbstractProperty(
 			);
 		}
 
+		break;
+	case Mode::Binary:
+		deserializeBinary(serialization);
+
 		break;
 	default:
 		TBTKExit(
 			"AbstractProperty::AbstractProperty()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -1227,6 +1792,7 @@ inline AbstractProperty<
 	isFundamental,
 	isSerializable
 >::~AbstractProperty(){
+	detachMemoryMappedFile();
 }
 
 template<typename DataType, bool isFundamental, bool isSerializable>
@@ -1246,7 +1812,16 @@ AbstractProperty<
 
 		blockSize = rhs.blockSize;
 
-		data = rhs.data;
+		detachMemoryMappedFile();
+		if(rhs.memoryMappedFile == nullptr){
+			data = rhs.data;
+		}
+		else{
+			data.assign(
+				rhs.memoryMappedData,
+				rhs.memoryMappedData + rhs.memoryMappedSize
+			);
+		}
 
 		allowIndexOutOfBoundsAccess = rhs.allowIndexOutOfBoundsAccess;
 	}
@@ -1273,6 +1848,16 @@ AbstractProperty<
 
 		data = rhs.data;
 
+		detachMemoryMappedFile();
+		memoryMappedFile = rhs.memoryMappedFile;
+		memoryMappedData = rhs.memoryMappedData;
+		memoryMappedSize = rhs.memoryMappedSize;
+		memoryMappedIsWritable = rhs.memoryMappedIsWritable;
+		rhs.memoryMappedFile = nullptr;
+		rhs.memoryMappedData = nullptr;
+		rhs.memoryMappedSize = 0;
+		rhs.memoryMappedIsWritable = false;
+
 		allowIndexOutOfBoundsAccess = rhs.allowIndexOutOfBoundsAccess;
 	}
 
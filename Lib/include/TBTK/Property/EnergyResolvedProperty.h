@@ -120,6 +120,87 @@ public:
 		const DataType *data
 	);
 
+	/** Constructs an EnergyResolvedProperty with real energies on a
+	 *  non-uniform mesh on the Custom format. [See AbstractProperty for
+	 *  detailed information about the Custom format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the EnergyResolvedProperty should be contained.
+	 *
+	 *  @param energies Strictly increasing energies. */
+	EnergyResolvedProperty(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies
+	);
+
+	/** Constructs an EnergyResolvedProperty with real energies on a
+	 *  non-uniform mesh on the Custom format and initializes it with
+	 *  data. [See AbstractProperty for detailed information about the
+	 *  Custom format and the raw data format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the EnergyResolvedProperty should be contained.
+	 *
+	 *  @param energies Strictly increasing energies.
+	 *  @param data Raw data to initialize the EnergyResolvedProperty with.
+	 */
+	EnergyResolvedProperty(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies,
+		const DataType *data
+	);
+
+	/** Constructs an EnergyResolvedProperty with a sparse set of
+	 *  Matsubara energies on the Custom format. [See AbstractProperty for
+	 *  detailed information about the Custom format.]
+	 *
+	 *  @param energyType EnergyType::FermionicMatsubara or
+	 *  EnergyType::BosonicMatsubara.
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the EnergyResolvedProperty should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing Matsubara energy
+	 *  indices. All indices must be odd for fermionic and even for bosonic
+	 *  Matsubara energies.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0. */
+	EnergyResolvedProperty(
+		EnergyType energyType,
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy
+	);
+
+	/** Constructs an EnergyResolvedProperty with a sparse set of
+	 *  Matsubara energies on the Custom format and initializes it with
+	 *  data. [See AbstractProperty for detailed information about the
+	 *  Custom format and the raw data format.]
+	 *
+	 *  @param energyType EnergyType::FermionicMatsubara or
+	 *  EnergyType::BosonicMatsubara.
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the EnergyResolvedProperty should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing Matsubara energy
+	 *  indices. All indices must be odd for fermionic and even for bosonic
+	 *  Matsubara energies.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0.
+	 *
+	 *  @param data Raw data to initialize the EnergyResolvedProperty with.
+	 */
+	EnergyResolvedProperty(
+		EnergyType energyType,
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy,
+		const DataType *data
+	);
+
 	/** Constructor. Constructs the EnergyResolvedProperty from a
 	 *  serialization string.
 	 *
@@ -158,6 +239,20 @@ public:
 	 *  @return The energy for the nth energy index. */
 	double getEnergy(unsigned int n) const;
 
+	/** Get all energies.
+	 *
+	 *  @return The real energies. */
+	std::vector<double> getEnergies() const;
+
+	/** Check whether the energies are uniformly spaced. For Matsubara
+	 *  energies, this means that every Matsubara energy between the
+	 *  lowest and the highest is included.
+	 *
+	 *  @return True if the energies are uniformly spaced, false if they
+	 *  have been given explicitly as a non-uniform mesh or a sparse set of
+	 *  Matsubara energies. */
+	bool isUniform() const;
+
 	/** Get the lower Matsubara energy index. That is, l in the expression
 	 *  E = (l + 2*n)*E_0.
 	 *
@@ -193,12 +288,46 @@ public:
 	/** Get the nth Matsubara energy. */
 	std::complex<double> getMatsubaraEnergy(unsigned int n) const;
 
+	/** Get the Matsubara energy index m of the nth Matsubara energy
+	 *  E = m*E_0.
+	 *
+	 *  @param n The energy index to get the Matsubara energy index for.
+	 *
+	 *  @return The Matsubara energy index. */
+	int getMatsubaraEnergyIndex(unsigned int n) const;
+
+	/** Get all Matsubara energy indices.
+	 *
+	 *  @return The Matsubara energy indices. */
+	std::vector<int> getMatsubaraEnergyIndices() const;
+
+	/** Get the weight with which the nth Matsubara energy enters a sum
+	 *  over all Matsubara energies between the lowest and the highest
+	 *  Matsubara energy. The weight is the number of Matsubara energies
+	 *  that the nth Matsubara energy represents when the summand is
+	 *  linearly interpolated between the included Matsubara energies, and
+	 *  is one for every Matsubara energy if the Matsubara energies are
+	 *  uniform.
+	 *
+	 *  @param n The energy index to get the weight for.
+	 *
+	 *  @return The summation weight. */
+	double getMatsubaraSummationWeight(unsigned int n) const;
+
 	/** Overrides AbstractProperty::serialize(). */
 	virtual std::string serialize(Serializable::Mode mode) const;
 private:
 	/** The energy type for the property. */
 	EnergyType energyType;
 
+	/** Real energies for non-uniform meshes. Empty if the energies are
+	 *  uniform. */
+	std::vector<double> energies;
+
+	/** Matsubara energy indices for sparse sets of Matsubara energies.
+	 *  Empty if the Matsubara energies are uniform. */
+	std::vector<int> matsubaraEnergyIndices;
+
 	class RealEnergy{
 	public:
 		/** Lower bound for the energy. */
@@ -231,6 +360,17 @@ private:
 
 	/** The actual energy descriptor. */
 	EnergyDescriptor descriptor;
+
+	/** Validate and set the energies of a non-uniform real mesh. */
+	void setEnergies(const std::vector<double> &energies);
+
+	/** Validate and set the Matsubara energy indices of a sparse set of
+	 *  Matsubara energies. */
+	void setMatsubaraEnergyIndices(
+		EnergyType energyType,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy
+	);
 };
 
 template<typename DataType>
@@ -493,6 +633,64 @@ EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 	}
 }
 
+template<typename DataType>
+EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
+	const IndexTree &indexTree,
+	const std::vector<double> &energies
+) :
+	AbstractProperty<DataType>(indexTree, energies.size())
+{
+	setEnergies(energies);
+}
+
+template<typename DataType>
+EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
+	const IndexTree &indexTree,
+	const std::vector<double> &energies,
+	const DataType *data
+) :
+	AbstractProperty<DataType>(indexTree, energies.size(), data)
+{
+	setEnergies(energies);
+}
+
+template<typename DataType>
+EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
+	EnergyType energyType,
+	const IndexTree &indexTree,
+	const std::vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy
+) :
+	AbstractProperty<DataType>(indexTree, matsubaraEnergyIndices.size())
+{
+	setMatsubaraEnergyIndices(
+		energyType,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy
+	);
+}
+
+template<typename DataType>
+EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
+	EnergyType energyType,
+	const IndexTree &indexTree,
+	const std::vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy,
+	const DataType *data
+) :
+	AbstractProperty<DataType>(
+		indexTree,
+		matsubaraEnergyIndices.size(),
+		data
+	)
+{
+	setMatsubaraEnergyIndices(
+		energyType,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy
+	);
+}
+
 template<typename DataType>
 EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 	const std::string &serialization,
@@ -528,6 +726,11 @@ EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 					= j.at("upperBound").get<double>();
 				descriptor.realEnergy.resolution
 					= j.at("resolution").get<double>();
+				if(j.find("energies") != j.end()){
+					energies = j.at("energies").get<
+						std::vector<double>
+					>();
+				}
 			}
 			else if(et.compare("FermionicMatsubara") == 0){
 				energyType = EnergyType::FermionicMatsubara;
@@ -537,6 +740,11 @@ EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 					= j.at("numMatsubaraEnergies");
 				descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
 					= j.at("fundamentalMatsubaraEnergy");
+				if(j.find("matsubaraEnergyIndices") != j.end()){
+					matsubaraEnergyIndices = j.at(
+						"matsubaraEnergyIndices"
+					).get<std::vector<int>>();
+				}
 			}
 			else if(et.compare("BosonicMatsubara") == 0){
 				energyType = EnergyType::BosonicMatsubara;
@@ -546,6 +754,11 @@ EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 					= j.at("numMatsubaraEnergies");
 				descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
 					= j.at("fundamentalMatsubaraEnergy");
+				if(j.find("matsubaraEnergyIndices") != j.end()){
+					matsubaraEnergyIndices = j.at(
+						"matsubaraEnergyIndices"
+					).get<std::vector<int>>();
+				}
 			}
 		}
 		catch(nlohmann::json::exception e){
@@ -559,10 +772,62 @@ EnergyResolvedProperty<DataType>::EnergyResolvedProperty(
 		}
 
 		break;
+	case Serializable::Mode::Binary:
+	{
+		Serializable::BinaryReader reader(serialization);
+		int et = reader.read<int32_t>("energyType");
+		switch(et){
+		case static_cast<int>(EnergyType::Real):
+			energyType = EnergyType::Real;
+			descriptor.realEnergy.lowerBound
+				= reader.read<double>("lowerBound");
+			descriptor.realEnergy.upperBound
+				= reader.read<double>("upperBound");
+			descriptor.realEnergy.resolution
+				= reader.read<uint32_t>("resolution");
+			if(reader.hasField("energies"))
+				energies = reader.readArray<double>("energies");
+
+			break;
+		case static_cast<int>(EnergyType::FermionicMatsubara):
+		case static_cast<int>(EnergyType::BosonicMatsubara):
+			if(et == static_cast<int>(EnergyType::FermionicMatsubara))
+				energyType = EnergyType::FermionicMatsubara;
+			else
+				energyType = EnergyType::BosonicMatsubara;
+			descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex
+				= reader.read<int32_t>("lowerMatsubaraEnergyIndex");
+			descriptor.matsubaraEnergy.numMatsubaraEnergies
+				= reader.read<int32_t>("numMatsubaraEnergies");
+			descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
+				= reader.read<double>(
+					"fundamentalMatsubaraEnergy"
+				);
+			if(reader.hasField("matsubaraEnergyIndices")){
+				matsubaraEnergyIndices = reader.readArray<int32_t>(
+					"matsubaraEnergyIndices"
+				);
+			}
+
+			break;
+		default:
+			TBTKExit(
+				"Property::EnergyResolvedProperty::EnergyResolvedProperty()",
+				"Unknown EnergyType '" << et << "'.",
+				"The serialization string is either corrupted"
+				<< " or the serialization was created with a"
+				<< " newer version of TBTK that supports more"
+				<< " energy types."
+			);
+		}
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"Property::EnergyResolvedProperty::EnergyResolvedProperty()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -621,6 +886,9 @@ inline double EnergyResolvedProperty<DataType>::getEnergy(
 		""
 	);
 
+	if(energies.size() != 0)
+		return energies[n];
+
 	double dE;
 	if(descriptor.realEnergy.resolution == 1)
 		dE = 0;
@@ -633,6 +901,43 @@ inline double EnergyResolvedProperty<DataType>::getEnergy(
 	return descriptor.realEnergy.lowerBound + ((int)n)*dE;
 }
 
+template<typename DataType>
+std::vector<double> EnergyResolvedProperty<DataType>::getEnergies() const{
+	TBTKAssert(
+		energyType == EnergyType::Real,
+		"EnergyResolvedProperty::getEnergies()",
+		"The Property is not of the type EnergyType::Real.",
+		""
+	);
+
+	if(energies.size() != 0)
+		return energies;
+
+	std::vector<double> result;
+	result.reserve(descriptor.realEnergy.resolution);
+	for(unsigned int n = 0; n < descriptor.realEnergy.resolution; n++)
+		result.push_back(getEnergy(n));
+
+	return result;
+}
+
+template<typename DataType>
+inline bool EnergyResolvedProperty<DataType>::isUniform() const{
+	switch(energyType){
+	case EnergyType::Real:
+		return energies.size() == 0;
+	case EnergyType::FermionicMatsubara:
+	case EnergyType::BosonicMatsubara:
+		return matsubaraEnergyIndices.size() == 0;
+	default:
+		TBTKExit(
+			"Property::EnergyResolvedProperty::isUniform()",
+			"Unknown EnergyType.",
+			"This should never happen, contact the developer."
+		);
+	}
+}
+
 template<typename DataType>
 inline int EnergyResolvedProperty<DataType>::getLowerMatsubaraEnergyIndex(
 ) const{
@@ -662,6 +967,9 @@ inline int EnergyResolvedProperty<DataType>::getUpperMatsubaraEnergyIndex(
 		""
 	);
 
+	if(matsubaraEnergyIndices.size() != 0)
+		return matsubaraEnergyIndices.back();
+
 	return descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex
 	 + 2*(descriptor.matsubaraEnergy.numMatsubaraEnergies - 1);
 }
@@ -728,10 +1036,8 @@ inline double EnergyResolvedProperty<DataType>::getUpperMatsubaraEnergy(
 		""
 	);
 
-	return (
-			descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex
-			+ 2*(descriptor.matsubaraEnergy.numMatsubaraEnergies-1)
-		)*descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy;
+	return getUpperMatsubaraEnergyIndex()
+		*descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy;
 }
 
 template<typename DataType>
@@ -752,11 +1058,97 @@ inline std::complex<double> EnergyResolvedProperty<
 
 	return std::complex<double>(
 		0,
-		(descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex + 2*(int)n)
+		getMatsubaraEnergyIndex(n)
 		*descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
 	);
 }
 
+template<typename DataType>
+inline int EnergyResolvedProperty<DataType>::getMatsubaraEnergyIndex(
+	unsigned int n
+) const{
+	TBTKAssert(
+		energyType == EnergyType::FermionicMatsubara
+		|| energyType == EnergyType::BosonicMatsubara,
+		"EnergyResolvedProperty::getMatsubaraEnergyIndex()",
+		"The Property is not of the type"
+		<< " EnergyType::FermionicMatsubara or"
+		<< " EnergyType::BosonicMatsubara.",
+		""
+	);
+
+	if(matsubaraEnergyIndices.size() != 0)
+		return matsubaraEnergyIndices[n];
+
+	return descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex + 2*(int)n;
+}
+
+template<typename DataType>
+std::vector<int> EnergyResolvedProperty<
+	DataType
+>::getMatsubaraEnergyIndices() const{
+	TBTKAssert(
+		energyType == EnergyType::FermionicMatsubara
+		|| energyType == EnergyType::BosonicMatsubara,
+		"EnergyResolvedProperty::getMatsubaraEnergyIndices()",
+		"The Property is not of the type"
+		<< " EnergyType::FermionicMatsubara or"
+		<< " EnergyType::BosonicMatsubara.",
+		""
+	);
+
+	if(matsubaraEnergyIndices.size() != 0)
+		return matsubaraEnergyIndices;
+
+	std::vector<int> result;
+	result.reserve(descriptor.matsubaraEnergy.numMatsubaraEnergies);
+	for(
+		int n = 0;
+		n < descriptor.matsubaraEnergy.numMatsubaraEnergies;
+		n++
+	){
+		result.push_back(getMatsubaraEnergyIndex(n));
+	}
+
+	return result;
+}
+
+template<typename DataType>
+inline double EnergyResolvedProperty<
+	DataType
+>::getMatsubaraSummationWeight(
+	unsigned int n
+) const{
+	TBTKAssert(
+		energyType == EnergyType::FermionicMatsubara
+		|| energyType == EnergyType::BosonicMatsubara,
+		"EnergyResolvedProperty::getMatsubaraSummationWeight()",
+		"The Property is not of the type"
+		<< " EnergyType::FermionicMatsubara or"
+		<< " EnergyType::BosonicMatsubara.",
+		""
+	);
+
+	if(matsubaraEnergyIndices.size() < 2)
+		return 1.;
+
+	//Trapezoidal weights in the Matsubara energy index, where
+	//consecutive Matsubara energies are separated by two. The end points
+	//additionally carry half of their own Matsubara energy.
+	const std::vector<int> &m = matsubaraEnergyIndices;
+	double weight = 0;
+	if(n == 0)
+		weight += 1/2.;
+	else
+		weight += (m[n] - m[n-1])/4.;
+	if(n == m.size() - 1)
+		weight += 1/2.;
+	else
+		weight += (m[n+1] - m[n])/4.;
+
+	return weight;
+}
+
 template<typename DataType>
 inline std::string EnergyResolvedProperty<DataType>::serialize(Serializable::Mode mode) const{
 	switch(mode){
@@ -770,6 +1162,8 @@ inline std::string EnergyResolvedProperty<DataType>::serialize(Serializable::Mod
 			j["lowerBound"] = descriptor.realEnergy.lowerBound;
 			j["upperBound"] = descriptor.realEnergy.upperBound;
 			j["resolution"] = descriptor.realEnergy.resolution;
+			if(energies.size() != 0)
+				j["energies"] = energies;
 
 			break;
 		case EnergyType::FermionicMatsubara:
@@ -780,6 +1174,10 @@ inline std::string EnergyResolvedProperty<DataType>::serialize(Serializable::Mod
 				= descriptor.matsubaraEnergy.numMatsubaraEnergies;
 			j["fundamentalMatsubaraEnergy"]
 				= descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy;
+			if(matsubaraEnergyIndices.size() != 0){
+				j["matsubaraEnergyIndices"]
+					= matsubaraEnergyIndices;
+			}
 
 			break;
 		case EnergyType::BosonicMatsubara:
@@ -790,6 +1188,10 @@ inline std::string EnergyResolvedProperty<DataType>::serialize(Serializable::Mod
 				= descriptor.matsubaraEnergy.numMatsubaraEnergies;
 			j["fundamentalMatsubaraEnergy"]
 				= descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy;
+			if(matsubaraEnergyIndices.size() != 0){
+				j["matsubaraEnergyIndices"]
+					= matsubaraEnergyIndices;
+			}
 
 			break;
 		default:
@@ -805,13 +1207,176 @@ inline std::string EnergyResolvedProperty<DataType>::serialize(Serializable::Mod
 
 		return j.dump();
 	}
+	case Serializable::Mode::Binary:
+	{
+		Serializable::BinaryWriter writer("EnergyResolvedProperty");
+		writer.write(
+			"energyType",
+			static_cast<int32_t>(energyType)
+		);
+		switch(energyType){
+		case EnergyType::Real:
+			writer.write(
+				"lowerBound",
+				descriptor.realEnergy.lowerBound
+			);
+			writer.write(
+				"upperBound",
+				descriptor.realEnergy.upperBound
+			);
+			writer.write<uint32_t>(
+				"resolution",
+				descriptor.realEnergy.resolution
+			);
+			if(energies.size() != 0)
+				writer.writeArray("energies", energies);
+
+			break;
+		case EnergyType::FermionicMatsubara:
+		case EnergyType::BosonicMatsubara:
+			writer.write<int32_t>(
+				"lowerMatsubaraEnergyIndex",
+				descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex
+			);
+			writer.write<int32_t>(
+				"numMatsubaraEnergies",
+				descriptor.matsubaraEnergy.numMatsubaraEnergies
+			);
+			writer.write(
+				"fundamentalMatsubaraEnergy",
+				descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
+			);
+			if(matsubaraEnergyIndices.size() != 0){
+				writer.writeArray<int32_t>(
+					"matsubaraEnergyIndices",
+					matsubaraEnergyIndices
+				);
+			}
+
+			break;
+		default:
+			TBTKExit(
+				"Property::EnergyResolvedProperty::serialize()",
+				"Unknown EnergyType.",
+				"This should never happen, contact the developer."
+			);
+		}
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty<DataType>::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Property::EnergyResolvedProperty::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
+			""
+		);
+	}
+}
+
+template<typename DataType>
+void EnergyResolvedProperty<DataType>::setEnergies(
+	const std::vector<double> &energies
+){
+	TBTKAssert(
+		energies.size() > 0,
+		"EnergyResolvedProperty::EnergyResolvedProperty()",
+		"The 'energies' must contain at least one energy.",
+		""
+	);
+	for(unsigned int n = 1; n < energies.size(); n++){
+		TBTKAssert(
+			energies[n-1] < energies[n],
+			"EnergyResolvedProperty::EnergyResolvedProperty()",
+			"The 'energies' must be strictly increasing, but"
+			<< " 'energies[" << n-1 << "]=" << energies[n-1] << "'"
+			<< " and 'energies[" << n << "]=" << energies[n]
+			<< "'.",
+			""
+		);
+	}
+
+	energyType = EnergyType::Real;
+	this->energies = energies;
+	descriptor.realEnergy.lowerBound = energies.front();
+	descriptor.realEnergy.upperBound = energies.back();
+	descriptor.realEnergy.resolution = energies.size();
+}
+
+template<typename DataType>
+void EnergyResolvedProperty<DataType>::setMatsubaraEnergyIndices(
+	EnergyType energyType,
+	const std::vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy
+){
+	TBTKAssert(
+		matsubaraEnergyIndices.size() > 0,
+		"EnergyResolvedProperty::EnergyResolvedProperty()",
+		"The 'matsubaraEnergyIndices' must contain at least one"
+		<< " index.",
+		""
+	);
+	TBTKAssert(
+		fundamentalMatsubaraEnergy > 0,
+		"EnergyResolvedProperty::EnergyResolvedProperty()",
+		"The 'fundamentalMatsubaraEnergy' must be larger than 0.",
+		""
+	);
+
+	int parity;
+	switch(energyType){
+	case EnergyType::FermionicMatsubara:
+		parity = 1;
+		break;
+	case EnergyType::BosonicMatsubara:
+		parity = 0;
+		break;
+	default:
+		TBTKExit(
+			"EnergyResolvedProperty::EnergyResolvedProperty()",
+			"The 'energyType' must be"
+			" EnergyType::FermionicMatsubara or"
+			" EnergyType::BosonicMatsubara.",
+			""
+		);
+	}
+
+	for(unsigned int n = 0; n < matsubaraEnergyIndices.size(); n++){
+		TBTKAssert(
+			abs(matsubaraEnergyIndices[n]%2) == parity,
+			"EnergyResolvedProperty::EnergyResolvedProperty()",
+			"The Matsubara energy index '"
+			<< matsubaraEnergyIndices[n] << "' must be "
+			<< (parity == 1 ? "odd" : "even") << " for"
+			<< (parity == 1
+				? " EnergyType::FermionicMatsubara."
+				: " EnergyType::BosonicMatsubara."
+			),
+			""
+		);
+		TBTKAssert(
+			n == 0
+			|| matsubaraEnergyIndices[n-1]
+				< matsubaraEnergyIndices[n],
+			"EnergyResolvedProperty::EnergyResolvedProperty()",
+			"The 'matsubaraEnergyIndices' must be strictly"
+			<< " increasing.",
 			""
 		);
 	}
+
+	this->energyType = energyType;
+	this->matsubaraEnergyIndices = matsubaraEnergyIndices;
+	descriptor.matsubaraEnergy.lowerMatsubaraEnergyIndex
+		= matsubaraEnergyIndices.front();
+	descriptor.matsubaraEnergy.numMatsubaraEnergies
+		= matsubaraEnergyIndices.size();
+	descriptor.matsubaraEnergy.fundamentalMatsubaraEnergy
+		= fundamentalMatsubaraEnergy;
 }
 
 };	//End namespace Property
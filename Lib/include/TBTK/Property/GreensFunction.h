@@ -116,10 +116,22 @@ public:
 		const std::complex<double> *data
 	);
 
+	/** Constructor. Constructs the GreensFunction from a serialization
+	 *  string.
+	 *
+	 *  @param serialization Serialization string from which to construct
+	 *  the GreensFunction.
+	 *
+	 *  @param mode Mode with which the string has been serialized. */
+	GreensFunction(const std::string &serialization, Mode mode);
+
 	/** Get the Green's function type.
 	 *
 	 *  @return The Green's function type. */
 	Type getType() const;
+
+	/** Overrides EnergyResolvedProperty::serialize(). */
+	std::string serialize(Mode mode) const;
 private:
 	/** The Green's function type. */
 	Type type;
@@ -111,6 +111,75 @@ public:
 		double fundamentalMatsubaraEnergy,
 		const std::complex<double> *data
 	);
+
+	/** Constructs an InteractionVertex with real energies on a non-uniform mesh on
+	 *  the Custom format. [See AbstractProperty for detailed information
+	 *  about the Custom format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the InteractionVertex should be contained.
+	 *
+	 *  @param energies Strictly increasing energies. */
+	InteractionVertex(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies
+	);
+
+	/** Constructs an InteractionVertex with real energies on a non-uniform mesh on
+	 *  the Custom format and initializes it with data. [See
+	 *  AbstractProperty for detailed information about the Custom format
+	 *  and the raw data format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the InteractionVertex should be contained.
+	 *
+	 *  @param energies Strictly increasing energies.
+	 *  @param data Raw data to initialize the InteractionVertex with. */
+	InteractionVertex(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies,
+		const std::complex<double> *data
+	);
+
+	/** Constructs an InteractionVertex with a sparse set of bosonic Matsubara
+	 *  energies on the Custom format. [See AbstractProperty for detailed
+	 *  information about the Custom format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the InteractionVertex should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing even Matsubara
+	 *  energy indices.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0. */
+	InteractionVertex(
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy
+	);
+
+	/** Constructs an InteractionVertex with a sparse set of bosonic Matsubara
+	 *  energies on the Custom format and initializes it with data. [See
+	 *  AbstractProperty for detailed information about the Custom format
+	 *  and the raw data format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the InteractionVertex should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing even Matsubara
+	 *  energy indices.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0.
+	 *
+	 *  @param data Raw data to initialize the InteractionVertex with. */
+	InteractionVertex(
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy,
+		const std::complex<double> *data
+	);
 private:
 };
 
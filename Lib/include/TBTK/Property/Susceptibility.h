@@ -111,6 +111,75 @@ public:
 		const std::complex<double> *data
 	);
 
+	/** Constructs a Susceptibility with real energies on a non-uniform mesh on
+	 *  the Custom format. [See AbstractProperty for detailed information
+	 *  about the Custom format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the Susceptibility should be contained.
+	 *
+	 *  @param energies Strictly increasing energies. */
+	Susceptibility(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies
+	);
+
+	/** Constructs a Susceptibility with real energies on a non-uniform mesh on
+	 *  the Custom format and initializes it with data. [See
+	 *  AbstractProperty for detailed information about the Custom format
+	 *  and the raw data format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the Susceptibility should be contained.
+	 *
+	 *  @param energies Strictly increasing energies.
+	 *  @param data Raw data to initialize the Susceptibility with. */
+	Susceptibility(
+		const IndexTree &indexTree,
+		const std::vector<double> &energies,
+		const std::complex<double> *data
+	);
+
+	/** Constructs a Susceptibility with a sparse set of bosonic Matsubara
+	 *  energies on the Custom format. [See AbstractProperty for detailed
+	 *  information about the Custom format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the Susceptibility should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing even Matsubara
+	 *  energy indices.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0. */
+	Susceptibility(
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy
+	);
+
+	/** Constructs a Susceptibility with a sparse set of bosonic Matsubara
+	 *  energies on the Custom format and initializes it with data. [See
+	 *  AbstractProperty for detailed information about the Custom format
+	 *  and the raw data format.]
+	 *
+	 *  @param indexTree IndexTree containing the @link Index Indices
+	 *  @endlink for which the Susceptibility should be contained.
+	 *
+	 *  @param matsubaraEnergyIndices Strictly increasing even Matsubara
+	 *  energy indices.
+	 *
+	 *  @param fundamentalMatsubaraEnergy The energy E_0 in the expression
+	 *  E = m*E_0.
+	 *
+	 *  @param data Raw data to initialize the Susceptibility with. */
+	Susceptibility(
+		const IndexTree &indexTree,
+		const std::vector<int> &matsubaraEnergyIndices,
+		double fundamentalMatsubaraEnergy,
+		const std::complex<double> *data
+	);
+
 	/** Constructor. Constructs the Susceptibility from a serialization
 	 *  string.
 	 *
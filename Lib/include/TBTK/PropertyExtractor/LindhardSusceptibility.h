@@ -60,6 +60,23 @@ public:
 		int upperBosonicMatsubaraEnergyIndex
 	);
 
+	/** Set the energies to calculate the Susceptibility for to a
+	 *  non-uniform mesh of real energies. Replaces any previously set
+	 *  energy window.
+	 *
+	 *  @param energies Strictly increasing energies. */
+	void setEnergies(const std::vector<double> &energies);
+
+	/** Set the energies to calculate the Susceptibility for to a sparse
+	 *  set of bosonic Matsubara energies. Replaces any previously set
+	 *  energy window.
+	 *
+	 *  @param bosonicMatsubaraEnergyIndices Strictly increasing even
+	 *  Matsubara energy indices. */
+	void setBosonicMatsubaraEnergyIndices(
+		const std::vector<int> &bosonicMatsubaraEnergyIndices
+	);
+
 	/** Calculates the Susceptibility. */
 	virtual Property::Susceptibility calculateSusceptibility(
 //		std::initializer_list<Index> patterns
@@ -89,6 +106,15 @@ private:
 	int upperFermionicMatsubaraEnergyIndex;
 	int lowerBosonicMatsubaraEnergyIndex;
 	int upperBosonicMatsubaraEnergyIndex;
+
+	/** Energies set through setEnergies(). Empty if the energies are
+	 *  uniform. */
+	std::vector<double> nonUniformEnergies;
+
+	/** Matsubara energy indices set through
+	 *  setBosonicMatsubaraEnergyIndices(). Empty if the Matsubara energies
+	 *  are uniform. */
+	std::vector<int> sparseBosonicMatsubaraEnergyIndices;
 };
 
 };	//End of namespace PropertyExtractor
@@ -28,6 +28,7 @@
 #include "TBTK/Solver/Solver.h"
 
 #include <complex>
+#include <vector>
 
 namespace TBTK{
 namespace Solver{
@@ -131,6 +132,46 @@ public:
 	/** Run the implicitly restarted Arnoldi algorithm. */
 	void run();
 
+	/** Calculate the eigenvalues in the interval [lowerBound, upperBound]
+	 *  using spectrum slicing. The interval is partitioned into numSlices
+	 *  slices of equal width and a shift-and-invert calculation is
+	 *  performed with the central value in the middle of each slice,
+	 *  using the current number of eigenvalues, Lanczos vectors,
+	 *  tolerance, and maximum number of iterations for every slice. The
+	 *  slices are distributed over the available threads and each thread
+	 *  reuses the column permutation of its LUSolver between its
+	 *  slices, since the sparsity pattern of \f$H - \sigma I\f$ does not
+	 *  depend on \f$\sigma\f$. Eigenvalues that fall inside a slice are
+	 *  kept, and eigenpairs that are found by two neighboring slices close
+	 *  to their common boundary are removed using the overlap between the
+	 *  eigenvectors. The result is stored in ascending order just like
+	 *  after a call to run(), with getNumCalculatedEigenValues() returning
+	 *  the total number of eigenvalues in the interval. A warning is
+	 *  printed if the eigenvalues found in a slice do not reach its
+	 *  boundaries, in which case the number of eigenvalues per slice
+	 *  should be increased.
+	 *  <br/><br/>
+	 *  <b>Note:</b> ARPACK is not reentrant and the Arnoldi iterations of
+	 *  different slices are therefore serialized. The LU factorizations,
+	 *  which dominate the cost for large models, are performed
+	 *  concurrently.
+	 *
+	 *  @param lowerBound The lower bound of the energy interval.
+	 *  @param upperBound The upper bound of the energy interval.
+	 *  @param numSlices The number of slices to partition the interval
+	 *  into. */
+	void runSpectrumSlicing(
+		double lowerBound,
+		double upperBound,
+		int numSlices
+	);
+
+	/** Get the number of eigenvalues that were calculated in the last
+	 *  call to run() or runSpectrumSlicing().
+	 *
+	 *  @return The number of calculated eigenvalues. */
+	int getNumCalculatedEigenValues() const;
+
 	/** Get eigenValues. */
 	const std::complex<double>* getEigenValues() const;
 
@@ -149,6 +190,10 @@ private:
 	/** Number of eigenvalues to calculate (Arnoldi variable). */
 	int numEigenValues;
 
+	/** Number of eigenvalues that were calculated in the last run. Differs
+	 *  from numEigenValues after spectrum slicing. */
+	int numCalculatedEigenValues;
+
 	/** Flag indicating whether eigenvectors should be calculated. (Arnoldi
 	 *  variable). */
 	bool calculateEigenVectors;
@@ -192,6 +237,19 @@ private:
 	/** Run implicitly restarted Arnoldi loop. */
 	void arnoldiLoop();
 
+	/** Merge the eigenpairs calculated for the individual slices in
+	 *  runSpectrumSlicing() into eigenValues and eigenVectors.
+	 *
+	 *  @param sliceEigenValues The eigenvalues inside each slice.
+	 *  @param sliceEigenVectors The corresponding eigenvectors.
+	 *  @param margin Eigenvalues closer than margin to each other but
+	 *  belonging to different slices are checked for duplicates. */
+	void mergeSlices(
+		const std::vector<std::vector<std::complex<double>>> &sliceEigenValues,
+		const std::vector<std::vector<std::complex<double>>> &sliceEigenVectors,
+		double margin
+	);
+
 	/** Check znaupd info for errors. */
 	void checkZnaupdInfo(int info) const;
 
@@ -200,8 +258,7 @@ private:
 		int ido,
 		int basisSize,
 		double *workd,
-		int *ipntr,
-		Matrix<double> &b
+		int *ipntr
 	);
 
 	/** Execute reverse communication message. */
@@ -209,8 +266,7 @@ private:
 		int ido,
 		int basisSize,
 		std::complex<double> *workd,
-		int *ipntr,
-		Matrix<std::complex<double>> &b
+		int *ipntr
 	);
 
 	void checkZneupdIerr(int ierr) const;
@@ -257,6 +313,10 @@ inline int ArnoldiIterator::getNumEigenValues() const{
 	return numEigenValues;
 }
 
+inline int ArnoldiIterator::getNumCalculatedEigenValues() const{
+	return numCalculatedEigenValues;
+}
+
 inline void ArnoldiIterator::setCalculateEigenVectors(bool calculateEigenVectors){
 	this->calculateEigenVectors = calculateEigenVectors;
 }
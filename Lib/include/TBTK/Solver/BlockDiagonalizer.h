@@ -138,6 +138,40 @@ public:
 	 *  the block for which the given Index is part of the basis. */
 	unsigned int getLastStateInBlock(const Index &index) const;
 
+	/** Get the number of states in the block that contains the given
+	 *  state.
+	 *
+	 *  @param state Global state index of any state in the block.
+	 *
+	 *  @return The number of states in the block. */
+	unsigned int getNumStatesInBlock(unsigned int state) const;
+
+	/** Get the eigenvalues of the block that contains the given state.
+	 *  Allows the eigenvalues of a whole block to be accessed without
+	 *  looking up the block for every eigenvalue. The pointer is valid
+	 *  until the BlockDiagonalizer is run again or destroyed.
+	 *
+	 *  @param state Global state index of any state in the block.
+	 *
+	 *  @return Pointer to the first eigenvalue of the block. The
+	 *  eigenvalues are stored contiguously in accending order. */
+	const double* getEigenValuesInBlock(unsigned int state) const;
+
+	/** Get the eigenvectors of the block that contains the given state.
+	 *  Allows the eigenvectors of a whole block to be accessed without
+	 *  looking up the block for every amplitude. The pointer is valid
+	 *  until the BlockDiagonalizer is run again or destroyed.
+	 *
+	 *  @param state Global state index of any state in the block.
+	 *
+	 *  @return Pointer to the eigenvectors of the block. The amplitude of
+	 *  the nth eigenvector (in accending order) on the mth basis state of
+	 *  the block is stored at position n*N + m, where N is the number of
+	 *  states in the block. */
+	const std::complex<double>* getEigenVectorsInBlock(
+		unsigned int state
+	) const;
+
 	/** Set whether parallel execution is enabled or not. Parallel
 	 *  execution is only possible if OpenMP is available.
 	 *
@@ -286,6 +320,24 @@ inline unsigned int BlockDiagonalizer::getLastStateInBlock(
 	return getFirstStateInBlock(index) + numStatesPerBlock.at(block)-1;
 }
 
+inline unsigned int BlockDiagonalizer::getNumStatesInBlock(
+	unsigned int state
+) const{
+	return numStatesPerBlock.at(stateToBlockMap.at(state));
+}
+
+inline const double* BlockDiagonalizer::getEigenValuesInBlock(
+	unsigned int state
+) const{
+	return &eigenValues[blockToStateMap.at(stateToBlockMap.at(state))];
+}
+
+inline const std::complex<double>* BlockDiagonalizer::getEigenVectorsInBlock(
+	unsigned int state
+) const{
+	return &eigenVectors[eigenVectorOffsets.at(stateToBlockMap.at(state))];
+}
+
 inline void BlockDiagonalizer::setParallelExecution(
 	bool parallelExecution
 ){
@@ -28,12 +28,21 @@
 #include "TBTK/SparseMatrix.h"
 
 #include <complex>
+#include <vector>
 
 #include "slu_zdefs.h"
 
 namespace TBTK{
 
-/** @brief Solves Mx = b for x, where M is a SparseMatrix. */
+/** @brief Solves Mx = b for x, where M is a SparseMatrix.
+ *
+ *  The factorization of M starts with the calculation of a column
+ *  permutation that reduces the fill-in. The column permutation only depends
+ *  on the sparsity pattern of M and is reused if a new matrix with the same
+ *  sparsity pattern is set. For example, when solving (E - H)x = b for many
+ *  different energies E, the column permutation is only calculated for the
+ *  first energy. The elimination tree and the LU factorization itself are
+ *  recalculated for every matrix. */
 class LUSolver : public Communicator{
 public:
 	/** Enum class for specifying the data type of the matrix. Used since
@@ -47,18 +56,35 @@ public:
 	/** Destructor. */
 	~LUSolver();
 
-	/** Set matrix.
+	/** Set matrix. The column permutation of the previous matrix is
+	 *  reused if the sparsity pattern is the same.
 	 *
 	 *  @param sparseMatrix Matrix \f$M\f$ to use in the equation \f$Mx =
 	 *  b\f$. */
 	void setMatrix(const SparseMatrix<double> &sparseMatrix);
 
-	/** Set matrix.
+	/** Set matrix. The column permutation of the previous matrix is
+	 *  reused if the sparsity pattern is the same.
 	 *
 	 *  @param sparseMatrix Matrix \f$H\f$ to use in the equation \f$Mx =
 	 *  b\f$. */
 	void setMatrix(const SparseMatrix<std::complex<double>> &sparseMatrix);
 
+	/** Set whether the column permutation should be reused when a
+	 *  matrix with the same sparsity pattern as the previous matrix is
+	 *  set. Enabled by default.
+	 *
+	 *  @param reuseSymbolicFactorization If true, the column permutation
+	 *  is reused for matrices with the same sparsity pattern. The
+	 *  elimination tree is recalculated for every matrix. */
+	void setReuseSymbolicFactorization(bool reuseSymbolicFactorization);
+
+	/** Get whether the column permutation is reused for matrices with
+	 *  the same sparsity pattern.
+	 *
+	 *  @return True if the column permutation is reused. */
+	bool getReuseSymbolicFactorization() const;
+
 	/** Get matrix data type. Is None before a matrix has been set, Double
 	 *  if a real matrix has been set, and ComplexDouble if a complex
 	 *  matrix has been set. Note that a SparseMatrix<std::complex<double>>
@@ -67,17 +93,46 @@ public:
 	 *  @return The data type that is used to store the data. */
 	DataType getMatrixDataType() const;
 
-	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$.
+	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$. Each column of
+	 *  b is treated as a separate right hand side and all columns are
+	 *  solved for in a single call to SuperLU.
 	 *
 	 *  @param b The vector \f$b\f$. Contains the answer \f$x\f$ when
 	 *  finished. */
 	void solve(Matrix<double> &b);
 
-	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$.
+	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$. Each column of
+	 *  b is treated as a separate right hand side and all columns are
+	 *  solved for in a single call to SuperLU.
 	 *
 	 *  @param b The vector \f$b\f$. Contains the answer \f$x\f$ when
 	 *  finished. */
 	void solve(Matrix<std::complex<double>> &b);
+
+	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$ for multiple right
+	 *  hand sides. The solution is calculated in place without copying
+	 *  the right hand sides.
+	 *
+	 *  @param b Array containing the right hand sides stored one after
+	 *  the other, each with as many elements as the number of rows of
+	 *  \f$M\f$. Contains the answers when finished.
+	 *
+	 *  @param numRightHandSides The number of right hand sides. */
+	void solve(double *b, unsigned int numRightHandSides = 1);
+
+	/** Solve for \f$x\f$ in the equation \f$Mx = b\f$ for multiple right
+	 *  hand sides. The solution is calculated in place without copying
+	 *  the right hand sides if the matrix is complex.
+	 *
+	 *  @param b Array containing the right hand sides stored one after
+	 *  the other, each with as many elements as the number of rows of
+	 *  \f$M\f$. Contains the answers when finished.
+	 *
+	 *  @param numRightHandSides The number of right hand sides. */
+	void solve(
+		std::complex<double> *b,
+		unsigned int numRightHandSides = 1
+	);
 private:
 	/** Pointer to lower triangular matrix. */
 	SuperMatrix *L;
@@ -91,6 +146,22 @@ private:
 	/** Column permutations. */
 	int *columnPermutations;
 
+	/** Column elimination tree. */
+	int *eliminationTree;
+
+	/** Flag indicating whether the column permutation is reused for
+	 *  matrices with the same sparsity pattern. */
+	bool reuseSymbolicFactorization;
+
+	/** Number of rows of the last factorized matrix. */
+	unsigned int patternNumRows;
+
+	/** Column pointers of the last factorized matrix. */
+	std::vector<unsigned int> patternColumnPointers;
+
+	/** Row indices of the last factorized matrix. */
+	std::vector<unsigned int> patternRows;
+
 	/** SuperLU statistics. */
 	SuperLUStat_t *statistics;
 
@@ -109,14 +180,36 @@ private:
 	/** Allocate LU matrices. */
 	void allocateLUMatrices();
 
+	/** Store the sparsity pattern of a new matrix and check whether the
+	 *  column permutation of the previous matrix can be reused.
+	 *
+	 *  @param numRows The number of rows.
+	 *  @param numColumns The number of columns.
+	 *  @param numMatrixElements The number of matrix elements.
+	 *  @param columnPointers The CSC column pointers.
+	 *  @param rows The CSC row indices.
+	 *
+	 *  @return True if the column permutation can be reused. */
+	bool updateSparsityPattern(
+		unsigned int numRows,
+		unsigned int numColumns,
+		unsigned int numMatrixElements,
+		const unsigned int *columnPointers,
+		const unsigned int *rows
+	);
+
 	/** Initialize SuperLU options and permutation matrices. */
 	void initOptionsAndPermutationMatrices(
 		superlu_options_t &options,
-		SuperMatrix &matrix
+		SuperMatrix &matrix,
+		bool samePattern
 	);
 
 	/** Perform LU factorization. */
-	void performLUFactorization(SuperMatrix &matrix);
+	void performLUFactorization(SuperMatrix &matrix, bool samePattern);
+
+	/** Check that a matrix has been set. */
+	void checkSolveAssert();
 
 	/** Check assertments for solve(). */
 	void checkSolveAssert(unsigned int numRows);
@@ -132,6 +225,16 @@ private:
 	void checkXgstrsErrors(int info, std::string functionName);
 };
 
+inline void LUSolver::setReuseSymbolicFactorization(
+	bool reuseSymbolicFactorization
+){
+	this->reuseSymbolicFactorization = reuseSymbolicFactorization;
+}
+
+inline bool LUSolver::getReuseSymbolicFactorization() const{
+	return reuseSymbolicFactorization;
+}
+
 inline LUSolver::DataType LUSolver::getMatrixDataType() const{
 	return matrixDataType;
 }
@@ -51,14 +51,61 @@ public:
 		const Index &index,
 		const std::vector<std::complex<double>> &energies
 	);
+
+	/** Calculate the susceptibility for all orbital quadruples
+	 *  simultaneously. The band pair weights are calculated once per
+	 *  mesh point and are contracted with the amplitudes using matrix
+	 *  multiplications, which is considerably faster than calculating
+	 *  each orbital quadruple separately when all of them are needed.
+	 *
+	 *  @param kIndex The momentum Index.
+	 *  @param energies The energies to calculate the susceptibility for.
+	 *
+	 *  @return The susceptibility for all orbital quadruples. The element
+	 *  for the orbitals {o0, o1, o2, o3} and energy e is stored at
+	 *  ((((o0*N + o1)*N + o2)*N + o3)*energies.size() + e, where N is the
+	 *  number of orbitals. */
+	std::vector<std::complex<double>> calculateSusceptibilityAllOrbitals(
+		const Index &kIndex,
+		const std::vector<std::complex<double>> &energies
+	);
+
+	/** Set whether calculateSusceptibility() should calculate the
+	 *  susceptibility for all orbital quadruples at once using
+	 *  calculateSusceptibilityAllOrbitals(). The result is cached for the
+	 *  last momentum, such that the remaining orbital quadruples for the
+	 *  same momentum can be returned without further calculation. This
+	 *  is favorable when all orbital quadruples are extracted.
+	 *
+	 *  @param calculateAllOrbitals Flag indicating whether all orbital
+	 *  quadruples should be calculated at once. */
+	void setCalculateAllOrbitals(bool calculateAllOrbitals);
+
+	/** Get whether all orbital quadruples are calculated at once.
+	 *
+	 *  @return True if all orbital quadruples are calculated at once. */
+	bool getCalculateAllOrbitals() const;
 private:
 	/** Fermi-Dirac distribution lookup table. */
 	double *fermiDiracLookupTable;
 
+	/** Flag indicating whether all orbital quadruples are calculated at
+	 *  once. */
+	bool calculateAllOrbitals;
+
+	/** Momentum Index for which the orbital tensor is cached. */
+	Index cachedKIndex;
+
+	/** Energies for which the orbital tensor is cached. */
+	std::vector<std::complex<double>> cachedEnergies;
+
+	/** Cached susceptibility for all orbital quadruples. */
+	std::vector<std::complex<double>> cachedOrbitalTensor;
+
 	/** Slave constructor. */
 	LindhardSusceptibility(
 		const MomentumSpaceContext &momentumSpaceContext,
-		int *kPlusQLookupTable,
+		const int *kPlusQLookupTable,
 		double *fermiDiracLookupTable
 	);
 
@@ -85,6 +132,17 @@ private:
 	) const;
 };
 
+inline void LindhardSusceptibility::setCalculateAllOrbitals(
+	bool calculateAllOrbitals
+){
+	this->calculateAllOrbitals = calculateAllOrbitals;
+	cachedOrbitalTensor.clear();
+}
+
+inline bool LindhardSusceptibility::getCalculateAllOrbitals() const{
+	return calculateAllOrbitals;
+}
+
 };	//End of namespace Solver
 };	//End of namespace TBTK
 
@@ -53,7 +53,23 @@ public:
 		const std::vector<std::complex<double>> &energies
 	);
 
-	/** Calculate the susceptibility. */
+	/** Calculate the susceptibility
+	 *  -(kT/N)\sum_{p,n}G_{da}(p, i\nu_n)G_{bc}(p+k, i\nu_n + i\omega_m)
+	 *  for the compound Index {k, a, b, c, d}. The sum is evaluated as a
+	 *  convolution in momentum and Matsubara frequency, which is
+	 *  calculated using fast Fourier transforms when TBTK is built with
+	 *  FFTW3. The susceptibility is calculated for all k at once for a
+	 *  given set of intra block Indices {a, b, c, d} and is cached, such
+	 *  that successive calls that only differ in k are cheap.
+	 *
+	 *  @param index Compound Index on the form {k, a, b, c, d}.
+	 *
+	 *  @return The susceptibility for the bosonic Matsubara energy
+	 *  indices -2(N-1), -2(N-1) + 2, ..., 2(N-1), where N is the number
+	 *  of fermionic Matsubara energies in the Green's function. Values
+	 *  close to the edges include fewer terms in the Matsubara sum, and
+	 *  the Green's function should therefore be calculated for a wider
+	 *  energy window than the susceptibility is needed for. */
 	std::vector<std::complex<double>> calculateSusceptibility(
 		const Index &index
 	);
@@ -61,6 +77,28 @@ private:
 	/** The Green's function to calculate the Susceptibility form. */
 	const Property::GreensFunction &greensFunction;
 
+	/** Intra block Indices {a, b, c, d} for which the susceptibility is
+	 *  currently cached. */
+	Index cachedIntraBlockIndices;
+
+	/** Susceptibility for all mesh points for the intra block Indices
+	 *  stored in cachedIntraBlockIndices. The data is stored with the
+	 *  Matsubara energy as the major index and the position of the mesh
+	 *  point in the row-major momentum grid as the minor index. */
+	std::vector<std::complex<double>> cachedSusceptibility;
+
+	/** Get the position of a mesh point in the row-major momentum grid
+	 *  used for the convolution. */
+	unsigned int getGridPosition(const Index &kIndex) const;
+
+	/** Calculate the susceptibility for all mesh points and store the
+	 *  result in cachedSusceptibility.
+	 *
+	 *  @param intraBlockIndices The intra block Indices {a, b, c, d}. */
+	void calculateSusceptibilityAllMeshPoints(
+		const Index intraBlockIndices[4]
+	);
+
 	/** Slave constructor. */
 /*	MatsubaraSusceptibility(
 		const MomentumSpaceContext &momentumSpaceContext,
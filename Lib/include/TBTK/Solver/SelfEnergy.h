@@ -96,11 +96,14 @@ private:
 	/** Interaction vertex. */
 	const Property::InteractionVertex &interactionVertex;
 
-	/** Lookup table for calculating k+q. */
-	int *kMinusQLookupTable;
+	/** Lookup table for calculating k-q. Owned by the
+	 *  MomentumSpaceContext. */
+	const int *kMinusQLookupTable;
 
 	/** Generate lookup table for the k-q linear index. Can be called
-	 *  repeatedly, and the lookup table is only generated once. */
+	 *  repeatedly, and the lookup table is only generated once. The
+	 *  lookup table is owned by the MomentumSpaceContext and is shared
+	 *  with all other solvers that use the same context. */
 	void generateKMinusQLookupTable();
 
 	/** Returns the linear index for k+q. */
@@ -114,6 +117,12 @@ private:
 	/** Energies to calculate the self-energy for. */
 //	std::vector<std::complex<double>> selfEnergyEnergies;
 
+	/** Matsubara energies of the interaction vertex to sum over. */
+	std::vector<std::complex<double>> summationEnergies;
+
+	/** Weights for the Matsubara energies of the interaction vertex. */
+	std::vector<double> summationWeights;
+
 	/** Flag indicating whether the SelfEnergyCalculator is initialized. */
 	bool isInitialized;
 
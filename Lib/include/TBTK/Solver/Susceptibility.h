@@ -77,7 +77,8 @@ public:
 
 	/** Generate lookup table for the k+q linear index. Can be called
 	 *  repeatedly, and the lookup table is only generated the first time.
-	 */
+	 *  The lookup table is owned by the MomentumSpaceContext and is
+	 *  shared with all other solvers that use the same context. */
 	void generateKPlusQLookupTable();
 
 	/** Get the algorithm used to calculate the susceptibility. */
@@ -104,15 +105,12 @@ protected:
 	Susceptibility(
 		Algorithm algorithm,
 		const MomentumSpaceContext &momentumSpaceContext,
-		int *kPlusQLookupTable
+		const int *kPlusQLookupTable
 	);
 
 	/** Returns true if the Susceptibility is a master. */
 	bool getIsMaster() const;
 
-	/** Returns the k+q lookup table. */
-	int* getKPlusQLookupTable();
-
 	/** Returns the k+q lookup table. */
 	const int* getKPlusQLookupTable() const;
 
@@ -135,8 +133,9 @@ private:
 	/** Momentum space context. */
 	const MomentumSpaceContext *momentumSpaceContext;
 
-	/** Lookup table for calculating k+q. */
-	int *kPlusQLookupTable;
+	/** Lookup table for calculating k+q. Owned by the
+	 *  MomentumSpaceContext. */
+	const int *kPlusQLookupTable;
 
 	/** Flag indicating whether the Susceptibility is a master.
 	 *  Masters owns resources shared between masters and slaves and is
@@ -168,8 +167,8 @@ inline bool Susceptibility::getIsMaster() const{
 	return isMaster;
 }
 
-inline int* Susceptibility::getKPlusQLookupTable(){
-	return kPlusQLookupTable;
+inline void Susceptibility::generateKPlusQLookupTable(){
+	kPlusQLookupTable = momentumSpaceContext->getKPlusQLookupTable();
 }
 
 inline const int* Susceptibility::getKPlusQLookupTable() const{
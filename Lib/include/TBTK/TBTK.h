@@ -35,12 +35,14 @@
 #include "TBTK/Array.h"
 #include "TBTK/ArrayManager.h"
 #include "TBTK/BandDiagramGenerator.h"
+#include "TBTK/EnergyMesh.h"
 #include "TBTK/FileParser.h"
 #include "TBTK/FileReader.h"
 #include "TBTK/FileWriter.h"
 #include "TBTK/Functions.h"
 #include "TBTK/IndexBasedHoppingAmplitudeFilter.h"
 #include "TBTK/IndexedDataTree.h"
+#include "TBTK/LazyLDOS.h"
 #include "TBTK/Matrix.h"
 #include "TBTK/MultiCounter.h"
 #include "TBTK/ParameterSet.h"
@@ -23,6 +23,7 @@
 #ifndef COM_DAFER45_TBTK_WIGNER_BRILLOUIN_ZONE
 #define COM_DAFER45_TBTK_WIGNER_BRILLOUIN_ZONE
 
+#include "TBTK/Matrix.h"
 #include "TBTK/WignerSeitzCell.h"
 
 #include <initializer_list>
@@ -30,9 +31,91 @@
 
 namespace TBTK{
 
-/** Brillouin zone. */
+/** Brillouin zone.
+ *
+ *  The BrillouinZone can be equipped with a set of point group operations
+ *  under which the system is symmetric. These are used to reduce a minor
+ *  mesh to its irreducible part, such that quantities that are invariant
+ *  under the symmetry operations only need to be calculated for a
+ *  fraction of the mesh points. By default the only symmetry operation is
+ *  the identity. */
 class BrillouinZone : public WignerSeitzCell{
 public:
+	/** Irreducible part of a minor mesh. Every mesh point of the full
+	 *  minor mesh is mapped to one of the irreducible mesh points by one
+	 *  of the symmetry operations of the BrillouinZone. The mesh points
+	 *  are referred to by their position in the mesh returned by
+	 *  BrillouinZone::getMinorMesh(). */
+	class IrreducibleMesh{
+	public:
+		/** Constructs an IrreducibleMesh for a mesh without symmetry
+		 *  reduction, where every mesh point is irreducible.
+		 *
+		 *  @param numMeshPoints The total number of mesh points. */
+		IrreducibleMesh(unsigned int numMeshPoints = 0);
+
+		/** Get the number of irreducible mesh points.
+		 *
+		 *  @return The number of irreducible mesh points. */
+		unsigned int getNumPoints() const;
+
+		/** Get the total number of mesh points.
+		 *
+		 *  @return The number of mesh points in the full mesh. */
+		unsigned int getNumMeshPoints() const;
+
+		/** Get the position in the full mesh of an irreducible mesh
+		 *  point.
+		 *
+		 *  @param n The irreducible mesh point.
+		 *
+		 *  @return The position of the point in the full mesh. */
+		unsigned int getPoint(unsigned int n) const;
+
+		/** Get the weight of an irreducible mesh point. The weight is
+		 *  the number of mesh points that the point represents divided
+		 *  by the total number of mesh points, such that an average
+		 *  over the full mesh of a symmetric quantity is given by the
+		 *  weighted sum over the irreducible mesh points.
+		 *
+		 *  @param n The irreducible mesh point.
+		 *
+		 *  @return The weight of the irreducible mesh point. */
+		double getWeight(unsigned int n) const;
+
+		/** Get the irreducible mesh point that a mesh point is mapped
+		 *  to.
+		 *
+		 *  @param meshPoint Position of a point in the full mesh.
+		 *
+		 *  @return The corresponding irreducible mesh point. */
+		unsigned int getIrreduciblePoint(unsigned int meshPoint) const;
+
+		/** Get the symmetry operation that maps the irreducible mesh
+		 *  point returned by getIrreduciblePoint() to the given mesh
+		 *  point. The mapping is modulo reciprocal lattice vectors.
+		 *
+		 *  @param meshPoint Position of a point in the full mesh.
+		 *
+		 *  @return Position of the symmetry operation in the list
+		 *  returned by BrillouinZone::getSymmetryOperations(). */
+		unsigned int getSymmetryOperation(unsigned int meshPoint) const;
+	private:
+		/** Positions of the irreducible points in the full mesh. */
+		std::vector<unsigned int> points;
+
+		/** Weights of the irreducible points. */
+		std::vector<double> weights;
+
+		/** Irreducible point for each mesh point. */
+		std::vector<unsigned int> irreduciblePoints;
+
+		/** Symmetry operation for each mesh point. */
+		std::vector<unsigned int> symmetryOperations;
+
+		friend class BrillouinZone;
+	};
+
 	/** Constructor. */
 	BrillouinZone(
 		std::initializer_list<std::initializer_list<double>> basisVectors,
@@ -47,8 +130,100 @@ public:
 
 	/** Destructor. */
 	virtual ~BrillouinZone();
+
+	/** Set the point group operations under which the system is
+	 *  symmetric. The operations are given as orthogonal matrices acting
+	 *  on Cartesian coordinates, with the same dimension as the
+	 *  BrillouinZone. Every operation must map the reciprocal lattice
+	 *  onto itself and the identity must be one of the operations.
+	 *
+	 *  @param symmetryOperations The symmetry operations. */
+	void setSymmetryOperations(
+		const std::vector<Matrix<double>> &symmetryOperations
+	);
+
+	/** Set the symmetry operations to the point group of the lattice.
+	 *  The point group of a Model defined on the lattice can be smaller
+	 *  than that of the lattice itself, in which case the symmetry
+	 *  operations should be set using setSymmetryOperations() instead.
+	 *  Operations are searched for among the matrices that have elements
+	 *  -1, 0, and 1 in the basis of the basis vectors, which covers the
+	 *  full point group as long as the basis vectors are reduced (as
+	 *  short as possible).
+	 *
+	 *  @param tolerance Relative tolerance used when checking whether an
+	 *  operation preserves the lengths and angles of the basis vectors. */
+	void detectSymmetryOperations(double tolerance = 1e-6);
+
+	/** Get the symmetry operations.
+	 *
+	 *  @return The symmetry operations. The first operation is always
+	 *  the identity. */
+	const std::vector<Matrix<double>>& getSymmetryOperations() const;
+
+	/** Get the irreducible part of the minor mesh. Symmetry operations
+	 *  that do not map the mesh onto itself are ignored.
+	 *
+	 *  @param numMeshPoints The number of mesh points along each basis
+	 *  vector.
+	 *
+	 *  @return The irreducible part of the minor mesh. */
+	IrreducibleMesh getIrreducibleMesh(
+		const std::vector<unsigned int> &numMeshPoints
+	) const;
+private:
+	/** Symmetry operations in Cartesian coordinates. */
+	std::vector<Matrix<double>> symmetryOperations;
+
+	/** Symmetry operations in the basis of the basis vectors. The
+	 *  element (i, j) of an operation is the j-component of the image of
+	 *  basis vector i, stored at position i*dimensions + j. */
+	std::vector<std::vector<int>> latticeSymmetryOperations;
+
+	/** Set the symmetry operations to the identity. */
+	void setIdentity();
+
+	/** Get the dual basis vectors n_j, which satisfy b_i*n_j =
+	 *  delta_{ij}. */
+	std::vector<Vector3d> getDualBasisVectors() const;
 };
 
+inline unsigned int BrillouinZone::IrreducibleMesh::getNumPoints() const{
+	return points.size();
+}
+
+inline unsigned int BrillouinZone::IrreducibleMesh::getNumMeshPoints(
+) const{
+	return irreduciblePoints.size();
+}
+
+inline unsigned int BrillouinZone::IrreducibleMesh::getPoint(
+	unsigned int n
+) const{
+	return points[n];
+}
+
+inline double BrillouinZone::IrreducibleMesh::getWeight(unsigned int n) const{
+	return weights[n];
+}
+
+inline unsigned int BrillouinZone::IrreducibleMesh::getIrreduciblePoint(
+	unsigned int meshPoint
+) const{
+	return irreduciblePoints[meshPoint];
+}
+
+inline unsigned int BrillouinZone::IrreducibleMesh::getSymmetryOperation(
+	unsigned int meshPoint
+) const{
+	return symmetryOperations[meshPoint];
+}
+
+inline const std::vector<Matrix<double>>& BrillouinZone::getSymmetryOperations(
+) const{
+	return symmetryOperations;
+}
+
 };	//End namespace TBTK
 
 #endif
@@ -141,7 +141,7 @@ public:
 		const std::vector<unsigned int> &meshPoint,
 		const std::vector<unsigned int> &numMeshPoints
 	) const = 0;
-protected:
+
 	/** Get basis vectors. */
 	const std::vector<Vector3d>& getBasisVectors() const;
 
@@ -23,6 +23,8 @@
 #ifndef COM_DAFER45_TBTK_ARRAY
 #define COM_DAFER45_TBTK_ARRAY
 
+#include "TBTK/ArrayExpression.h"
+#include "TBTK/ArraySlice.h"
 #include "TBTK/Index.h"
 #include "TBTK/TBTKMacros.h"
 
@@ -30,9 +32,18 @@
 
 namespace TBTK{
 
+/** @brief Multi-dimensional array.
+ *
+ *  The elements are stored contiguously in row major order. Arithmetic
+ *  operators return lazily evaluated expressions (see ArrayExpression), such
+ *  that an expression like 2.*a + b is evaluated in a single pass without
+ *  allocating intermediate Arrays. */
 template<typename DataType>
-class Array{
+class Array : public ArrayExpression<Array<DataType>>{
 public:
+	/** Type of the elements. */
+	typedef DataType ValueType;
+
 	/** Constructor. */
 	Array();
 
@@ -48,6 +59,12 @@ public:
 	/** Move constructor. */
 	Array(Array &&array);
 
+	/** Constructor. Evaluates an Array expression.
+	 *
+	 *  @param expression The expression to evaluate. */
+	template<typename Expression>
+	Array(const ArrayExpression<Expression> &expression);
+
 	/** Destructor. */
 	~Array();
 
@@ -57,6 +74,45 @@ public:
 	/** Move assignment operator. */
 	Array& operator=(Array &&rhs);
 
+	/** Assignment operator. Evaluates an Array expression. The elements
+	 *  are written in place if the ranges are unchanged.
+	 *
+	 *  @param rhs The expression to evaluate.
+	 *
+	 *  @return The Array. */
+	template<typename Expression>
+	Array& operator=(const ArrayExpression<Expression> &rhs);
+
+	/** Addition assignment operator.
+	 *
+	 *  @param rhs The expression to add.
+	 *
+	 *  @return The Array. */
+	template<typename Expression>
+	Array& operator+=(const ArrayExpression<Expression> &rhs);
+
+	/** Subtraction assignment operator.
+	 *
+	 *  @param rhs The expression to subtract.
+	 *
+	 *  @return The Array. */
+	template<typename Expression>
+	Array& operator-=(const ArrayExpression<Expression> &rhs);
+
+	/** Multiplication assignment operator.
+	 *
+	 *  @param rhs The scalar to multiply by.
+	 *
+	 *  @return The Array. */
+	Array& operator*=(const DataType &rhs);
+
+	/** Division assignment operator.
+	 *
+	 *  @param rhs The scalar to divide by.
+	 *
+	 *  @return The Array. */
+	Array& operator/=(const DataType &rhs);
+
 	/** Array subscript operator. */
 	DataType& operator[](const std::initializer_list<unsigned int> &index);
 
@@ -75,32 +131,56 @@ public:
 	 *  be calculated as SIZE_C*SIZE_B*a + SIZE_C*b + c. */
 	const DataType& operator[](unsigned int n) const;
 
-	/** Addition operator. */
-	Array operator+(const Array &rhs) const;
-
-	/** Subtraction operator. */
-	Array operator-(const Array &rhs) const;
-
-	/** Multiplication operator. */
-	Array operator*(const DataType &rhs) const;
-
-	/** Multiplication operator. */
-	friend Array operator*(const DataType &lhs, const Array &rhs){
-		Array<DataType> result(rhs.ranges);
-		for(unsigned int n = 0; n < rhs.size; n++)
-			result.data[n] = lhs*rhs.data[n];
-
-		return result;
-	}
-
-	/** Division operator. */
-	Array operator/(const DataType &rhs) const;
-
 	/** Get slice. */
 	Array<DataType> getSlice(const std::vector<int> &index) const;
 
+	/** Get a view of a slice. Works as getSlice(), but the returned
+	 *  ArraySlice refers to the elements of the Array instead of copying
+	 *  them.
+	 *
+	 *  @param index One subindex per dimension, where IDX_ALL marks the
+	 *  dimensions that are kept in the slice.
+	 *
+	 *  @return ArraySlice referring to the elements of the slice. */
+	ArraySlice<DataType> getSliceView(const std::vector<int> &index);
+
+	/** Get a view of a slice. Works as getSlice(), but the returned
+	 *  ArraySlice refers to the elements of the Array instead of copying
+	 *  them.
+	 *
+	 *  @param index One subindex per dimension, where IDX_ALL marks the
+	 *  dimensions that are kept in the slice.
+	 *
+	 *  @return ArraySlice referring to the elements of the slice. */
+	ArraySlice<const DataType> getSliceView(
+		const std::vector<int> &index
+	) const;
+
 	/** Get ranges. */
 	const std::vector<unsigned int>& getRanges() const;
+
+	/** Get the strides. The element {a, b, c} is located at
+	 *  getStrides()[0]*a + getStrides()[1]*b + getStrides()[2]*c in the
+	 *  array returned by getData().
+	 *
+	 *  @return The distance between consecutive elements along each
+	 *  dimension. */
+	std::vector<unsigned int> getStrides() const;
+
+	/** Get the number of elements.
+	 *
+	 *  @return The number of elements. */
+	unsigned int getSize() const;
+
+	/** Get raw data.
+	 *
+	 *  @return Pointer to the first element. */
+	DataType* getData();
+
+	/** Get raw data.
+	 *
+	 *  @return Pointer to the first element. */
+	const DataType* getData() const;
 private:
 	/** Data data. */
 	DataType *data;
@@ -111,20 +191,28 @@ private:
 	/** Ranges. */
 	std::vector<unsigned int> ranges;
 
-	/** Fill slice. */
-	void fillSlice(
-		Array &array,
+	/** Calculate the offset and the ranges and strides of a slice.
+	 *
+	 *  @param index The index specifying the slice.
+	 *  @param functionName Name of the calling function.
+	 *  @param offset Set to the offset of the first element.
+	 *  @param sliceRanges Set to the ranges of the slice.
+	 *  @param sliceStrides Set to the strides of the slice. */
+	void getSliceLayout(
 		const std::vector<int> &index,
-		unsigned int subindex,
-		unsigned int offsetSlice,
-		unsigned int offsetOriginal
+		const std::string &functionName,
+		unsigned int &offset,
+		std::vector<unsigned int> &sliceRanges,
+		std::vector<unsigned int> &sliceStrides
 	) const;
+};
 
-	/** Checks wether the Array has the same ranges as a given Array. */
-	void assertCompatibleRanges(
-		const Array &array,
-		std::string functionName
-	) const;
+/** Operands of Array expressions that are Arrays are stored by reference. */
+template<typename DataType>
+class ArrayOperand<Array<DataType>>{
+public:
+	/** The type used to store the operand. */
+	typedef const Array<DataType> &Type;
 };
 
 template<typename DataType>
@@ -195,6 +283,22 @@ Array<DataType>::Array(Array &&array){
 	array.data = nullptr;
 }
 
+template<typename DataType>
+template<typename Expression>
+Array<DataType>::Array(const ArrayExpression<Expression> &expression){
+	const Expression &e = expression.getExpression();
+	ranges = e.getRanges();
+	size = e.getSize();
+	if(size != 0){
+		data = new DataType[size];
+		for(unsigned int n = 0; n < size; n++)
+			data[n] = e[n];
+	}
+	else{
+		data = nullptr;
+	}
+}
+
 template<typename DataType>
 Array<DataType>::~Array(){
 	if(data != nullptr)
@@ -274,163 +378,190 @@ inline const DataType& Array<DataType>::operator[](unsigned int n) const{
 }
 
 template<typename DataType>
-inline Array<DataType> Array<DataType>::operator+(
-	const Array<DataType> &rhs
-) const{
-	assertCompatibleRanges(rhs, "operator+()");
+template<typename Expression>
+Array<DataType>& Array<DataType>::operator=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	if(expression.getRanges() != ranges){
+		//Evaluate into a new Array since the expression may refer to the
+		//current data.
+		*this = Array(rhs);
+
+		return *this;
+	}
 
-	Array<DataType> result(ranges);
 	for(unsigned int n = 0; n < size; n++)
-		result.data[n] = data[n] + rhs.data[n];
+		data[n] = expression[n];
 
-	return result;
+	return *this;
 }
 
 template<typename DataType>
-inline Array<DataType> Array<DataType>::operator-(
-	const Array<DataType> &rhs
-) const{
-	assertCompatibleRanges(rhs, "operator+()");
+template<typename Expression>
+inline Array<DataType>& Array<DataType>::operator+=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	this->assertCompatibleRanges(
+		ranges,
+		expression.getRanges(),
+		"operator+=()"
+	);
+	for(unsigned int n = 0; n < size; n++)
+		data[n] += expression[n];
 
-	Array<DataType> result(ranges);
+	return *this;
+}
+
+template<typename DataType>
+template<typename Expression>
+inline Array<DataType>& Array<DataType>::operator-=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	this->assertCompatibleRanges(
+		ranges,
+		expression.getRanges(),
+		"operator-=()"
+	);
 	for(unsigned int n = 0; n < size; n++)
-		result.data[n] = data[n] - rhs.data[n];
+		data[n] -= expression[n];
 
-	return result;
+	return *this;
 }
 
 template<typename DataType>
-inline Array<DataType> Array<DataType>::operator*(
-	const DataType &rhs
-) const{
-	Array<DataType> result(ranges);
+inline Array<DataType>& Array<DataType>::operator*=(const DataType &rhs){
 	for(unsigned int n = 0; n < size; n++)
-		result.data[n] = data[n]*rhs;
+		data[n] *= rhs;
 
-	return result;
+	return *this;
 }
 
 template<typename DataType>
-inline Array<DataType> Array<DataType>::operator/(
-	const DataType &rhs
-) const{
-	Array<DataType> result(ranges);
+inline Array<DataType>& Array<DataType>::operator/=(const DataType &rhs){
 	for(unsigned int n = 0; n < size; n++)
-		result.data[n] = data[n]/rhs;
+		data[n] /= rhs;
 
-	return result;
+	return *this;
 }
 
 template<typename DataType>
 Array<DataType> Array<DataType>::getSlice(const std::vector<int> &index) const{
-	TBTKAssert(
-		ranges.size() == index.size(),
-		"Array::getSlice()",
-		"Incompatible ranges.",
-		"'index' must have the same number of dimensions as 'ranges'."
+	return Array(getSliceView(index));
+}
+
+template<typename DataType>
+ArraySlice<DataType> Array<DataType>::getSliceView(
+	const std::vector<int> &index
+){
+	unsigned int offset;
+	std::vector<unsigned int> sliceRanges;
+	std::vector<unsigned int> sliceStrides;
+	getSliceLayout(
+		index,
+		"getSliceView()",
+		offset,
+		sliceRanges,
+		sliceStrides
 	);
 
-	std::vector<unsigned int> newRanges;
-	for(unsigned int n = 0; n < ranges.size(); n++){
-		TBTKAssert(
-			index[n] < (int)ranges[n],
-			"Array::getSlice()",
-			"'index' out of range.",
-			""
-		);
-		if(index[n] < 0){
-			TBTKAssert(
-				index[n] == IDX_ALL,
-				"Array::getSlice()",
-				"Invalid symbol.",
-				"'index' can only contain positive numbers or"
-				<< " 'IDX_ALL'."
-			);
-			newRanges.push_back(ranges[n]);
-		}
-	}
+	return ArraySlice<DataType>(data + offset, sliceRanges, sliceStrides);
+}
 
-	Array array(newRanges);
+template<typename DataType>
+ArraySlice<const DataType> Array<DataType>::getSliceView(
+	const std::vector<int> &index
+) const{
+	unsigned int offset;
+	std::vector<unsigned int> sliceRanges;
+	std::vector<unsigned int> sliceStrides;
+	getSliceLayout(
+		index,
+		"getSliceView()",
+		offset,
+		sliceRanges,
+		sliceStrides
+	);
 
-	fillSlice(array, index, 0, 0, 0);
+	return ArraySlice<const DataType>(
+		data + offset,
+		sliceRanges,
+		sliceStrides
+	);
+}
 
-	return array;
+template<typename DataType>
+inline const std::vector<unsigned int>& Array<DataType>::getRanges() const{
+	return ranges;
 }
 
 template<typename DataType>
-void Array<DataType>::fillSlice(
-	Array &array,
-	const std::vector<int> &index,
-	unsigned int subindex,
-	unsigned int offsetSlice,
-	unsigned int offsetOriginal
-) const{
-	if(subindex == index.size()-1){
-		if(index[subindex] == IDX_ALL){
-			for(unsigned int n = 0; n < ranges[subindex]; n++){
-				array.data[offsetSlice*ranges[subindex] + n]
-					= data[
-						offsetOriginal*ranges[subindex]
-						+ n
-					];
-			}
-		}
-		else{
-			array.data[offsetSlice] = data[
-				offsetOriginal*ranges[subindex]
-				+ index[subindex]
-			];
-		}
-	}
-	else{
-		if(index[subindex] == IDX_ALL){
-			for(unsigned int n = 0; n < ranges[subindex]; n++){
-				fillSlice(
-					array,
-					index,
-					subindex+1,
-					offsetSlice*ranges[subindex] + n,
-					offsetOriginal*ranges[subindex] + n
-				);
-			}
-		}
-		else{
-			fillSlice(
-				array,
-				index,
-				subindex+1,
-				offsetSlice,
-				offsetOriginal*ranges[subindex]
-					+ index[subindex]
-			);
-		}
+inline std::vector<unsigned int> Array<DataType>::getStrides() const{
+	std::vector<unsigned int> strides(ranges.size());
+	unsigned int stride = 1;
+	for(int n = ranges.size() - 1; n >= 0; n--){
+		strides[n] = stride;
+		stride *= ranges[n];
 	}
+
+	return strides;
 }
 
 template<typename DataType>
-inline const std::vector<unsigned int>& Array<DataType>::getRanges() const{
-	return ranges;
+inline unsigned int Array<DataType>::getSize() const{
+	return size;
 }
 
 template<typename DataType>
-inline void Array<DataType>::assertCompatibleRanges(
-	const Array<DataType> &array,
-	std::string functionName
+inline DataType* Array<DataType>::getData(){
+	return data;
+}
+
+template<typename DataType>
+inline const DataType* Array<DataType>::getData() const{
+	return data;
+}
+
+template<typename DataType>
+void Array<DataType>::getSliceLayout(
+	const std::vector<int> &index,
+	const std::string &functionName,
+	unsigned int &offset,
+	std::vector<unsigned int> &sliceRanges,
+	std::vector<unsigned int> &sliceStrides
 ) const{
 	TBTKAssert(
-		ranges.size() == array.ranges.size(),
+		ranges.size() == index.size(),
 		"Array::" + functionName,
 		"Incompatible ranges.",
-		"Left and right hand sides must have the same number of"
-		<< " dimensions."
+		"'index' must have the same number of dimensions as 'ranges'."
 	);
+
+	std::vector<unsigned int> strides = getStrides();
+	offset = 0;
 	for(unsigned int n = 0; n < ranges.size(); n++){
 		TBTKAssert(
-			ranges[n] == array.ranges[n],
+			index[n] < (int)ranges[n],
 			"Array::" + functionName,
-			"Incompatible ranges.",
-			"Left and right hand sides must have the same ranges."
+			"'index' out of range.",
+			""
 		);
+		if(index[n] < 0){
+			TBTKAssert(
+				index[n] == IDX_ALL,
+				"Array::" + functionName,
+				"Invalid symbol.",
+				"'index' can only contain positive numbers or"
+				<< " 'IDX_ALL'."
+			);
+			sliceRanges.push_back(ranges[n]);
+			sliceStrides.push_back(strides[n]);
+		}
+		else{
+			offset += index[n]*strides[n];
+		}
 	}
 }
 
@@ -0,0 +1,436 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file ArrayExpression.h
+ *  @brief Lazily evaluated arithmetic expressions for Arrays.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_ARRAY_EXPRESSION
+#define COM_DAFER45_TBTK_ARRAY_EXPRESSION
+
+#include "TBTK/TBTKMacros.h"
+
+#include <string>
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Base class for lazily evaluated Array expressions.
+ *
+ *  Arithmetic operations on @link Array Arrays @endlink and @link ArraySlice
+ *  ArraySlices @endlink do not compute their result immediately. Instead
+ *  they return a lightweight expression object that records the operation
+ *  and its operands. The expression is evaluated element by element in a
+ *  single loop when it is assigned to an Array or ArraySlice, which avoids
+ *  the allocation of temporary Arrays for each intermediate result. For
+ *  example
+ *  <pre>
+ *      Array<double> result = 2.*a + b - c/3.;
+ *  </pre>
+ *  allocates a single Array and evaluates
+ *  result[n] = 2.*a[n] + b[n] - c[n]/3. for each n.
+ *
+ *  Expressions store references to the @link Array Arrays @endlink they are
+ *  built from and should therefore be evaluated before the @link Array
+ *  Arrays @endlink go out of scope. In particular, avoid storing expressions
+ *  in variables declared with auto.
+ *
+ *  Every expression type Expression provides the type
+ *  Expression::ValueType, and the functions
+ *  Expression::operator[](unsigned int n), Expression::getSize(), and
+ *  Expression::getRanges(). */
+template<typename Expression>
+class ArrayExpression{
+public:
+	/** Get the expression as its actual type.
+	 *
+	 *  @return The expression. */
+	const Expression& getExpression() const;
+protected:
+	/** Check that two expressions have the same ranges.
+	 *
+	 *  @param lhs Ranges of the left hand side.
+	 *  @param rhs Ranges of the right hand side.
+	 *  @param functionName Name of the calling function. */
+	static void assertCompatibleRanges(
+		const std::vector<unsigned int> &lhs,
+		const std::vector<unsigned int> &rhs,
+		const std::string &functionName
+	);
+};
+
+/** @brief Operand storage for Array expressions.
+ *
+ *  Expressions are stored by value since they are lightweight, while @link
+ *  Array Arrays @endlink are stored by reference. */
+template<typename Operand>
+class ArrayOperand{
+public:
+	/** The type used to store the operand. */
+	typedef const Operand Type;
+};
+
+/** @brief Element-wise operations used in Array expressions. */
+class ArrayOperation{
+public:
+	/** Addition. */
+	class Addition{
+	public:
+		template<typename ValueType>
+		static ValueType apply(const ValueType &lhs, const ValueType &rhs){
+			return lhs + rhs;
+		}
+	};
+
+	/** Subtraction. */
+	class Subtraction{
+	public:
+		template<typename ValueType>
+		static ValueType apply(const ValueType &lhs, const ValueType &rhs){
+			return lhs - rhs;
+		}
+	};
+
+	/** Multiplication. */
+	class Multiplication{
+	public:
+		template<typename ValueType>
+		static ValueType apply(const ValueType &lhs, const ValueType &rhs){
+			return lhs*rhs;
+		}
+	};
+
+	/** Division. */
+	class Division{
+	public:
+		template<typename ValueType>
+		static ValueType apply(const ValueType &lhs, const ValueType &rhs){
+			return lhs/rhs;
+		}
+	};
+};
+
+/** @brief Element-wise operation between two Array expressions. */
+template<typename LeftOperand, typename RightOperand, typename Operation>
+class ArrayBinaryExpression : public ArrayExpression<
+	ArrayBinaryExpression<LeftOperand, RightOperand, Operation>
+>{
+public:
+	/** Type of the elements. */
+	typedef typename LeftOperand::ValueType ValueType;
+
+	/** Constructor.
+	 *
+	 *  @param lhs The left hand side operand.
+	 *  @param rhs The right hand side operand.
+	 *  @param functionName Name of the operator used in error messages. */
+	ArrayBinaryExpression(
+		const LeftOperand &lhs,
+		const RightOperand &rhs,
+		const std::string &functionName
+	);
+
+	/** Evaluate the expression for a given element.
+	 *
+	 *  @param n Linear index of the element.
+	 *
+	 *  @return The value of the element. */
+	ValueType operator[](unsigned int n) const;
+
+	/** Get the number of elements.
+	 *
+	 *  @return The number of elements. */
+	unsigned int getSize() const;
+
+	/** Get the ranges.
+	 *
+	 *  @return The ranges. */
+	const std::vector<unsigned int>& getRanges() const;
+private:
+	/** Left hand side operand. */
+	typename ArrayOperand<LeftOperand>::Type lhs;
+
+	/** Right hand side operand. */
+	typename ArrayOperand<RightOperand>::Type rhs;
+};
+
+/** @brief Element-wise operation between an Array expression and a
+ *  scalar. */
+template<typename Operand, typename Operation, bool scalarIsLeftOperand>
+class ArrayScalarExpression : public ArrayExpression<
+	ArrayScalarExpression<Operand, Operation, scalarIsLeftOperand>
+>{
+public:
+	/** Type of the elements. */
+	typedef typename Operand::ValueType ValueType;
+
+	/** Constructor.
+	 *
+	 *  @param operand The Array expression.
+	 *  @param scalar The scalar. */
+	ArrayScalarExpression(const Operand &operand, const ValueType &scalar);
+
+	/** Evaluate the expression for a given element.
+	 *
+	 *  @param n Linear index of the element.
+	 *
+	 *  @return The value of the element. */
+	ValueType operator[](unsigned int n) const;
+
+	/** Get the number of elements.
+	 *
+	 *  @return The number of elements. */
+	unsigned int getSize() const;
+
+	/** Get the ranges.
+	 *
+	 *  @return The ranges. */
+	const std::vector<unsigned int>& getRanges() const;
+private:
+	/** The Array expression. */
+	typename ArrayOperand<Operand>::Type operand;
+
+	/** The scalar. */
+	ValueType scalar;
+};
+
+/** Addition operator.
+ *
+ *  @param lhs Left hand side.
+ *  @param rhs Right hand side.
+ *
+ *  @return Expression for the element-wise sum. */
+template<typename LeftOperand, typename RightOperand>
+ArrayBinaryExpression<LeftOperand, RightOperand, ArrayOperation::Addition>
+operator+(
+	const ArrayExpression<LeftOperand> &lhs,
+	const ArrayExpression<RightOperand> &rhs
+){
+	return ArrayBinaryExpression<
+		LeftOperand,
+		RightOperand,
+		ArrayOperation::Addition
+	>(lhs.getExpression(), rhs.getExpression(), "operator+()");
+}
+
+/** Subtraction operator.
+ *
+ *  @param lhs Left hand side.
+ *  @param rhs Right hand side.
+ *
+ *  @return Expression for the element-wise difference. */
+template<typename LeftOperand, typename RightOperand>
+ArrayBinaryExpression<LeftOperand, RightOperand, ArrayOperation::Subtraction>
+operator-(
+	const ArrayExpression<LeftOperand> &lhs,
+	const ArrayExpression<RightOperand> &rhs
+){
+	return ArrayBinaryExpression<
+		LeftOperand,
+		RightOperand,
+		ArrayOperation::Subtraction
+	>(lhs.getExpression(), rhs.getExpression(), "operator-()");
+}
+
+/** Multiplication operator.
+ *
+ *  @param lhs Left hand side.
+ *  @param rhs Scalar right hand side.
+ *
+ *  @return Expression for the element-wise product. */
+template<typename Operand>
+ArrayScalarExpression<Operand, ArrayOperation::Multiplication, false>
+operator*(
+	const ArrayExpression<Operand> &lhs,
+	const typename Operand::ValueType &rhs
+){
+	return ArrayScalarExpression<
+		Operand,
+		ArrayOperation::Multiplication,
+		false
+	>(lhs.getExpression(), rhs);
+}
+
+/** Multiplication operator.
+ *
+ *  @param lhs Scalar left hand side.
+ *  @param rhs Right hand side.
+ *
+ *  @return Expression for the element-wise product. */
+template<typename Operand>
+ArrayScalarExpression<Operand, ArrayOperation::Multiplication, true>
+operator*(
+	const typename Operand::ValueType &lhs,
+	const ArrayExpression<Operand> &rhs
+){
+	return ArrayScalarExpression<
+		Operand,
+		ArrayOperation::Multiplication,
+		true
+	>(rhs.getExpression(), lhs);
+}
+
+/** Division operator.
+ *
+ *  @param lhs Left hand side.
+ *  @param rhs Scalar right hand side.
+ *
+ *  @return Expression for the element-wise quotient. */
+template<typename Operand>
+ArrayScalarExpression<Operand, ArrayOperation::Division, false>
+operator/(
+	const ArrayExpression<Operand> &lhs,
+	const typename Operand::ValueType &rhs
+){
+	return ArrayScalarExpression<
+		Operand,
+		ArrayOperation::Division,
+		false
+	>(lhs.getExpression(), rhs);
+}
+
+template<typename Expression>
+inline const Expression& ArrayExpression<Expression>::getExpression() const{
+	return static_cast<const Expression&>(*this);
+}
+
+template<typename Expression>
+inline void ArrayExpression<Expression>::assertCompatibleRanges(
+	const std::vector<unsigned int> &lhs,
+	const std::vector<unsigned int> &rhs,
+	const std::string &functionName
+){
+	TBTKAssert(
+		lhs.size() == rhs.size(),
+		"Array::" + functionName,
+		"Incompatible ranges.",
+		"Left and right hand sides must have the same number of"
+		<< " dimensions."
+	);
+	for(unsigned int n = 0; n < lhs.size(); n++){
+		TBTKAssert(
+			lhs[n] == rhs[n],
+			"Array::" + functionName,
+			"Incompatible ranges.",
+			"Left and right hand sides must have the same ranges."
+		);
+	}
+}
+
+template<typename LeftOperand, typename RightOperand, typename Operation>
+inline ArrayBinaryExpression<
+	LeftOperand,
+	RightOperand,
+	Operation
+>::ArrayBinaryExpression(
+	const LeftOperand &lhs,
+	const RightOperand &rhs,
+	const std::string &functionName
+) :
+	lhs(lhs),
+	rhs(rhs)
+{
+	this->assertCompatibleRanges(
+		lhs.getRanges(),
+		rhs.getRanges(),
+		functionName
+	);
+}
+
+template<typename LeftOperand, typename RightOperand, typename Operation>
+inline typename ArrayBinaryExpression<
+	LeftOperand,
+	RightOperand,
+	Operation
+>::ValueType ArrayBinaryExpression<
+	LeftOperand,
+	RightOperand,
+	Operation
+>::operator[](unsigned int n) const{
+	return Operation::template apply<ValueType>(lhs[n], rhs[n]);
+}
+
+template<typename LeftOperand, typename RightOperand, typename Operation>
+inline unsigned int ArrayBinaryExpression<
+	LeftOperand,
+	RightOperand,
+	Operation
+>::getSize() const{
+	return lhs.getSize();
+}
+
+template<typename LeftOperand, typename RightOperand, typename Operation>
+inline const std::vector<unsigned int>& ArrayBinaryExpression<
+	LeftOperand,
+	RightOperand,
+	Operation
+>::getRanges() const{
+	return lhs.getRanges();
+}
+
+template<typename Operand, typename Operation, bool scalarIsLeftOperand>
+inline ArrayScalarExpression<
+	Operand,
+	Operation,
+	scalarIsLeftOperand
+>::ArrayScalarExpression(
+	const Operand &operand,
+	const ValueType &scalar
+) :
+	operand(operand),
+	scalar(scalar)
+{
+}
+
+template<typename Operand, typename Operation, bool scalarIsLeftOperand>
+inline typename ArrayScalarExpression<
+	Operand,
+	Operation,
+	scalarIsLeftOperand
+>::ValueType ArrayScalarExpression<
+	Operand,
+	Operation,
+	scalarIsLeftOperand
+>::operator[](unsigned int n) const{
+	if(scalarIsLeftOperand)
+		return Operation::template apply<ValueType>(scalar, operand[n]);
+	else
+		return Operation::template apply<ValueType>(operand[n], scalar);
+}
+
+template<typename Operand, typename Operation, bool scalarIsLeftOperand>
+inline unsigned int ArrayScalarExpression<
+	Operand,
+	Operation,
+	scalarIsLeftOperand
+>::getSize() const{
+	return operand.getSize();
+}
+
+template<typename Operand, typename Operation, bool scalarIsLeftOperand>
+inline const std::vector<unsigned int>& ArrayScalarExpression<
+	Operand,
+	Operation,
+	scalarIsLeftOperand
+>::getRanges() const{
+	return operand.getRanges();
+}
+
+}; //End of namesapce TBTK
+
+#endif
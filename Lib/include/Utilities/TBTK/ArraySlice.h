@@ -0,0 +1,312 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file ArraySlice.h
+ *  @brief Strided view into an Array.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_ARRAY_SLICE
+#define COM_DAFER45_TBTK_ARRAY_SLICE
+
+#include "TBTK/ArrayExpression.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Strided view into an Array.
+ *
+ *  The ArraySlice refers to a subset of the elements of an Array without
+ *  copying them. It is obtained through Array::getSliceView() and is only
+ *  valid as long as the Array it was created from is alive and has not been
+ *  resized. Element n along dimension d is located at a distance
+ *  n*getStrides()[d] from the first element returned by getData(), which
+ *  allows for tight loops over the elements without going through the
+ *  subscript operators.
+ *
+ *  Assignment to an ArraySlice writes to the elements of the underlying
+ *  Array, and ArraySlices can be used as operands in Array expressions. For
+ *  an ArraySlice<const DataType> only read access is possible. */
+template<typename DataType>
+class ArraySlice : public ArrayExpression<ArraySlice<DataType>>{
+public:
+	/** Type of the elements. */
+	typedef typename std::remove_const<DataType>::type ValueType;
+
+	/** Constructor.
+	 *
+	 *  @param data Pointer to the first element.
+	 *  @param ranges The ranges of the slice.
+	 *  @param strides The distance between consecutive elements along
+	 *  each dimension. */
+	ArraySlice(
+		DataType *data,
+		const std::vector<unsigned int> &ranges,
+		const std::vector<unsigned int> &strides
+	);
+
+	/** Assignment operator. Copies the elements of the right hand side
+	 *  into the elements referred to by the ArraySlice.
+	 *
+	 *  @param rhs The ArraySlice to copy the elements from.
+	 *
+	 *  @return The ArraySlice. */
+	ArraySlice& operator=(const ArraySlice &rhs);
+
+	/** Assignment operator. Evaluates the expression into the elements
+	 *  referred to by the ArraySlice.
+	 *
+	 *  @param rhs The expression.
+	 *
+	 *  @return The ArraySlice. */
+	template<typename Expression>
+	ArraySlice& operator=(const ArrayExpression<Expression> &rhs);
+
+	/** Addition assignment operator.
+	 *
+	 *  @param rhs The expression to add.
+	 *
+	 *  @return The ArraySlice. */
+	template<typename Expression>
+	ArraySlice& operator+=(const ArrayExpression<Expression> &rhs);
+
+	/** Subtraction assignment operator.
+	 *
+	 *  @param rhs The expression to subtract.
+	 *
+	 *  @return The ArraySlice. */
+	template<typename Expression>
+	ArraySlice& operator-=(const ArrayExpression<Expression> &rhs);
+
+	/** Multiplication assignment operator.
+	 *
+	 *  @param rhs The scalar to multiply by.
+	 *
+	 *  @return The ArraySlice. */
+	ArraySlice& operator*=(const ValueType &rhs);
+
+	/** Division assignment operator.
+	 *
+	 *  @param rhs The scalar to divide by.
+	 *
+	 *  @return The ArraySlice. */
+	ArraySlice& operator/=(const ValueType &rhs);
+
+	/** Array subscript operator.
+	 *
+	 *  @param index One subindex per dimension of the slice.
+	 *
+	 *  @return The element. */
+	DataType& operator[](
+		const std::initializer_list<unsigned int> &index
+	) const;
+
+	/** Array subscript operator. The linear index is calculated in the
+	 *  same way as for Array::operator[](unsigned int n), using the
+	 *  ranges of the slice.
+	 *
+	 *  @param n Linear index of the element.
+	 *
+	 *  @return The element. */
+	DataType& operator[](unsigned int n) const;
+
+	/** Get the number of elements.
+	 *
+	 *  @return The number of elements. */
+	unsigned int getSize() const;
+
+	/** Get the ranges.
+	 *
+	 *  @return The ranges. */
+	const std::vector<unsigned int>& getRanges() const;
+
+	/** Get the strides.
+	 *
+	 *  @return The distance between consecutive elements along each
+	 *  dimension. */
+	const std::vector<unsigned int>& getStrides() const;
+
+	/** Get a pointer to the first element.
+	 *
+	 *  @return Pointer to the first element. */
+	DataType* getData() const;
+private:
+	/** Pointer to the first element. */
+	DataType *data;
+
+	/** Ranges. */
+	std::vector<unsigned int> ranges;
+
+	/** Strides. */
+	std::vector<unsigned int> strides;
+
+	/** Number of elements. */
+	unsigned int size;
+};
+
+template<typename DataType>
+inline ArraySlice<DataType>::ArraySlice(
+	DataType *data,
+	const std::vector<unsigned int> &ranges,
+	const std::vector<unsigned int> &strides
+) :
+	data(data),
+	ranges(ranges),
+	strides(strides)
+{
+	TBTKAssert(
+		ranges.size() == strides.size(),
+		"ArraySlice::ArraySlice()",
+		"Incompatible ranges and strides.",
+		"'ranges' and 'strides' must have the same number of"
+		<< " dimensions."
+	);
+
+	size = 1;
+	for(unsigned int n = 0; n < ranges.size(); n++)
+		size *= ranges[n];
+}
+
+template<typename DataType>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator=(
+	const ArraySlice &rhs
+){
+	return operator=<ArraySlice>(rhs);
+}
+
+template<typename DataType>
+template<typename Expression>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	this->assertCompatibleRanges(
+		ranges,
+		expression.getRanges(),
+		"operator=()"
+	);
+	for(unsigned int n = 0; n < size; n++)
+		operator[](n) = expression[n];
+
+	return *this;
+}
+
+template<typename DataType>
+template<typename Expression>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator+=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	this->assertCompatibleRanges(
+		ranges,
+		expression.getRanges(),
+		"operator+=()"
+	);
+	for(unsigned int n = 0; n < size; n++)
+		operator[](n) += expression[n];
+
+	return *this;
+}
+
+template<typename DataType>
+template<typename Expression>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator-=(
+	const ArrayExpression<Expression> &rhs
+){
+	const Expression &expression = rhs.getExpression();
+	this->assertCompatibleRanges(
+		ranges,
+		expression.getRanges(),
+		"operator-=()"
+	);
+	for(unsigned int n = 0; n < size; n++)
+		operator[](n) -= expression[n];
+
+	return *this;
+}
+
+template<typename DataType>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator*=(
+	const ValueType &rhs
+){
+	for(unsigned int n = 0; n < size; n++)
+		operator[](n) *= rhs;
+
+	return *this;
+}
+
+template<typename DataType>
+inline ArraySlice<DataType>& ArraySlice<DataType>::operator/=(
+	const ValueType &rhs
+){
+	for(unsigned int n = 0; n < size; n++)
+		operator[](n) /= rhs;
+
+	return *this;
+}
+
+template<typename DataType>
+inline DataType& ArraySlice<DataType>::operator[](
+	const std::initializer_list<unsigned int> &index
+) const{
+	unsigned int offset = 0;
+	for(unsigned int n = 0; n < index.size(); n++)
+		offset += *(index.begin() + n)*strides[n];
+
+	return data[offset];
+}
+
+template<typename DataType>
+inline DataType& ArraySlice<DataType>::operator[](unsigned int n) const{
+	unsigned int offset = 0;
+	for(int c = ranges.size() - 1; c >= 0; c--){
+		offset += (n%ranges[c])*strides[c];
+		n /= ranges[c];
+	}
+
+	return data[offset];
+}
+
+template<typename DataType>
+inline unsigned int ArraySlice<DataType>::getSize() const{
+	return size;
+}
+
+template<typename DataType>
+inline const std::vector<unsigned int>& ArraySlice<DataType>::getRanges(
+) const{
+	return ranges;
+}
+
+template<typename DataType>
+inline const std::vector<unsigned int>& ArraySlice<DataType>::getStrides(
+) const{
+	return strides;
+}
+
+template<typename DataType>
+inline DataType* ArraySlice<DataType>::getData() const{
+	return data;
+}
+
+}; //End of namesapce TBTK
+
+#endif
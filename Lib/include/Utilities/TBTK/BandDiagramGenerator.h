@@ -25,7 +25,9 @@
 
 #include "TBTK/ReciprocalLattice.h"
 
+#include <complex>
 #include <initializer_list>
+#include <string>
 #include <vector>
 
 namespace TBTK{
@@ -38,7 +40,37 @@ public:
 	/** Set ReciprocalLattice. */
 	void setReciprocalLattice(const ReciprocalLattice &reciprocalLattice);
 
-	/** Generate band diagram. */
+	/** Set an energy window. Only eigenvalues inside the window
+	 *  [lowerBound, upperBound] are kept and the remaining entries of the
+	 *  band diagram are set to NaN. This keeps the band labels consistent
+	 *  along the path.
+	 *
+	 *  @param lowerBound The lower bound of the energy window.
+	 *  @param upperBound The upper bound of the energy window. */
+	void setEnergyWindow(double lowerBound, double upperBound);
+
+	/** Set a file to stream the band diagram to. If set, the band
+	 *  diagram is written to the file as it is calculated, one line per
+	 *  k-point, and generateBandDiagram() returns an empty band diagram.
+	 *  This keeps the memory usage bounded for very fine paths. Pass an
+	 *  empty string to disable streaming.
+	 *
+	 *  @param filename The file to write the band diagram to. */
+	void setOutputFile(const std::string &filename);
+
+	/** Generate band diagram. The k-points are distributed over the
+	 *  available threads and only the eigenvalues are calculated.
+	 *
+	 *  @param kPoints The corners of the path through the Brillouin zone.
+	 *  @param resolution The number of k-points on each segment of the
+	 *  path.
+	 *  @param nestingVectors Vectors to add to the path to also obtain
+	 *  the bands for nested k-points.
+	 *
+	 *  @return The band diagram, with one vector per band and nesting
+	 *  vector. The bands for the n:th nesting vector are stored at
+	 *  position n*numBands + band, where n = 0 corresponds to no nesting.
+	 *  Empty if an output file has been set. */
 	std::vector<std::vector<double>> generateBandDiagram(
 		std::initializer_list<std::initializer_list<double>> kPoints,
 		unsigned int resolution,
@@ -47,6 +79,38 @@ public:
 private:
 	/** Pointer to ReciprocalLattice. */
 	const ReciprocalLattice *reciprocalLattice;
+
+	/** Lower bound of the energy window. */
+	double lowerBound;
+
+	/** Upper bound of the energy window. */
+	double upperBound;
+
+	/** File to stream the band diagram to. */
+	std::string outputFile;
+
+	/** Number of k-points that are diagonalized before the result is
+	 *  written to the output file. */
+	static constexpr unsigned int CHUNK_SIZE = 1024;
+
+	/** Workspace used by each thread to calculate eigenvalues. */
+	class Workspace{
+	public:
+		/** Constructor. */
+		Workspace(unsigned int numBands);
+
+		/** Packed upper triangular Hamiltonian. */
+		std::vector<std::complex<double>> hamiltonian;
+
+		/** Eigenvalues. */
+		std::vector<double> eigenValues;
+
+		/** Complex LAPACK workspace. */
+		std::vector<std::complex<double>> work;
+
+		/** Real LAPACK workspace. */
+		std::vector<double> rwork;
+	};
 };
 
 inline void BandDiagramGenerator::setReciprocalLattice(
@@ -55,6 +119,18 @@ inline void BandDiagramGenerator::setReciprocalLattice(
 	this->reciprocalLattice = &reciprocalLattice;
 }
 
+inline void BandDiagramGenerator::setEnergyWindow(
+	double lowerBound,
+	double upperBound
+){
+	this->lowerBound = lowerBound;
+	this->upperBound = upperBound;
+}
+
+inline void BandDiagramGenerator::setOutputFile(const std::string &filename){
+	outputFile = filename;
+}
+
 };	//End of namespace TBTK
 
 #endif
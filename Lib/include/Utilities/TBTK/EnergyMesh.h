@@ -0,0 +1,126 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file EnergyMesh.h
+ *  @brief Generates non-uniform energy meshes.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_ENERGY_MESH
+#define COM_DAFER45_TBTK_ENERGY_MESH
+
+#include <vector>
+
+namespace TBTK{
+
+/** @brief Generates non-uniform energy meshes.
+ *
+ *  The EnergyMesh generates energies and Matsubara energy indices that can
+ *  be used to create EnergyResolvedProperties with non-uniform energy
+ *  meshes or sparse sets of Matsubara energies. Such meshes resolve the
+ *  regions where a property varies rapidly using far fewer points than a
+ *  uniform mesh with the same resolution. */
+class EnergyMesh{
+public:
+	/** Generate a mesh that is logarithmically dense around a given
+	 *  energy. On each side of the center, the distance from the center
+	 *  grows geometrically from 'minimumSpacing' to the distance to the
+	 *  bound.
+	 *
+	 *  @param lowerBound The lowest energy in the mesh.
+	 *  @param upperBound The highest energy in the mesh.
+	 *  @param center The energy around which the mesh is dense. Must lie
+	 *  between the bounds.
+	 *
+	 *  @param minimumSpacing The distance between the center and its
+	 *  closest neighbors.
+	 *
+	 *  @param numPointsPerSide The number of energies on each side of the
+	 *  center.
+	 *
+	 *  @return Strictly increasing energies. */
+	static std::vector<double> generateLogarithmicMesh(
+		double lowerBound,
+		double upperBound,
+		double center,
+		double minimumSpacing,
+		unsigned int numPointsPerSide
+	);
+
+	/** Generate a mesh that adapts its spacing to the distance to a set
+	 *  of features, such as band edges or peaks. The spacing at an energy
+	 *  is 'growthRate' times the distance to the closest feature, limited
+	 *  to lie between 'minimumSpacing' and 'maximumSpacing'. The features
+	 *  that lie between the bounds are included in the mesh.
+	 *
+	 *  @param lowerBound The lowest energy in the mesh.
+	 *  @param upperBound The highest energy in the mesh.
+	 *  @param features The energies around which the mesh is dense.
+	 *  @param minimumSpacing The smallest spacing.
+	 *  @param maximumSpacing The largest spacing.
+	 *  @param growthRate The rate with which the spacing grows with the
+	 *  distance to the closest feature.
+	 *
+	 *  @return Strictly increasing energies. */
+	static std::vector<double> generateAdaptiveMesh(
+		double lowerBound,
+		double upperBound,
+		const std::vector<double> &features,
+		double minimumSpacing,
+		double maximumSpacing,
+		double growthRate = 0.5
+	);
+
+	/** Generate a sparse set of Matsubara energy indices between two
+	 *  bounds. The Matsubara energies closest to zero are all included,
+	 *  after which the Matsubara energy indices grow geometrically. The
+	 *  bounds are always included. The indices are odd if the bounds are
+	 *  odd (fermionic) and even if the bounds are even (bosonic).
+	 *
+	 *  Sums over a sparse set of Matsubara energies are accurate as long
+	 *  as the summand varies slowly between the included Matsubara
+	 *  energies. For example, when the self-energy is calculated from an
+	 *  interaction vertex on a sparse set of bosonic Matsubara energies,
+	 *  the contiguous Matsubara energies should extend beyond the
+	 *  fermionic Matsubara energies that the self-energy is calculated
+	 *  for, since the propagator in the sum is peaked there.
+	 *
+	 *  @param lowerMatsubaraEnergyIndex The lowest Matsubara energy index.
+	 *  @param upperMatsubaraEnergyIndex The highest Matsubara energy
+	 *  index.
+	 *
+	 *  @param numContiguousMatsubaraEnergies The number of non-negative
+	 *  Matsubara energies closest to zero that are all included. The
+	 *  Matsubara energies closest to zero are included also if this is
+	 *  zero.
+	 *
+	 *  @param numMatsubaraEnergiesPerDecade The number of Matsubara
+	 *  energies per factor ten in the Matsubara energy index beyond the
+	 *  contiguous Matsubara energies.
+	 *
+	 *  @return Strictly increasing Matsubara energy indices. */
+	static std::vector<int> generateSparseMatsubaraEnergyIndices(
+		int lowerMatsubaraEnergyIndex,
+		int upperMatsubaraEnergyIndex,
+		unsigned int numContiguousMatsubaraEnergies,
+		unsigned int numMatsubaraEnergiesPerDecade
+	);
+};
+
+};	//End of namespace TBTK
+
+#endif
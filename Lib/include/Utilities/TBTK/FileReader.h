@@ -177,6 +177,9 @@ public:
 	/** Set input file name. Default is TBTKResults.h5. */
 	static void setFileName(std::string filename);
 
+	/** Get input file name. */
+	static const std::string& getFileName();
+
 	/** Remove any file from the current folder with the file name set by
 	 *  FileReader::setFileName*/
 	static void clear();
@@ -203,6 +206,10 @@ inline void FileReader::setFileName(std::string filename){
 	isInitialized = false;
 }
 
+inline const std::string& FileReader::getFileName(){
+	return filename;
+}
+
 inline void FileReader::clear(){
 	remove(filename.c_str());
 	isInitialized = false;
@@ -39,6 +39,13 @@
 #include <fstream>
 #include <stdio.h>
 
+namespace H5{
+	class DataSet;
+	class DataSpace;
+	class H5File;
+	class PredType;
+};
+
 namespace TBTK{
 
 /** Writes data to a .hdf5-file. The default file name is TBTKResults.h5. Can
@@ -47,9 +54,84 @@ namespace TBTK{
  *  eigenvalues, DOS, Density etc. extracted by the PropertyExtractor. In the
  *  later case the data can immediately be plotted using the bundled python
  *  plotting scripts.
+ *
+ *  By default every write opens and closes the file and the data is written
+ *  uncompressed and contiguously in big-endian format. Between calls to
+ *  beginSession() and endSession() the file is instead kept open, and the
+ *  datasets are written in native byte order using chunked storage with the
+ *  filters set by setCompression() and setShuffle(). Large datasets can
+ *  also be written in parts using createDataSet() and writeHyperslab().
  */
 class FileWriter{
 public:
+	/** Enum class for specifying compression filter. */
+	enum class Compression {None, GZip, SZip};
+
+	/** Begin a session. The file is kept open until endSession() is
+	 *  called and datasets are written in native byte order with chunked
+	 *  storage and the filters set by setCompression() and setShuffle().
+	 */
+	static void beginSession();
+
+	/** End a session and close the file. */
+	static void endSession();
+
+	/** Set the compression filter to use for datasets written during a
+	 *  session.
+	 *
+	 *  @param compression The compression filter.
+	 *  @param level The compression level. For GZip this is the deflate
+	 *  level 0-9, while for SZip it is the number of pixels per block. */
+	static void setCompression(
+		Compression compression,
+		unsigned int level = 6
+	);
+
+	/** Set whether the shuffle filter should be applied before
+	 *  compression for datasets written during a session.
+	 *
+	 *  @param shuffle Whether to use the shuffle filter. */
+	static void setShuffle(bool shuffle);
+
+	/** Set the maximum number of elements in a chunk for datasets written
+	 *  during a session. The chunks extend over the full range of the
+	 *  trailing dimensions first, such that an LDOS is chunked by site
+	 *  blocks.
+	 *
+	 *  @param chunkSize The maximum number of elements per chunk. */
+	static void setChunkSize(unsigned int chunkSize);
+
+	/** Create an empty n-dimensional dataset of type double that can be
+	 *  written to in parts using writeHyperslab().
+	 *
+	 *  @param rank The number of dimensions.
+	 *  @param dims The size of the dataset in each dimension.
+	 *  @param name The name of the dataset.
+	 *  @param path The path of the dataset. */
+	static void createDataSet(
+		int rank,
+		const int *dims,
+		std::string name,
+		std::string path = "/"
+	);
+
+	/** Write a block of data to a dataset created with createDataSet().
+	 *
+	 *  @param data The data to write, stored in row major order.
+	 *  @param rank The number of dimensions of the dataset.
+	 *  @param offset The offset of the block in each dimension.
+	 *  @param count The size of the block in each dimension.
+	 *  @param name The name of the dataset.
+	 *  @param path The path of the dataset. */
+	static void writeHyperslab(
+		const double *data,
+		int rank,
+		const int *offset,
+		const int *count,
+		std::string name,
+		std::string path = "/"
+	);
+
 	/** Write model to file. */
 	static void writeModel(
 		const Model &model,
@@ -203,6 +285,33 @@ private:
 
 	/** File name of file to write to. */
 	static std::string filename;
+
+	/** File kept open during a session. */
+	static H5::H5File *sessionFile;
+
+	/** Compression filter used during a session. */
+	static Compression compression;
+
+	/** Compression level used during a session. */
+	static unsigned int compressionLevel;
+
+	/** Flag indicating whether the shuffle filter is used during a
+	 *  session. */
+	static bool shuffle;
+
+	/** Maximum number of elements per chunk used during a session. */
+	static unsigned int chunkSize;
+
+	/** Create a dataset in the given file. Outside of a session the
+	 *  dataset is created contiguously with the given file type. During a
+	 *  session the corresponding native type, chunked storage and the
+	 *  session filters are used instead. */
+	static H5::DataSet createDataSet(
+		H5::H5File &file,
+		const std::string &name,
+		const H5::PredType &fileType,
+		const H5::DataSpace &dataspace
+	);
 };
 
 inline void FileWriter::writeSpectralFunction(
@@ -213,12 +322,49 @@ inline void FileWriter::writeSpectralFunction(
 	writeLDOS(spectralFunction, name, path);
 }
 
+inline void FileWriter::setCompression(
+	Compression compression,
+	unsigned int level
+){
+	FileWriter::compression = compression;
+	compressionLevel = level;
+}
+
+inline void FileWriter::setShuffle(bool shuffle){
+	FileWriter::shuffle = shuffle;
+}
+
+inline void FileWriter::setChunkSize(unsigned int chunkSize){
+	TBTKAssert(
+		chunkSize > 0,
+		"FileWriter::setChunkSize()",
+		"The chunk size must be larger than zero.",
+		""
+	);
+
+	FileWriter::chunkSize = chunkSize;
+}
+
 inline void FileWriter::setFileName(std::string filename){
+	TBTKAssert(
+		sessionFile == nullptr,
+		"FileWriter::setFileName()",
+		"Unable to change file name during a session.",
+		"Call FileWriter::endSession() first."
+	);
+
 	FileWriter::filename = filename;
 	isInitialized = false;
 }
 
 inline void FileWriter::clear(){
+	TBTKAssert(
+		sessionFile == nullptr,
+		"FileWriter::clear()",
+		"Unable to clear the file during a session.",
+		"Call FileWriter::endSession() first."
+	);
+
 	remove(filename.c_str());
 	isInitialized = false;
 }
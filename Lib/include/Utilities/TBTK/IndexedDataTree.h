@@ -136,6 +136,11 @@ private:
 
 		/** Inequality operator. */
 		bool operator!=(const _Iterator &rhs) const;
+
+		/** Get the Index of the element that the Iterator points to.
+		 *
+		 *  @return The Index of the current element. */
+		const Index& getCurrentIndex() const;
 	private:
 		/** Typedef to allow for pointers to const and non-const
 		 *  depending on Iterator type. */
@@ -341,6 +346,11 @@ private:
 
 		/** Inequality operator. */
 		bool operator!=(const _Iterator &rhs) const;
+
+		/** Get the Index of the element that the Iterator points to.
+		 *
+		 *  @return The Index of the current element. */
+		const Index& getCurrentIndex() const;
 	private:
 		/** Typedef to allow for pointers to const and non-const
 		 *  depending on Iterator type. */
@@ -546,6 +556,11 @@ private:
 
 		/** Inequality operator. */
 		bool operator!=(const _Iterator &rhs) const;
+
+		/** Get the Index of the element that the Iterator points to.
+		 *
+		 *  @return The Index of the current element. */
+		const Index& getCurrentIndex() const;
 	private:
 		/** Typedef to allow for pointers to const and non-const
 		 *  depending on Iterator type. */
@@ -2555,6 +2570,20 @@ bool IndexedDataTree<Data, false>::_Iterator<isConstIterator>::operator!=(
 	}
 }
 
+template<typename Data> template<bool isConstIterator>
+const Index& IndexedDataTree<Data, true>::_Iterator<
+	isConstIterator
+>::getCurrentIndex() const{
+	return currentIndex;
+}
+
+template<typename Data> template<bool isConstIterator>
+const Index& IndexedDataTree<Data, false>::_Iterator<
+	isConstIterator
+>::getCurrentIndex() const{
+	return currentIndex;
+}
+
 template<typename Data> template<bool isConstIterator>
 IndexedDataTree<Data, true>::_Iterator<isConstIterator>::_Iterator(
 	IndexedDataTreePointerType indexedDataTree,
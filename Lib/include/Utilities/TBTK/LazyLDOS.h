@@ -0,0 +1,262 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file LazyLDOS.h
+ *  @brief Local density of states that is read from file on demand.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_LAZY_LDOS
+#define COM_DAFER45_TBTK_LAZY_LDOS
+
+#include "TBTK/Index.h"
+#include "TBTK/IndexTree.h"
+#include "TBTK/Property/IndexDescriptor.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace H5{
+	class DataSet;
+	class H5File;
+};
+
+namespace TBTK{
+
+/** @brief Local density of states that is read from file on demand.
+ *
+ *  The LazyLDOS provides read access to an LDOS that has been written to
+ *  file using FileWriter::writeLDOS(), without loading the full dataset into
+ *  memory. The dataset is kept open and the data is read in blocks of sites
+ *  using hyperslab selections. The most recently used blocks are kept in a
+ *  least recently used (LRU) cache, such that browsing nearby sites does not
+ *  result in repeated reads. The file is the one set by
+ *  FileReader::setFileName() and is kept open in read only mode for the
+ *  lifetime of the LazyLDOS. The FileWriter can therefore not write to the
+ *  same file while the LazyLDOS exists. */
+class LazyLDOS{
+public:
+	/** Constructor.
+	 *
+	 *  @param name The name of the LDOS in the file.
+	 *  @param path The path of the LDOS in the file.
+	 *  @param blockSize The maximum number of elements read into a single
+	 *  cache block.
+	 *  @param cacheSize The maximum number of blocks in the cache. */
+	LazyLDOS(
+		std::string name = "LDOS",
+		std::string path = "/",
+		unsigned int blockSize = 1 << 16,
+		unsigned int cacheSize = 16
+	);
+
+	/** Copy constructor deleted since the LazyLDOS holds an open file. */
+	LazyLDOS(const LazyLDOS &lazyLDOS) = delete;
+
+	/** Destructor. */
+	~LazyLDOS();
+
+	/** Assignment operator deleted since the LazyLDOS holds an open
+	 *  file. */
+	LazyLDOS& operator=(const LazyLDOS &rhs) = delete;
+
+	/** Get the storage format of the LDOS.
+	 *
+	 *  @return The IndexDescriptor::Format. */
+	IndexDescriptor::Format getFormat() const;
+
+	/** Get the ranges of the LDOS. Only valid for the Ranges format.
+	 *
+	 *  @return The ranges. */
+	const std::vector<int>& getRanges() const;
+
+	/** Get the lower bound of the energy interval.
+	 *
+	 *  @return The lower bound. */
+	double getLowerBound() const;
+
+	/** Get the upper bound of the energy interval.
+	 *
+	 *  @return The upper bound. */
+	double getUpperBound() const;
+
+	/** Get the energy resolution.
+	 *
+	 *  @return The number of energy points. */
+	unsigned int getResolution() const;
+
+	/** Get the number of sites.
+	 *
+	 *  @return The number of sites. */
+	unsigned int getNumSites() const;
+
+	/** Get the linear site index for a given Index. For the Ranges
+	 *  format the subindices are interpreted as coordinates in the grid
+	 *  specified by the ranges.
+	 *
+	 *  @param index The Index.
+	 *
+	 *  @return The linear site index. */
+	unsigned int getSite(const Index &index) const;
+
+	/** Get the LDOS at a given Index and energy.
+	 *
+	 *  @param index The Index.
+	 *  @param n The energy index.
+	 *
+	 *  @return The LDOS. */
+	double operator()(const Index &index, unsigned int n) const;
+
+	/** Get the LDOS for all energies at a given Index.
+	 *
+	 *  @param index The Index.
+	 *
+	 *  @return The LDOS for each energy. */
+	std::vector<double> getData(const Index &index) const;
+
+	/** Get the LDOS at a given energy for all sites. The data is read
+	 *  directly from the file using a strided hyperslab and is not
+	 *  cached.
+	 *
+	 *  @param n The energy index.
+	 *
+	 *  @return The LDOS for each site, ordered by linear site index. */
+	std::vector<double> getDataAtEnergy(unsigned int n) const;
+private:
+	/** File containing the LDOS. */
+	H5::H5File *file;
+
+	/** Dataset containing the LDOS. */
+	H5::DataSet *dataset;
+
+	/** Storage format. */
+	IndexDescriptor::Format format;
+
+	/** Ranges for the Ranges format. */
+	std::vector<int> ranges;
+
+	/** IndexTree for the Custom format. */
+	IndexTree *indexTree;
+
+	/** Lower bound of the energy interval. */
+	double lowerBound;
+
+	/** Upper bound of the energy interval. */
+	double upperBound;
+
+	/** Energy resolution. */
+	unsigned int resolution;
+
+	/** Number of sites. */
+	unsigned int numSites;
+
+	/** The data is read in blocks of rows, where a row is a range of
+	 *  the outermost dimension in the file. For the Custom format a row
+	 *  is a single site. */
+	unsigned int sitesPerRow;
+
+	/** Number of rows. */
+	unsigned int numRows;
+
+	/** Number of rows per block. */
+	unsigned int rowsPerBlock;
+
+	/** Maximum number of blocks in the cache. */
+	unsigned int cacheSize;
+
+	/** Cached blocks, stored together with their position in
+	 *  leastRecentlyUsed. */
+	mutable std::map<
+		unsigned int,
+		std::pair<std::vector<double>, std::list<unsigned int>::iterator>
+	> cache;
+
+	/** Cached block indices ordered from most to least recently used. */
+	mutable std::list<unsigned int> leastRecentlyUsed;
+
+	/** Get block from the cache, reading it from file if necessary.
+	 *
+	 *  @param block The block index.
+	 *
+	 *  @return The data in the block. */
+	const std::vector<double>& getBlock(unsigned int block) const;
+
+	/** Read rows from file.
+	 *
+	 *  @param firstRow The first row to read.
+	 *  @param numRowsToRead The number of rows to read.
+	 *
+	 *  @return The data in the rows. */
+	std::vector<double> readRows(
+		unsigned int firstRow,
+		unsigned int numRowsToRead
+	) const;
+};
+
+inline IndexDescriptor::Format LazyLDOS::getFormat() const{
+	return format;
+}
+
+inline const std::vector<int>& LazyLDOS::getRanges() const{
+	TBTKAssert(
+		format == IndexDescriptor::Format::Ranges,
+		"LazyLDOS::getRanges()",
+		"The LDOS is not of the format IndexDescriptor::Format::Ranges.",
+		""
+	);
+
+	return ranges;
+}
+
+inline double LazyLDOS::getLowerBound() const{
+	return lowerBound;
+}
+
+inline double LazyLDOS::getUpperBound() const{
+	return upperBound;
+}
+
+inline unsigned int LazyLDOS::getResolution() const{
+	return resolution;
+}
+
+inline unsigned int LazyLDOS::getNumSites() const{
+	return numSites;
+}
+
+inline double LazyLDOS::operator()(const Index &index, unsigned int n) const{
+	TBTKAssert(
+		n < resolution,
+		"LazyLDOS::operator()",
+		"Energy index out of range. The energy index is '" << n << "',"
+		<< " but the resolution is '" << resolution << "'.",
+		""
+	);
+
+	unsigned int site = getSite(index);
+	unsigned int rowsPerBlockSites = rowsPerBlock*sitesPerRow;
+	const std::vector<double> &block = getBlock(site/rowsPerBlockSites);
+
+	return block[(site%rowsPerBlockSites)*resolution + n];
+}
+
+};	//End of namespace TBTK
+
+#endif
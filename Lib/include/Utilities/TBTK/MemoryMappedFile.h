@@ -0,0 +1,136 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @package TBTKcalc
+ *  @file MemoryMappedFile.h
+ *  @brief File that is mapped into memory.
+ *
+ *  @author Kristofer Björnson
+ */
+
+#ifndef COM_DAFER45_TBTK_MEMORY_MAPPED_FILE
+#define COM_DAFER45_TBTK_MEMORY_MAPPED_FILE
+
+#include <string>
+
+namespace TBTK{
+
+/** @brief File that is mapped into memory.
+ *
+ *  The MemoryMappedFile maps a file into the address space of the process,
+ *  such that the content of the file can be accessed as an ordinary array
+ *  without first reading it into memory. Pages are loaded by the operating
+ *  system when they are accessed and modified pages are written back to the
+ *  file, which makes it possible to work with data that is larger than the
+ *  available RAM. The file is unmapped and closed when the MemoryMappedFile
+ *  is destroyed. */
+class MemoryMappedFile{
+public:
+	/** Enum class for specifying the access mode. */
+	enum class Mode {ReadOnly, ReadWrite};
+
+	/** Constructor. Creates a file of the given size and maps it into
+	 *  memory with read and write access. If the file already exists, it
+	 *  is truncated.
+	 *
+	 *  @param filename The name of the file.
+	 *  @param size The size of the file in bytes. */
+	MemoryMappedFile(const std::string &filename, size_t size);
+
+	/** Constructor. Maps an existing file into memory.
+	 *
+	 *  @param filename The name of the file.
+	 *  @param mode The access mode. */
+	MemoryMappedFile(const std::string &filename, Mode mode);
+
+	/** Copy constructor deleted since the MemoryMappedFile holds an open
+	 *  file. */
+	MemoryMappedFile(const MemoryMappedFile &memoryMappedFile) = delete;
+
+	/** Destructor. */
+	~MemoryMappedFile();
+
+	/** Assignment operator deleted since the MemoryMappedFile holds an
+	 *  open file. */
+	MemoryMappedFile& operator=(const MemoryMappedFile &rhs) = delete;
+
+	/** Get the name of the file.
+	 *
+	 *  @return The name of the file. */
+	const std::string& getFilename() const;
+
+	/** Get the access mode.
+	 *
+	 *  @return The access mode. */
+	Mode getMode() const;
+
+	/** Get the size of the file.
+	 *
+	 *  @return The size of the file in bytes. */
+	size_t getSize() const;
+
+	/** Get the mapped memory.
+	 *
+	 *  @return Pointer to the first byte of the file. */
+	const char* getData() const;
+
+	/** Get the mapped memory with write access. [Only works for
+	 *  Mode::ReadWrite.]
+	 *
+	 *  @return Pointer to the first byte of the file. */
+	char* getDataRW();
+
+	/** Write modified pages back to the file and wait for the write to
+	 *  complete. */
+	void sync();
+private:
+	/** The name of the file. */
+	std::string filename;
+
+	/** The access mode. */
+	Mode mode;
+
+	/** File descriptor. */
+	int fileDescriptor;
+
+	/** The size of the file. */
+	size_t size;
+
+	/** The mapped memory. */
+	char *data;
+
+	/** Map the opened file into memory. */
+	void map();
+};
+
+inline const std::string& MemoryMappedFile::getFilename() const{
+	return filename;
+}
+
+inline MemoryMappedFile::Mode MemoryMappedFile::getMode() const{
+	return mode;
+}
+
+inline size_t MemoryMappedFile::getSize() const{
+	return size;
+}
+
+inline const char* MemoryMappedFile::getData() const{
+	return data;
+}
+
+};	//End of namespace TBTK
+
+#endif
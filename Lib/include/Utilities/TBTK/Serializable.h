@@ -27,7 +27,11 @@
 #include "TBTK/TBTKMacros.h"
 
 #include <complex>
+#include <cstdint>
+#include <cstring>
+#include <map>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 namespace TBTK{
@@ -166,6 +170,206 @@ protected:
 		std::string component
 	);
 
+	/** Writer for serialization strings in Mode::Binary. A binary
+	 *  serialization string starts with the magic bytes "TBTK", a 32-bit
+	 *  byte order mark, and the length prefixed ID of the serialized
+	 *  class. The ID is followed by a sequence of named fields, each
+	 *  stored as the length prefixed field name, the size of the payload
+	 *  in bytes, and the payload. Lengths are stored as 32-bit and sizes
+	 *  as 64-bit unsigned integers. All numbers are stored in
+	 *  little-endian byte order, which the byte order mark records, and
+	 *  the payload of each field is aligned to eight bytes relative to
+	 *  the start of the serialization string. Components, such as the
+	 *  serialization of a parent class, are stored as string fields.
+	 *
+	 *  Integer fields should be written and read using the fixed width
+	 *  types int32_t, uint32_t, int64_t, and uint64_t, such that the
+	 *  serialization does not depend on the size of int on the host. */
+	class BinaryWriter{
+	public:
+		/** Constructor.
+		 *
+		 *  @param id The ID of the serialized class. */
+		BinaryWriter(const std::string &id);
+
+		/** Write a field containing a single number.
+		 *
+		 *  @param name The field name.
+		 *  @param value The value. */
+		template<typename DataType>
+		void write(const std::string &name, const DataType &value);
+
+		/** Write a field containing an array of numbers.
+		 *
+		 *  @param name The field name.
+		 *  @param values Pointer to the first element.
+		 *  @param size The number of elements. */
+		template<typename DataType>
+		void writeArray(
+			const std::string &name,
+			const DataType *values,
+			size_t size
+		);
+
+		/** Write a field containing an array of numbers.
+		 *
+		 *  @param name The field name.
+		 *  @param values The values. */
+		template<typename DataType>
+		void writeArray(
+			const std::string &name,
+			const std::vector<DataType> &values
+		);
+
+		/** Write a field containing a string, such as the
+		 *  serialization of a component.
+		 *
+		 *  @param name The field name.
+		 *  @param value The string. */
+		void writeString(
+			const std::string &name,
+			const std::string &value
+		);
+
+		/** Get the serialization string.
+		 *
+		 *  @return The serialization string. */
+		const std::string& getSerialization() const;
+	private:
+		/** The serialization string. */
+		std::string buffer;
+
+		/** Append the field header and padding for a field. */
+		void beginField(const std::string &name, uint64_t size);
+
+		/** Append numbers in little-endian byte order. */
+		template<typename DataType>
+		void append(const DataType *values, uint64_t size);
+	};
+
+	/** Reader for serialization strings in Mode::Binary. The reader
+	 *  indexes the fields when constructed and reads them in any order.
+	 *  The serialization string is not copied and must outlive the
+	 *  reader. */
+	class BinaryReader{
+	public:
+		/** Constructor.
+		 *
+		 *  @param serialization Serialization string created by a
+		 *  BinaryWriter. */
+		BinaryReader(const std::string &serialization);
+
+		/** Get the ID of the serialized class.
+		 *
+		 *  @return The ID. */
+		const std::string& getID() const;
+
+		/** Check whether a field exists.
+		 *
+		 *  @param name The field name.
+		 *
+		 *  @return True if the field exists. */
+		bool hasField(const std::string &name) const;
+
+		/** Read a field containing a single number.
+		 *
+		 *  @param name The field name.
+		 *
+		 *  @return The value. */
+		template<typename DataType>
+		DataType read(const std::string &name) const;
+
+		/** Read a field containing an array of numbers.
+		 *
+		 *  @param name The field name.
+		 *
+		 *  @return The values. */
+		template<typename DataType>
+		std::vector<DataType> readArray(const std::string &name) const;
+
+		/** Get a pointer to an array of numbers inside the
+		 *  serialization string without copying it. This is only
+		 *  possible on little-endian hosts when the serialization
+		 *  string is suitably aligned in memory.
+		 *
+		 *  @param name The field name.
+		 *  @param size Set to the number of elements.
+		 *
+		 *  @return Pointer to the first element, or nullptr if the
+		 *  array cannot be accessed in place. */
+		template<typename DataType>
+		const DataType* getArray(
+			const std::string &name,
+			size_t &size
+		) const;
+
+		/** Read a field containing a string.
+		 *
+		 *  @param name The field name.
+		 *
+		 *  @return The string. */
+		std::string readString(const std::string &name) const;
+	private:
+		/** The serialization string. */
+		const std::string &serialization;
+
+		/** The ID. */
+		std::string id;
+
+		/** Offset and size of each field's payload. */
+		std::map<std::string, std::pair<uint64_t, uint64_t>> fields;
+
+		/** Get the offset and size of a field's payload, checking
+		 *  that the size is a multiple of the element size. */
+		const std::pair<uint64_t, uint64_t>& getField(
+			const std::string &name,
+			uint64_t elementSize
+		) const;
+
+		/** Copy numbers stored in little-endian byte order. */
+		template<typename DataType>
+		void extractNumbers(
+			const std::pair<uint64_t, uint64_t> &field,
+			DataType *values
+		) const;
+	};
+
+	/** Parse the header of a binary serialization string.
+	 *
+	 *  @param serialization The serialization string.
+	 *  @param id Set to the ID.
+	 *  @param offset Set to the position of the first field.
+	 *
+	 *  @return True if the header was successfully parsed. */
+	static bool parseBinaryHeader(
+		const std::string &serialization,
+		std::string &id,
+		uint64_t &offset
+	);
+
+	/** Byte order mark stored after the magic bytes of a binary
+	 *  serialization string. */
+	static constexpr uint32_t binaryByteOrderMark = 0x01020304;
+
+	/** Returns true if the host stores numbers in little-endian byte
+	 *  order. */
+	static constexpr bool isLittleEndian();
+
+	/** Reverse the byte order of each unit in a buffer.
+	 *
+	 *  @param data The buffer.
+	 *  @param size The size of the buffer in bytes.
+	 *  @param unitSize The size of the units to reverse. */
+	static void swapBytes(char *data, uint64_t size, uint64_t unitSize);
+
+	/** Size of the units that are affected by the byte order, used to
+	 *  byte swap compound types such as std::complex. */
+	template<typename DataType>
+	class BinaryUnit{
+	public:
+		static constexpr uint64_t size = sizeof(DataType);
+	};
+
 	/** Friend classes (Classes that are psudo-Serializable because they
 	 *  are so small and often used that a virtual function would have a
 	 *  non-negligible performance penalty). */
@@ -174,6 +378,265 @@ protected:
 	friend class SourceAmplitude;
 };
 
+inline constexpr bool Serializable::isLittleEndian(){
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return false;
+#else
+	return true;
+#endif
+}
+
+template<typename DataType>
+class Serializable::BinaryUnit<std::complex<DataType>>{
+public:
+	static constexpr uint64_t size = sizeof(DataType);
+};
+
+inline Serializable::BinaryWriter::BinaryWriter(const std::string &id){
+	buffer = "TBTK";
+	uint32_t byteOrderMark = binaryByteOrderMark;
+	append(&byteOrderMark, 1);
+	uint32_t idLength = id.size();
+	append(&idLength, 1);
+	buffer += id;
+}
+
+template<typename DataType>
+inline void Serializable::BinaryWriter::write(
+	const std::string &name,
+	const DataType &value
+){
+	beginField(name, sizeof(DataType));
+	append(&value, 1);
+}
+
+template<>
+inline void Serializable::BinaryWriter::write<bool>(
+	const std::string &name,
+	const bool &value
+){
+	char c = value;
+	write(name, c);
+}
+
+template<>
+inline void Serializable::BinaryWriter::write<Statistics>(
+	const std::string &name,
+	const Statistics &value
+){
+	int32_t i = static_cast<int32_t>(value);
+	write(name, i);
+}
+
+template<typename DataType>
+inline void Serializable::BinaryWriter::writeArray(
+	const std::string &name,
+	const DataType *values,
+	size_t size
+){
+	beginField(name, sizeof(DataType)*(uint64_t)size);
+	append(values, size);
+}
+
+template<typename DataType>
+inline void Serializable::BinaryWriter::writeArray(
+	const std::string &name,
+	const std::vector<DataType> &values
+){
+	writeArray(name, values.data(), values.size());
+}
+
+template<>
+inline void Serializable::BinaryWriter::writeArray<bool>(
+	const std::string &name,
+	const std::vector<bool> &values
+){
+	std::vector<char> v(values.begin(), values.end());
+	writeArray(name, v);
+}
+
+inline void Serializable::BinaryWriter::writeString(
+	const std::string &name,
+	const std::string &value
+){
+	beginField(name, value.size());
+	buffer += value;
+}
+
+inline const std::string& Serializable::BinaryWriter::getSerialization(
+) const{
+	return buffer;
+}
+
+inline void Serializable::BinaryWriter::beginField(
+	const std::string &name,
+	uint64_t size
+){
+	uint32_t nameLength = name.size();
+	append(&nameLength, 1);
+	buffer += name;
+	append(&size, 1);
+	buffer.append((8 - buffer.size()%8)%8, '\0');
+}
+
+template<typename DataType>
+inline void Serializable::BinaryWriter::append(
+	const DataType *values,
+	uint64_t size
+){
+	static_assert(
+		!std::is_integral<DataType>::value
+		|| sizeof(DataType) == 1
+		|| sizeof(DataType) == 4
+		|| sizeof(DataType) == 8,
+		"Binary serialization only supports 8, 32, and 64-bit integers."
+	);
+	size_t position = buffer.size();
+	buffer.resize(position + sizeof(DataType)*size);
+	if(size == 0)
+		return;
+
+	std::memcpy(&buffer[position], values, sizeof(DataType)*size);
+	if(!isLittleEndian()){
+		swapBytes(
+			&buffer[position],
+			sizeof(DataType)*size,
+			BinaryUnit<DataType>::size
+		);
+	}
+}
+
+inline const std::string& Serializable::BinaryReader::getID() const{
+	return id;
+}
+
+inline bool Serializable::BinaryReader::hasField(
+	const std::string &name
+) const{
+	return fields.find(name) != fields.end();
+}
+
+template<typename DataType>
+inline DataType Serializable::BinaryReader::read(
+	const std::string &name
+) const{
+	const std::pair<uint64_t, uint64_t> &field
+		= getField(name, sizeof(DataType));
+	TBTKAssert(
+		field.second == sizeof(DataType),
+		"Serializable::BinaryReader::read()",
+		"The field '" << name << "' does not contain a single value.",
+		""
+	);
+
+	DataType value;
+	extractNumbers(field, &value);
+
+	return value;
+}
+
+template<>
+inline bool Serializable::BinaryReader::read<bool>(
+	const std::string &name
+) const{
+	return read<char>(name);
+}
+
+template<>
+inline Statistics Serializable::BinaryReader::read<Statistics>(
+	const std::string &name
+) const{
+	int32_t i = read<int32_t>(name);
+	switch(i){
+	case static_cast<int>(Statistics::FermiDirac):
+		return Statistics::FermiDirac;
+	case static_cast<int>(Statistics::BoseEinstein):
+		return Statistics::BoseEinstein;
+	default:
+		TBTKExit(
+			"Serializable::BinaryReader::read()",
+			"Unknown Statistics type '" << i << "'",
+			"The serialization string is either corrupted or the"
+			<< " the serialization was created with a newer"
+			<< " version of TBTK that supports more types of"
+			<< " Statistics."
+		);
+	}
+}
+
+template<typename DataType>
+inline std::vector<DataType> Serializable::BinaryReader::readArray(
+	const std::string &name
+) const{
+	const std::pair<uint64_t, uint64_t> &field
+		= getField(name, sizeof(DataType));
+	std::vector<DataType> values(field.second/sizeof(DataType));
+	extractNumbers(field, values.data());
+
+	return values;
+}
+
+template<>
+inline std::vector<bool> Serializable::BinaryReader::readArray<bool>(
+	const std::string &name
+) const{
+	std::vector<char> values = readArray<char>(name);
+
+	return std::vector<bool>(values.begin(), values.end());
+}
+
+template<typename DataType>
+inline const DataType* Serializable::BinaryReader::getArray(
+	const std::string &name,
+	size_t &size
+) const{
+	const std::pair<uint64_t, uint64_t> &field
+		= getField(name, sizeof(DataType));
+	size = field.second/sizeof(DataType);
+	const char *data = serialization.data() + field.first;
+	if(
+		!isLittleEndian()
+		|| reinterpret_cast<uintptr_t>(data)%alignof(DataType) != 0
+	){
+		return nullptr;
+	}
+
+	return reinterpret_cast<const DataType*>(data);
+}
+
+inline std::string Serializable::BinaryReader::readString(
+	const std::string &name
+) const{
+	const std::pair<uint64_t, uint64_t> &field = getField(name, 1);
+
+	return serialization.substr(field.first, field.second);
+}
+
+template<typename DataType>
+inline void Serializable::BinaryReader::extractNumbers(
+	const std::pair<uint64_t, uint64_t> &field,
+	DataType *values
+) const{
+	static_assert(
+		!std::is_integral<DataType>::value
+		|| sizeof(DataType) == 1
+		|| sizeof(DataType) == 4
+		|| sizeof(DataType) == 8,
+		"Binary serialization only supports 8, 32, and 64-bit integers."
+	);
+	if(field.second == 0)
+		return;
+
+	std::memcpy(values, serialization.data() + field.first, field.second);
+	if(!isLittleEndian()){
+		swapBytes(
+			reinterpret_cast<char*>(values),
+			field.second,
+			BinaryUnit<DataType>::size
+		);
+	}
+}
+
 inline std::string Serializable::serialize(bool b, Mode mode){
 	switch(mode){
 	case Mode::Debug:
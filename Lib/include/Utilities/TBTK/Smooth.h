@@ -25,16 +25,31 @@
 
 #include "TBTK/Array.h"
 #include "TBTK/Property/DOS.h"
+#include "TBTK/Property/LDOS.h"
+#include "TBTK/Property/SpectralFunction.h"
+#include "TBTK/Property/SpinPolarizedLDOS.h"
+#include "TBTK/SpinMatrix.h"
 #include "TBTK/TBTKMacros.h"
 
 #include <cmath>
+#include <complex>
 #include <vector>
 
 namespace TBTK{
 
+/** @brief Collection of functions for smoothing data.
+ *
+ *  The Gaussian smoothing convolves the data with the kernel
+ *  exp(-n^2/(2 sigma^2)), n = -windowSize/2, ..., windowSize/2, normalized to
+ *  one. The kernel is computed once per call and is applied to each block of
+ *  data, where a block is the energy axis of a single site for the
+ *  properties and the last dimension for an Array. Blocks are smoothed in
+ *  parallel and wide windows are applied through FFT convolution if TBTK is
+ *  built with FFTW3. */
 class Smooth{
 public:
-	/** Gaussian smoothing of custom data. */
+	/** Gaussian smoothing of custom data. Arrays of rank larger than one
+	 *  are smoothed along the last dimension. */
 	static Array<double> gaussian(
 		const Array<double> &data,
 		double sigma,
@@ -62,149 +77,169 @@ public:
 		double sigma,
 		int windowSize
 	);
-private:
-};
 
-inline Array<double> Smooth::gaussian(
-	const Array<double> &data,
-	double sigma,
-	int windowSize
-){
-	TBTKAssert(
-		windowSize > 0,
-		"Smooth::gaussian()",
-		"'windowSize' must be larger than zero.",
-		""
-	);
-	TBTKAssert(
-		windowSize%2 == 1,
-		"Smooth::gaussian()",
-		"'windowSize' must be odd.",
-		""
-	);
-	TBTKAssert(
-		data.getRanges().size() == 1,
-		"Smooth::gaussian()",
-		"Array must have rank 1, but the rank is "
-		<< data.getRanges().size() << ".",
-		""
+	/** Gaussian smoothing of LDOS. Each site is smoothed along the energy
+	 *  axis.
+	 *
+	 *  @param ldos The LDOS to smooth.
+	 *  @param sigma The standard deviation in units of energy.
+	 *  @param windowSize The number of energy points in the kernel. Must
+	 *  be odd.
+	 *
+	 *  @return The smoothed LDOS. */
+	static Property::LDOS gaussian(
+		const Property::LDOS &ldos,
+		double sigma,
+		int windowSize
 	);
 
-	double normalization = 0;
-	for(int n = -windowSize/2; n <= windowSize/2; n++){
-		normalization += exp(-n*n/(2*sigma*sigma));
-	}
-	normalization = 1/normalization;
-
-	Array<double> result({data.getRanges()[0]}, 0);
-	for(int n = 0; n < (int)data.getRanges()[0]; n++){
-		for(
-			int c = std::max(0, (int)n - (int)windowSize/2);
-			c < std::min(
-				(int)n + (int)windowSize/2 + 1,
-				(int)data.getRanges()[0]
-			);
-			c++
-		){
-			result[{(unsigned int)n}]
-				+= data[
-					{(unsigned int)c}
-				]*exp(-(c-n)*(c-n)/(2*sigma*sigma));
-		}
-		result[{(unsigned int)n}] *= normalization;
-	}
-
-	return result;
-}
-
-inline std::vector<double> Smooth::gaussian(
-	const std::vector<double> &data,
-	double sigma,
-	int windowSize
-){
-	TBTKAssert(
-		windowSize > 0,
-		"Smooth::gaussian()",
-		"'windowSize' must be larger than zero.",
-		""
-	);
-	TBTKAssert(
-		windowSize%2 == 1,
-		"Smooth::gaussian()",
-		"'windowSize' must be odd.",
-		""
+	/** Gaussian smoothing of spin-polarized LDOS. Each element of the
+	 *  SpinMatrices is smoothed along the energy axis.
+	 *
+	 *  @param spinPolarizedLDOS The SpinPolarizedLDOS to smooth.
+	 *  @param sigma The standard deviation in units of energy.
+	 *  @param windowSize The number of energy points in the kernel. Must
+	 *  be odd.
+	 *
+	 *  @return The smoothed SpinPolarizedLDOS. */
+	static Property::SpinPolarizedLDOS gaussian(
+		const Property::SpinPolarizedLDOS &spinPolarizedLDOS,
+		double sigma,
+		int windowSize
 	);
 
-	double normalization = 0;
-	for(int n = -windowSize/2; n <= windowSize/2; n++){
-		normalization += exp(-n*n/(2*sigma*sigma));
-	}
-	normalization = 1/normalization;
-
-	std::vector<double> result;
-	for(int n = 0; n < (int)data.size(); n++){
-		result.push_back(0);
-		for(
-			int c = std::max(0, (int)n - (int)windowSize/2);
-			c < std::min(
-				(int)n + (int)windowSize/2 + 1,
-				(int)data.size()
-			);
-			c++
-		){
-			result.at(n) += data.at(c)*exp(-(c-n)*(c-n)/(2*sigma*sigma));
-		}
-		result.at(n) *= normalization;
-	}
-
-	return result;
-}
-
-inline std::vector<double> Smooth::gaussian(
-	const double *data,
-	unsigned int size,
-	double sigma,
-	int windowSize
-){
-	std::vector<double> dataVector;
-	for(unsigned int n = 0; n < size; n++)
-		dataVector.push_back(data[n]);
-
-	return gaussian(
-		dataVector,
-		sigma,
-		windowSize
+	/** Gaussian smoothing of spectral function. Each site is smoothed
+	 *  along the energy axis.
+	 *
+	 *  @param spectralFunction The SpectralFunction to smooth.
+	 *  @param sigma The standard deviation in units of energy.
+	 *  @param windowSize The number of energy points in the kernel. Must
+	 *  be odd.
+	 *
+	 *  @return The smoothed SpectralFunction. */
+	static Property::SpectralFunction gaussian(
+		const Property::SpectralFunction &spectralFunction,
+		double sigma,
+		int windowSize
 	);
-}
-
-inline Property::DOS Smooth::gaussian(
-	const Property::DOS &dos,
-	double sigma,
-	int windowSize
-){
-	const std::vector<double> &data = dos.getData();
-	std::vector<double> dataVector;
-	for(unsigned int n = 0; n < data.size(); n++)
-		dataVector.push_back(data[n]);
-
-	double lowerBound = dos.getLowerBound();
-	double upperBound = dos.getUpperBound();
-	int resolution = dos.getResolution();
-	double scaledSigma = sigma/(upperBound - lowerBound)*resolution;
-
-	std::vector<double> smoothedData = gaussian(
-		dataVector,
-		scaledSigma,
-		windowSize
+private:
+	/** Gaussian kernel that is applied to blocks of a fixed size. The
+	 *  weights, and for wide windows the Fourier transform of the kernel,
+	 *  are calculated once at construction. The kernel keeps its own work
+	 *  buffers and each thread should therefore use a separate kernel. */
+	class GaussianKernel{
+	public:
+		/** Constructor.
+		 *
+		 *  @param sigma The standard deviation in units of the
+		 *  spacing between data points.
+		 *  @param windowSize The number of points in the kernel.
+		 *  @param blockSize The number of points in each block. */
+		GaussianKernel(
+			double sigma,
+			int windowSize,
+			unsigned int blockSize
+		);
+
+		/** Copy constructor deleted since the kernel holds FFT
+		 *  plans. */
+		GaussianKernel(const GaussianKernel &gaussianKernel) = delete;
+
+		/** Destructor. */
+		~GaussianKernel();
+
+		/** Assignment operator deleted since the kernel holds FFT
+		 *  plans. */
+		GaussianKernel& operator=(const GaussianKernel &rhs) = delete;
+
+		/** Smooth one or two blocks. Two blocks are smoothed at the
+		 *  cost of one when the FFT convolution is used.
+		 *
+		 *  @param input0 The first block.
+		 *  @param output0 Output for the first block.
+		 *  @param input1 The second block or nullptr.
+		 *  @param output1 Output for the second block or nullptr. */
+		void apply(
+			const double *input0,
+			double *output0,
+			const double *input1 = nullptr,
+			double *output1 = nullptr
+		);
+	private:
+		/** Kernel weights for the offsets -windowSize/2, ...,
+		 *  windowSize/2. */
+		std::vector<double> weights;
+
+		/** Block size. */
+		unsigned int blockSize;
+
+		/** Flag indicating whether FFT convolution is used. */
+		bool useFFT;
+
+		/** Size of the zero padded FFT buffers. */
+		unsigned int fftSize;
+
+		/** Fourier transform of the kernel. The kernel is symmetric
+		 *  and therefore has a real transform. */
+		std::vector<double> kernelTransform;
+
+		/** FFT work buffers. */
+		std::vector<std::complex<double>> buffer0;
+		std::vector<std::complex<double>> buffer1;
+
+		/** FFT plans (FourierTransform::ForwardPlan and
+		 *  FourierTransform::InversePlan). Stored as void pointers
+		 *  since FourierTransform is only available when TBTK is
+		 *  built with FFTW3. */
+		void *forwardPlan;
+		void *inversePlan;
+
+		/** Direct convolution of a single block. */
+		void applyDirect(const double *input, double *output) const;
+	};
+
+	/** Smooth blocks of data in parallel.
+	 *
+	 *  @param input The input data.
+	 *  @param output The output data.
+	 *  @param numBlocks The number of blocks.
+	 *  @param blockSize The number of points in each block.
+	 *  @param sigma The standard deviation in units of the spacing
+	 *  between data points.
+	 *  @param windowSize The number of points in the kernel. */
+	static void convolveGaussian(
+		const double *input,
+		double *output,
+		unsigned int numBlocks,
+		unsigned int blockSize,
+		double sigma,
+		int windowSize
 	);
 
-	return Property::DOS(
-		lowerBound,
-		upperBound,
-		resolution,
-		smoothedData.data()
+	/** Smooth blocks of SpinMatrices in parallel. Each of the eight real
+	 *  components of the SpinMatrices is smoothed separately.
+	 *
+	 *  @param input The input data.
+	 *  @param output The output data.
+	 *  @param numBlocks The number of blocks.
+	 *  @param blockSize The number of points in each block.
+	 *  @param sigma The standard deviation in units of the spacing
+	 *  between data points.
+	 *  @param windowSize The number of points in the kernel. */
+	static void convolveGaussian(
+		const SpinMatrix *input,
+		SpinMatrix *output,
+		unsigned int numBlocks,
+		unsigned int blockSize,
+		double sigma,
+		int windowSize
 	);
-}
+
+	/** Check that the window size is valid.
+	 *
+	 *  @param windowSize The window size. */
+	static void assertValidWindowSize(int windowSize);
+};
 
 };	//End of namespace TBTK
 
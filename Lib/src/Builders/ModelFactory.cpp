@@ -19,6 +19,7 @@
  */
 
 #include "TBTK/HoppingAmplitudeSet.h"
+#include "TBTK/LinearStateTree.h"
 #include "TBTK/ModelFactory.h"
 #include "TBTK/Streams.h"
 #include "TBTK/TBTKMacros.h"
@@ -111,72 +112,12 @@ Model* ModelFactory::createModel(
 	const StateSet &stateSet,
 	const AbstractOperator &o
 ){
-	Model *model = new Model();
-
-	const vector<AbstractState*> states = stateSet.getStates();
-	for(unsigned int from = 0; from < states.size(); from++){
-		AbstractState *ket = states.at(from);
-		for(unsigned int to = 0; to < states.size(); to++){
-			AbstractState *bra = states.at(to);
-
-			complex<double> amplitude = ket->getMatrixElement(*bra);
-			if(amplitude != 0.){
-				*model << HoppingAmplitude(
-					amplitude,
-					Index(
-						bra->getContainer(),
-						bra->getIndex()
-					),
-					Index(
-						ket->getContainer(),
-						ket->getIndex()
-					)
-				);
-			}
-		}
-	}
-
-	unsigned int numCoordinates = states.at(0)->getCoordinates().size();
-	for(unsigned int n = 1; n < states.size(); n++){
-		TBTKAssert(
-			states.at(n)->getCoordinates().size() == numCoordinates,
-			"ModelFactory::createModel()",
-			"Incompatible coordinate dimensions. First state has "
-				<< numCoordinates
-				<< " coordinates, while state " << n << " has "
-				<< states.at(n)->getCoordinates().size() << " coordinates.",
-			""
-		);
-	}
-
-	unsigned int numSpecifiers = states.at(0)->getSpecifiers().size();
-	for(unsigned int n = 1; n < states.size(); n++){
-		TBTKAssert(
-			states.at(n)->getSpecifiers().size() == numSpecifiers,
-			"ModelFactory::createModel()",
-			"Incompatible number of specifiers. First state has "
-				<< numSpecifiers
-				<< " specifiers, while state " << n << " has "
-				<< states.at(n)->getSpecifiers().size() << " specifiers.",
-			""
-		);
-	}
+	//Only states with overlapping extents can have finite matrix
+	//elements. A StateTreeNode is therefore used to enumerate the
+	//overlapping pairs instead of testing every pair of states.
+	StateTreeNode stateTreeNode(stateSet);
 
-	model->construct();
-	model->createGeometry(numCoordinates, numSpecifiers);
-	Geometry *geometry = model->getGeometry();
-	for(unsigned int n = 0; n < states.size(); n++){
-		geometry->setCoordinates(
-			Index(
-				states.at(n)->getContainer(),
-				states.at(n)->getIndex()
-			),
-			states.at(n)->getCoordinates(),
-			states.at(n)->getSpecifiers()
-		);
-	}
-
-	return model;
+	return createModel(stateSet, stateTreeNode, o);
 }
 
 Model* ModelFactory::createModel(
@@ -186,32 +127,52 @@ Model* ModelFactory::createModel(
 ){
 	Model *model = new Model();
 
+	//The matrix elements are calculated in parallel and the
+	//HoppingAmplitudes are added to the Model afterwards, in the same
+	//order as they would have been added by a serial loop. The
+	//StateTreeNode is flattened to a LinearStateTree, which allows each
+	//thread to reuse a single buffer for the overlapping states.
+	LinearStateTree linearStateTree(stateTreeNode);
 	const vector<AbstractState*> states = stateSet.getStates();
-	for(unsigned int from = 0; from < states.size(); from++){
-		AbstractState *ket = states.at(from);
-		const vector<const AbstractState*> *bras = stateTreeNode.getOverlappingStates(ket->getCoordinates(), ket->getExtent());
-
-		for(unsigned int to = 0; to < bras->size(); to++){
-			const AbstractState *bra = bras->at(to);
-
-			complex<double> amplitude = ket->getMatrixElement(*bra);
-			if(amplitude != 0.){
-				*model << HoppingAmplitude(
-					amplitude,
-					Index(
-						bra->getContainer(),
-						bra->getIndex()
-					),
-					Index(
-						ket->getContainer(),
-						ket->getIndex()
-					)
-				);
+	vector<vector<HoppingAmplitude>> hoppingAmplitudes(states.size());
+	#pragma omp parallel
+	{
+		vector<const AbstractState*> bras;
+		#pragma omp for schedule(dynamic)
+		for(unsigned int from = 0; from < states.size(); from++){
+			AbstractState *ket = states.at(from);
+			linearStateTree.getOverlappingStates(
+				ket->getCoordinates(),
+				ket->getExtent(),
+				bras
+			);
+
+			for(unsigned int to = 0; to < bras.size(); to++){
+				const AbstractState *bra = bras[to];
+
+				complex<double> amplitude
+					= ket->getMatrixElement(*bra, o);
+				if(amplitude != 0.){
+					hoppingAmplitudes[from].push_back(
+						HoppingAmplitude(
+							amplitude,
+							Index(
+								bra->getContainer(),
+								bra->getIndex()
+							),
+							Index(
+								ket->getContainer(),
+								ket->getIndex()
+							)
+						)
+					);
+				}
 			}
 		}
-
-		delete bras;
 	}
+	for(unsigned int from = 0; from < states.size(); from++)
+		for(unsigned int n = 0; n < hoppingAmplitudes[from].size(); n++)
+			*model << hoppingAmplitudes[from][n];
 
 	unsigned int numCoordinates = states.at(0)->getCoordinates().size();
 	for(unsigned int n = 1; n < states.size(); n++){
@@ -362,6 +323,64 @@ void ModelFactory::addHexagonalGeometry(
 	}
 }
 
+void ModelFactory::addHoppingAmplitudesWithinCutoff(
+	Model *model,
+	double cutoff,
+	const function<
+		complex<double>(
+			const Index &toIndex,
+			const Index &fromIndex,
+			const Vector3d &displacement
+		)
+	> &amplitudeFunction,
+	const vector<Vector3d> &periodicVectors
+){
+	const Geometry *geometry = model->getGeometry();
+	TBTKAssert(
+		geometry != nullptr,
+		"ModelFactory::addHoppingAmplitudesWithinCutoff()",
+		"The Model does not have any geometric data.",
+		"Use Model::createGeometry() to add geometric data."
+	);
+
+	NeighborIndex neighborIndex(*geometry, cutoff, periodicVectors);
+
+	const HoppingAmplitudeSet &hoppingAmplitudeSet
+		= model->getHoppingAmplitudeSet();
+	int basisSize = model->getBasisSize();
+	vector<Index> indices;
+	for(int n = 0; n < basisSize; n++)
+		indices.push_back(hoppingAmplitudeSet.getPhysicalIndex(n));
+
+	vector<vector<HoppingAmplitude>> hoppingAmplitudes(basisSize);
+	#pragma omp parallel for schedule(dynamic, 64)
+	for(int from = 0; from < basisSize; from++){
+		vector<NeighborIndex::Neighbor> neighbors
+			= neighborIndex.getNeighbors(from);
+		for(unsigned int n = 0; n < neighbors.size(); n++){
+			const Index &toIndex = indices[neighbors[n].basisIndex];
+			complex<double> amplitude = amplitudeFunction(
+				toIndex,
+				indices[from],
+				neighbors[n].displacement
+			);
+			if(amplitude != 0.){
+				hoppingAmplitudes[from].push_back(
+					HoppingAmplitude(
+						amplitude,
+						toIndex,
+						indices[from]
+					)
+				);
+			}
+		}
+	}
+
+	for(int from = 0; from < basisSize; from++)
+		for(unsigned int n = 0; n < hoppingAmplitudes[from].size(); n++)
+			*model << hoppingAmplitudes[from][n];
+}
+
 Model* ModelFactory::merge(
 	initializer_list<Model*> models
 ){
@@ -23,6 +23,7 @@
 #include "TBTK/TBTKMacros.h"
 #include "TBTK/Vector3d.h"
 
+#include <cmath>
 #include <limits>
 #include <typeinfo>
 
@@ -40,6 +41,7 @@ ReciprocalLattice::ReciprocalLattice(
 
 	setupReciprocalLatticeVectors(unitCell);
 	setupRealSpaceEnvironment(unitCell);
+	setupHoppingTable();
 }
 
 ReciprocalLattice::~ReciprocalLattice(){
@@ -134,52 +136,19 @@ Model* ReciprocalLattice::generateModel(vector<double> momentum) const{
 		""
 	);
 
-	for(unsigned int from = 0; from < realSpaceReferenceCell->getStates().size(); from++){
-		//Get reference ket.
-		const AbstractState *referenceKet = realSpaceReferenceCell->getStates().at(from);
-
-		for(unsigned int to = 0; to < realSpaceReferenceCell->getStates().size(); to++){
-			//Get reference bra and its Index.
-			const AbstractState *referenceBra = realSpaceReferenceCell->getStates().at(to);
-			Index referenceBraIndex(referenceBra->getIndex());
-
-			//Get all bras that have a possible overlap with the
-			//reference ket.
-/*			const vector<const AbstractState*> *bras = realSpaceEnvironmentStateTree->getOverlappingStates(
-				referenceKet->getCoordinates(),
-				referenceKet->getExtent()
-			);*/
-			vector<const AbstractState*> *bras = realSpaceEnvironmentStateTree->getOverlappingStates(
-				referenceKet->getCoordinates(),
-				referenceKet->getExtent()
+	vector<complex<double>> amplitudes = calculateAmplitudes({momentum});
+
+	const vector<AbstractState*> &referenceStates
+		= realSpaceReferenceCell->getStates();
+	for(unsigned int from = 0; from < referenceStates.size(); from++){
+		const Index &referenceKetIndex
+			= referenceStates[from]->getIndex();
+		for(unsigned int to = 0; to < referenceStates.size(); to++){
+			*model << HoppingAmplitude(
+				amplitudes[from*referenceStates.size() + to],
+				referenceStates[to]->getIndex(),
+				referenceKetIndex
 			);
-
-			//Calculate momentum space amplitude
-			complex<double> amplitude = 0.;
-			for(unsigned int n = 0; n < bras->size(); n++){
-				//Loop over all states that have a possible
-				//finite overlap with the reference ket.
-				const AbstractState *bra = bras->at(n);
-				if(bra->getIndex().equals(referenceBraIndex)){
-					//Only states with the same Index as
-					//the reference ket contributes to the
-					//amplitude.
-
-					static const complex<double> i(0., 1.);
-					complex<double> exponent = 0.;
-					for(unsigned int c = 0; c < momentum.size(); c++)
-						exponent += i*(momentum.at(c))*(bra->getCoordinates().at(c) - referenceBra->getCoordinates().at(c));
-					amplitude += bras->at(n)->getMatrixElement(*referenceKet)*exp(exponent);
-				}
-			}
-
-			delete bras;
-
-			//Add HoppingAmplitude to Hamiltonian, unless the
-			//amplitude is exactly zero.
-//			if(amplitude != 0.)
-//				model->addHA(HoppingAmplitude(amplitude, referenceBraIndex, referenceKet->getIndex()));
-				*model << HoppingAmplitude(amplitude, referenceBraIndex, referenceKet->getIndex());
 		}
 	}
 
@@ -232,114 +201,70 @@ Model* ReciprocalLattice::generateModel(
 
 	Model *model = new Model();
 
-	for(unsigned int from = 0; from < realSpaceReferenceCell->getStates().size(); from++){
-		//Get reference ket.
-		const AbstractState *referenceKet = realSpaceReferenceCell->getStates().at(from);
-
-		for(unsigned int to = 0; to < realSpaceReferenceCell->getStates().size(); to++){
-			//Get reference bra and its Index.
-			const AbstractState *referenceBra = realSpaceReferenceCell->getStates().at(to);
-			Index referenceBraIndex(referenceBra->getIndex());
-
-			//Get all bras that have a possible overlap with the
-			//reference ket.
-/*			const vector<const AbstractState*> *bras = realSpaceEnvironmentStateTree->getOverlappingStates(
-				referenceKet->getCoordinates(),
-				referenceKet->getExtent()
-			);*/
-			vector<const AbstractState*> *bras = realSpaceEnvironmentStateTree->getOverlappingStates(
-				referenceKet->getCoordinates(),
-				referenceKet->getExtent()
-			);
-
-			//Calculate momentum space amplitudes
-			vector<complex<double>> amplitudes;
-			for(unsigned int n = 0; n < momentums.size(); n++)
-				amplitudes.push_back(0.);
-
-			for(unsigned int n = 0; n < bras->size(); n++){
-				//Loop over all states that have a possible
-				//finite overlap with the reference ket.
-				const AbstractState *bra = bras->at(n);
-				if(bra->getIndex().equals(referenceBraIndex)){
-					//Only states with the same Index as
-					//the reference ket contributes to the
-					//amplitude.
+	vector<complex<double>> amplitudes = calculateAmplitudes(momentums);
+
+	const vector<AbstractState*> &referenceStates
+		= realSpaceReferenceCell->getStates();
+	for(unsigned int from = 0; from < referenceStates.size(); from++){
+		const Index &referenceKetIndex
+			= referenceStates[from]->getIndex();
+		for(unsigned int to = 0; to < referenceStates.size(); to++){
+			const Index &referenceBraIndex
+				= referenceStates[to]->getIndex();
+			unsigned int pair = from*referenceStates.size() + to;
+			for(unsigned int n = 0; n < momentums.size(); n++){
+				*model << HoppingAmplitude(
+					amplitudes[pair*momentums.size() + n],
+					Index(blockIndices[n], referenceBraIndex),
+					Index(blockIndices[n], referenceKetIndex)
+				);
+			}
+		}
+	}
 
-					//Get matrix element.
-					complex<double> matrixElement
-						= bras->at(
-							n
-						)->getMatrixElement(
-							*referenceKet
-						);
-
-					//Get coordinates.
-					const vector<double> &braCoordinates
-						= bra->getCoordinates();
-					const vector<double> &referenceCoordinates
-						= referenceBra->getCoordinates();
-					vector<double> coordinatesDifference;
-					for(
-						unsigned int c = 0;
-						c < braCoordinates.size();
-						c++
-					){
-						coordinatesDifference.push_back(
-							braCoordinates[c]
-							- referenceCoordinates[c]
-						);
-					}
+	return model;
+}
 
-					static const complex<double> i(0., 1.);
-					for(
-						unsigned int m = 0;
-						m < momentums.size();
-						m++
-					){
-						const vector<double> &momentum
-							= momentums[m];
-
-						double exponent = 0.;
-						for(
-							unsigned int c = 0;
-							c < momentums[m].size();
-							c++
-						){
-							exponent += momentum[c]*coordinatesDifference[c];
-						}
-
-						amplitudes[m]
-							+= matrixElement*exp(
-								i*exponent
-							);
-					}
+vector<complex<double>> ReciprocalLattice::calculateAmplitudes(
+	const vector<vector<double>> &momentums
+) const{
+	unsigned int numPairs = hoppingTableOffsets.size() - 1;
+	unsigned int numMomentums = momentums.size();
+	vector<complex<double>> amplitudes(numPairs*numMomentums, 0.);
+
+	#pragma omp parallel for
+	for(unsigned int m = 0; m < numMomentums; m++){
+		const vector<double> &momentum = momentums[m];
+		for(unsigned int pair = 0; pair < numPairs; pair++){
+			complex<double> amplitude = 0.;
+			for(
+				unsigned int n = hoppingTableOffsets[pair];
+				n < hoppingTableOffsets[pair+1];
+				n++
+			){
+				const double *displacement
+					= &hoppingTableDisplacements[
+						n*hoppingTableDimension
+					];
+				double exponent = 0.;
+				for(
+					unsigned int c = 0;
+					c < hoppingTableDimension;
+					c++
+				){
+					exponent += momentum[c]*displacement[c];
 				}
-			}
 
-			delete bras;
-
-			//Add HoppingAmplitude to Hamiltonian, unless the
-			//amplitude is exactly zero.
-			for(unsigned int n = 0; n < momentums.size(); n++){
-//				if(amplitude != 0.)
-//					model->addHA(HoppingAmplitude(amplitude, referenceBraIndex, referenceKet->getIndex()));
-					*model << HoppingAmplitude(
-						amplitudes[n],
-						Index(
-							blockIndices[n],
-							referenceBraIndex
-						),
-						Index(
-							blockIndices[n],
-							referenceKet->getIndex()
-						)
-					);
+				amplitude += hoppingTableAmplitudes[n]*complex<double>(
+					cos(exponent),
+					sin(exponent)
+				);
 			}
+			amplitudes[pair*numMomentums + m] = amplitude;
 		}
 	}
 
-	return model;
+	return amplitudes;
 }
 
 void ReciprocalLattice::setupReciprocalLatticeVectors(const UnitCell *unitCell){
@@ -557,9 +482,10 @@ void ReciprocalLattice::setupRealSpaceEnvironment(const UnitCell *unitCell){
 	//Create StateSet for the real space environment.
 	realSpaceEnvironment = realSpaceEnvironmentLattice.generateStateSet();
 
-	//Create StateTreeNode for quick access of states in
+	//Create LinearStateTree for quick access of states in
 	//realSpaceEnvironment.
-	realSpaceEnvironmentStateTree = new StateTreeNode(*realSpaceEnvironment);
+	realSpaceEnvironmentStateTree
+		= new LinearStateTree(*realSpaceEnvironment);
 
 	//Extract states contained in the refrence cell. That is, the
 	//cell containg all the states that will be used as kets.
@@ -607,4 +533,65 @@ void ReciprocalLattice::setupRealSpaceEnvironment(const UnitCell *unitCell){
 	}
 }
 
+void ReciprocalLattice::setupHoppingTable(){
+	hoppingTableDimension = reciprocalLatticeVectors.at(0).size();
+
+	const vector<AbstractState*> &referenceStates
+		= realSpaceReferenceCell->getStates();
+
+	//Get all bras that have a possible overlap with the reference kets.
+	//These are the same for every reference bra.
+	vector<vector<const AbstractState*>> overlappingStates
+		= realSpaceEnvironmentStateTree->getOverlappingStates(
+			referenceStates
+		);
+
+	hoppingTableOffsets.push_back(0);
+	for(unsigned int from = 0; from < referenceStates.size(); from++){
+		//Get reference ket and the bras overlapping with it.
+		const AbstractState *referenceKet = referenceStates[from];
+		const vector<const AbstractState*> &bras
+			= overlappingStates[from];
+
+		for(unsigned int to = 0; to < referenceStates.size(); to++){
+			//Get reference bra and its Index.
+			const AbstractState *referenceBra = referenceStates[to];
+			const Index &referenceBraIndex = referenceBra->getIndex();
+			const vector<double> &referenceCoordinates
+				= referenceBra->getCoordinates();
+
+			for(unsigned int n = 0; n < bras.size(); n++){
+				//Only states with the same Index as the
+				//reference bra contributes to the amplitude.
+				const AbstractState *bra = bras[n];
+				if(!bra->getIndex().equals(referenceBraIndex))
+					continue;
+
+				complex<double> matrixElement
+					= bra->getMatrixElement(*referenceKet);
+				if(matrixElement == 0.)
+					continue;
+
+				const vector<double> &braCoordinates
+					= bra->getCoordinates();
+				for(
+					unsigned int c = 0;
+					c < hoppingTableDimension;
+					c++
+				){
+					hoppingTableDisplacements.push_back(
+						braCoordinates[c]
+						- referenceCoordinates[c]
+					);
+				}
+				hoppingTableAmplitudes.push_back(matrixElement);
+			}
+
+			hoppingTableOffsets.push_back(
+				hoppingTableAmplitudes.size()
+			);
+		}
+	}
+}
+
 };	//End of namespace TBTK
@@ -22,6 +22,8 @@
 #include "TBTK/Streams.h"
 #include "TBTK/TBTKMacros.h"
 
+#include <algorithm>
+
 #include "TBTK/json.hpp"
 
 using namespace std;
@@ -214,6 +216,47 @@ Geometry::Geometry(
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		dimensions = reader.read<uint32_t>("dimensions");
+		numSpecifiers = reader.read<uint32_t>("numSpecifiers");
+
+		vector<double> c = reader.readArray<double>("coordinates");
+		TBTKAssert(
+			c.size() == dimensions*hoppingAmplitudeSet.getBasisSize(),
+			"Geometry::Geometry()",
+			"Incompatible array sizes. "
+			<< "'dimensions*hoppingAmplitudeSet.getBasisSize()'"
+			<< " is " << dimensions*hoppingAmplitudeSet.getBasisSize()
+			<< " but coordinates has " << c.size() << " elements.",
+			""
+		);
+		coordinates = new double[c.size()];
+		copy(c.begin(), c.end(), coordinates);
+
+		if(numSpecifiers > 0){
+			vector<int> s = reader.readArray<int32_t>("specifiers");
+			TBTKAssert(
+				s.size() == numSpecifiers*hoppingAmplitudeSet.getBasisSize(),
+				"Geometry::Geometry()",
+				"Incompatible array sizes. "
+				<< "'numSpecifiers*hoppingAmplitudeSet.getBasisSize()'"
+				<< " is "
+				<< numSpecifiers*hoppingAmplitudeSet.getBasisSize()
+				<< " but specifiers has " << s.size()
+				<< " elements.",
+				""
+			);
+			specifiers = new int[s.size()];
+			copy(s.begin(), s.end(), specifiers);
+		}
+		else{
+			specifiers = nullptr;
+		}
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"Geometry::Geometry()",
@@ -487,6 +530,26 @@ string Geometry::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("Geometry");
+		writer.write<uint32_t>("dimensions", dimensions);
+		writer.write<uint32_t>("numSpecifiers", numSpecifiers);
+		writer.writeArray(
+			"coordinates",
+			coordinates,
+			dimensions*hoppingAmplitudeSet->getBasisSize()
+		);
+		if(numSpecifiers > 0){
+			writer.writeArray<int32_t>(
+				"specifiers",
+				specifiers,
+				numSpecifiers*hoppingAmplitudeSet->getBasisSize()
+			);
+		}
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Geometry::Geometry()",
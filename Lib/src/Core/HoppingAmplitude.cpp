@@ -122,6 +122,17 @@ HoppingAmplitude::HoppingAmplitude(
 
 		break;
 	}
+	case Serializable::Mode::Binary:
+	{
+		amplitudeCallback = nullptr;
+
+		Serializable::BinaryReader reader(serialization);
+		amplitude = reader.read<complex<double>>("amplitude");
+		toIndex = Index(reader.readString("toIndex"), mode);
+		fromIndex = Index(reader.readString("fromIndex"), mode);
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitude::HoppingAmplitude()",
@@ -193,6 +204,15 @@ string HoppingAmplitude::serialize(Serializable::Mode mode) const{
 
 		return ss.str();*/
 	}
+	case Serializable::Mode::Binary:
+	{
+		Serializable::BinaryWriter writer("HoppingAmplitude");
+		writer.write("amplitude", amplitude);
+		writer.writeString("toIndex", toIndex.serialize(mode));
+		writer.writeString("fromIndex", fromIndex.serialize(mode));
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitude::serialize()",
@@ -22,6 +22,8 @@
 #include "TBTK/Streams.h"
 #include "TBTK/TBTKMacros.h"
 
+#include <algorithm>
+
 #include "TBTK/json.hpp"
 
 using namespace std;
@@ -259,6 +261,47 @@ HoppingAmplitudeSet::HoppingAmplitudeSet(
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		isConstructed = reader.read<bool>("isConstructed");
+		isSorted = reader.read<bool>("isSorted");
+		numMatrixElements = reader.read<int32_t>("numMatrixElements");
+		if(numMatrixElements == -1){
+			cooRowIndices = nullptr;
+			cooColIndices = nullptr;
+			cooValues = nullptr;
+		}
+		else{
+			vector<int> cri = reader.readArray<int32_t>("cooRowIndices");
+			vector<int> cci = reader.readArray<int32_t>("cooColIndices");
+			vector<complex<double>> cv
+				= reader.readArray<complex<double>>(
+					"cooValues"
+				);
+			TBTKAssert(
+				(int)cri.size() == numMatrixElements
+				&& (int)cci.size() == numMatrixElements
+				&& (int)cv.size() == numMatrixElements,
+				"HoppingAmplitudeSet::HoppingAmplitudeSet()",
+				"Incompatible array sizes. 'numMatrixElements'"
+				<< " is " << numMatrixElements << " but the"
+				<< " COO arrays have " << cri.size() << ", "
+				<< cci.size() << ", and " << cv.size()
+				<< " elements.",
+				""
+			);
+
+			cooRowIndices = new int[numMatrixElements];
+			cooColIndices = new int[numMatrixElements];
+			cooValues = new complex<double>[numMatrixElements];
+			copy(cri.begin(), cri.end(), cooRowIndices);
+			copy(cci.begin(), cci.end(), cooColIndices);
+			copy(cv.begin(), cv.end(), cooValues);
+		}
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitudeSet::HoppingAmplitudeSet()",
@@ -526,6 +569,39 @@ string HoppingAmplitudeSet::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("HoppingAmplitudeSet");
+		writer.writeString(
+			"hoppingAmplitudeTree",
+			HoppingAmplitudeTree::serialize(mode)
+		);
+		writer.write("isConstructed", isConstructed);
+		writer.write("isSorted", isSorted);
+		writer.write<int32_t>(
+			"numMatrixElements",
+			numMatrixElements
+		);
+		if(numMatrixElements != -1){
+			writer.writeArray<int32_t>(
+				"cooRowIndices",
+				cooRowIndices,
+				numMatrixElements
+			);
+			writer.writeArray<int32_t>(
+				"cooColIndices",
+				cooColIndices,
+				numMatrixElements
+			);
+			writer.writeArray(
+				"cooValues",
+				cooValues,
+				numMatrixElements
+			);
+		}
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitudeSet::serialize()",
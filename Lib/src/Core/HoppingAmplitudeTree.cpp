@@ -174,6 +174,35 @@ HoppingAmplitudeTree::HoppingAmplitudeTree(
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		BinaryArrays binaryArrays;
+		binaryArrays.basisIndices = reader.readArray<int32_t>("basisIndices");
+		binaryArrays.basisSizes = reader.readArray<int32_t>("basisSizes");
+		binaryArrays.isPotentialBlockSeparators
+			= reader.readArray<bool>("isPotentialBlockSeparators");
+		binaryArrays.numChildren
+			= reader.readArray<uint32_t>("numChildren");
+		binaryArrays.numHoppingAmplitudes
+			= reader.readArray<uint32_t>("numHoppingAmplitudes");
+		binaryArrays.amplitudes
+			= reader.readArray<complex<double>>("amplitudes");
+		binaryArrays.toIndexSizes
+			= reader.readArray<uint32_t>("toIndexSizes");
+		binaryArrays.toIndices = reader.readArray<int32_t>("toIndices");
+		binaryArrays.fromIndexSizes
+			= reader.readArray<uint32_t>("fromIndexSizes");
+		binaryArrays.fromIndices = reader.readArray<int32_t>("fromIndices");
+		binaryArrays.nodePosition = 0;
+		binaryArrays.hoppingAmplitudePosition = 0;
+		binaryArrays.toIndexPosition = 0;
+		binaryArrays.fromIndexPosition = 0;
+
+		deserializeBinary(binaryArrays);
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitudeTree::HoppingAmplitudeTree()",
@@ -737,6 +766,31 @@ string HoppingAmplitudeTree::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryArrays binaryArrays;
+		serializeBinary(binaryArrays);
+
+		BinaryWriter writer("HoppingAmplitudeTree");
+		writer.writeArray("basisIndices", binaryArrays.basisIndices);
+		writer.writeArray("basisSizes", binaryArrays.basisSizes);
+		writer.writeArray(
+			"isPotentialBlockSeparators",
+			binaryArrays.isPotentialBlockSeparators
+		);
+		writer.writeArray("numChildren", binaryArrays.numChildren);
+		writer.writeArray(
+			"numHoppingAmplitudes",
+			binaryArrays.numHoppingAmplitudes
+		);
+		writer.writeArray("amplitudes", binaryArrays.amplitudes);
+		writer.writeArray("toIndexSizes", binaryArrays.toIndexSizes);
+		writer.writeArray("toIndices", binaryArrays.toIndices);
+		writer.writeArray("fromIndexSizes", binaryArrays.fromIndexSizes);
+		writer.writeArray("fromIndices", binaryArrays.fromIndices);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"HoppingAmplitudeTree::serialize()",
@@ -746,6 +800,112 @@ string HoppingAmplitudeTree::serialize(Mode mode) const{
 	}
 }
 
+void HoppingAmplitudeTree::serializeBinary(
+	BinaryArrays &binaryArrays
+) const{
+	binaryArrays.basisIndices.push_back(basisIndex);
+	binaryArrays.basisSizes.push_back(basisSize);
+	binaryArrays.isPotentialBlockSeparators.push_back(
+		isPotentialBlockSeparator
+	);
+	binaryArrays.numChildren.push_back(children.size());
+	binaryArrays.numHoppingAmplitudes.push_back(hoppingAmplitudes.size());
+	for(unsigned int n = 0; n < hoppingAmplitudes.size(); n++){
+		const HoppingAmplitude &ha = hoppingAmplitudes[n];
+		TBTKAssert(
+			ha.amplitudeCallback == nullptr,
+			"HoppingAmplitudeTree::serialize()",
+			"Unable to serialize HoppingAmplitude that uses"
+			<< " callback value.",
+			""
+		);
+
+		binaryArrays.amplitudes.push_back(ha.amplitude);
+		binaryArrays.toIndexSizes.push_back(ha.toIndex.getSize());
+		for(unsigned int c = 0; c < ha.toIndex.getSize(); c++)
+			binaryArrays.toIndices.push_back(ha.toIndex[c]);
+		binaryArrays.fromIndexSizes.push_back(ha.fromIndex.getSize());
+		for(unsigned int c = 0; c < ha.fromIndex.getSize(); c++)
+			binaryArrays.fromIndices.push_back(ha.fromIndex[c]);
+	}
+
+	for(unsigned int n = 0; n < children.size(); n++)
+		children[n].serializeBinary(binaryArrays);
+}
+
+void HoppingAmplitudeTree::deserializeBinary(BinaryArrays &binaryArrays){
+	unsigned int node = binaryArrays.nodePosition++;
+	TBTKAssert(
+		node < binaryArrays.basisIndices.size()
+		&& node < binaryArrays.basisSizes.size()
+		&& node < binaryArrays.isPotentialBlockSeparators.size()
+		&& node < binaryArrays.numChildren.size()
+		&& node < binaryArrays.numHoppingAmplitudes.size(),
+		"HoppingAmplitudeTree::HoppingAmplitudeTree()",
+		"Unable to parse binary serialization string as"
+		<< " HoppingAmplitudeTree.",
+		"The serialization string is corrupted."
+	);
+	basisIndex = binaryArrays.basisIndices[node];
+	basisSize = binaryArrays.basisSizes[node];
+	isPotentialBlockSeparator
+		= binaryArrays.isPotentialBlockSeparators[node];
+
+	unsigned int numHoppingAmplitudes
+		= binaryArrays.numHoppingAmplitudes[node];
+	hoppingAmplitudes.reserve(numHoppingAmplitudes);
+	for(unsigned int n = 0; n < numHoppingAmplitudes; n++){
+		unsigned int &haPosition
+			= binaryArrays.hoppingAmplitudePosition;
+		unsigned int &toPosition = binaryArrays.toIndexPosition;
+		unsigned int &fromPosition = binaryArrays.fromIndexPosition;
+		TBTKAssert(
+			haPosition < binaryArrays.amplitudes.size()
+			&& haPosition < binaryArrays.toIndexSizes.size()
+			&& haPosition < binaryArrays.fromIndexSizes.size()
+			&& toPosition + binaryArrays.toIndexSizes[haPosition]
+				<= binaryArrays.toIndices.size()
+			&& fromPosition
+				+ binaryArrays.fromIndexSizes[haPosition]
+				<= binaryArrays.fromIndices.size(),
+			"HoppingAmplitudeTree::HoppingAmplitudeTree()",
+			"Unable to parse binary serialization string as"
+			<< " HoppingAmplitudeTree.",
+			"The serialization string is corrupted."
+		);
+
+		vector<int>::iterator toBegin
+			= binaryArrays.toIndices.begin() + toPosition;
+		toPosition += binaryArrays.toIndexSizes[haPosition];
+		vector<int>::iterator fromBegin
+			= binaryArrays.fromIndices.begin() + fromPosition;
+		fromPosition += binaryArrays.fromIndexSizes[haPosition];
+		hoppingAmplitudes.push_back(
+			HoppingAmplitude(
+				binaryArrays.amplitudes[haPosition],
+				Index(vector<int>(
+					toBegin,
+					toBegin
+					+ binaryArrays.toIndexSizes[haPosition]
+				)),
+				Index(vector<int>(
+					fromBegin,
+					fromBegin
+					+ binaryArrays.fromIndexSizes[haPosition]
+				))
+			)
+		);
+		haPosition++;
+	}
+
+	unsigned int numChildren = binaryArrays.numChildren[node];
+	children.reserve(numChildren);
+	for(unsigned int n = 0; n < numChildren; n++){
+		children.push_back(HoppingAmplitudeTree());
+		children.back().deserializeBinary(binaryArrays);
+	}
+}
+
 HoppingAmplitude HoppingAmplitudeTree::getFirstHA() const{
 	if(children.size() == 0)
 		return hoppingAmplitudes.at(0);
@@ -304,6 +304,20 @@ Index::Index(const string &serialization, Serializable::Mode mode){
 
 		break;
 	}
+	case Serializable::Mode::Binary:
+	{
+		TBTKAssert(
+			Serializable::validate(serialization, "Index", mode),
+			"Index::Index()",
+			"Unable to parse binary serialization string as index.",
+			""
+		);
+
+		Serializable::BinaryReader reader(serialization);
+		indices = reader.readArray<int32_t>("indices");
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"Index::Index()",
@@ -407,6 +421,13 @@ string Index::serialize(Serializable::Mode mode) const{
 
 		return j.dump();
 	}
+	case Serializable::Mode::Binary:
+	{
+		Serializable::BinaryWriter writer("Index");
+		writer.writeArray<int32_t>("indices", indices);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Index::serialize()",
@@ -122,6 +122,31 @@ IndexTree::IndexTree(const string &serialization, Mode mode){
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		unsigned int numChildren
+			= reader.read<uint32_t>("numChildren");
+		children.reserve(numChildren);
+		for(unsigned int n = 0; n < numChildren; n++){
+			children.push_back(
+				IndexTree(
+					reader.readString(
+						"child" + to_string(n)
+					),
+					mode
+				)
+			);
+		}
+		indexIncluded = reader.read<bool>("indexIncluded");
+		wildcardIndex = reader.read<bool>("wildcardIndex");
+		wildcardType = reader.read<int32_t>("wildcardType");
+		indexSeparator = reader.read<bool>("indexSeparator");
+		linearIndex = reader.read<int32_t>("linearIndex");
+		size = reader.read<int32_t>("size");
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"IndexTree::IndexTree()",
@@ -649,6 +674,25 @@ string IndexTree::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("IndexTree");
+		writer.write<uint32_t>("numChildren", children.size());
+		for(unsigned int n = 0; n < children.size(); n++){
+			writer.writeString(
+				"child" + to_string(n),
+				children.at(n).serialize(mode)
+			);
+		}
+		writer.write("indexIncluded", indexIncluded);
+		writer.write("wildcardIndex", wildcardIndex);
+		writer.write<int32_t>("wildcardType", wildcardType);
+		writer.write("indexSeparator", indexSeparator);
+		writer.write<int32_t>("linearIndex", linearIndex);
+		writer.write<int32_t>("size", size);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"IndexTree:IndexTree()",
@@ -156,6 +156,23 @@ Model::Model(const string &serialization, Mode mode) : Communicator(true){
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		temperature = reader.read<double>("temperature");
+		chemicalPotential = reader.read<double>("chemicalPotential");
+		singleParticleContext = new SingleParticleContext(
+			reader.readString("singleParticleContext"),
+			mode
+		);
+
+		manyParticleContext = nullptr;
+
+		indexFilter = nullptr;
+		hoppingAmplitudeFilter = nullptr;
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"Model::Model()",
@@ -304,6 +321,18 @@ string Model::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("Model");
+		writer.write("temperature", temperature);
+		writer.write("chemicalPotential", chemicalPotential);
+		writer.writeString(
+			"singleParticleContext",
+			singleParticleContext->serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Model::serialize()",
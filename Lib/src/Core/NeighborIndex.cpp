@@ -0,0 +1,339 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file NeighborIndex.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/NeighborIndex.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+namespace TBTK{
+
+NeighborIndex::NeighborIndex(
+	const Geometry &geometry,
+	double cutoff,
+	const vector<Vector3d> &periodicVectors
+){
+	TBTKAssert(
+		geometry.getDimensions() >= 1 && geometry.getDimensions() <= 3,
+		"NeighborIndex::NeighborIndex()",
+		"Only Geometries with one, two, or three dimensions are"
+		<< " supported, but the Geometry has "
+		<< geometry.getDimensions() << " dimensions.",
+		""
+	);
+	TBTKAssert(
+		cutoff > 0,
+		"NeighborIndex::NeighborIndex()",
+		"The cutoff must be larger than zero.",
+		""
+	);
+
+	this->geometry = &geometry;
+	this->cutoff = cutoff;
+	dimensions = geometry.getDimensions();
+	numSites = geometry.getBasisSize();
+	const double *coordinates = geometry.getCoordinates();
+
+	//Bounding box.
+	double upper[3];
+	for(unsigned int c = 0; c < 3; c++){
+		lower[c] = 0;
+		upper[c] = 0;
+		numCells[c] = 1;
+	}
+	for(unsigned int c = 0; c < dimensions; c++){
+		if(numSites == 0)
+			break;
+
+		lower[c] = numeric_limits<double>::infinity();
+		upper[c] = -numeric_limits<double>::infinity();
+		for(unsigned int n = 0; n < numSites; n++){
+			lower[c] = min(lower[c], coordinates[dimensions*n + c]);
+			upper[c] = max(upper[c], coordinates[dimensions*n + c]);
+		}
+	}
+
+	//The cells are at least as large as the cutoff, such that only the
+	//closest cells need to be searched. For sparse systems the cell size
+	//is increased to avoid a large number of empty cells.
+	cellSize = cutoff;
+	while(true){
+		double totalNumCells = 1;
+		for(unsigned int c = 0; c < dimensions; c++){
+			numCells[c] = (unsigned int)((upper[c] - lower[c])/cellSize) + 1;
+			totalNumCells *= numCells[c];
+		}
+		if(totalNumCells <= 8.*max(numSites, 1u))
+			break;
+
+		cellSize *= 2;
+	}
+
+	//Sort the sites into the cells.
+	unsigned int totalNumCells = numCells[0]*numCells[1]*numCells[2];
+	vector<unsigned int> siteCells(numSites);
+	cellStart.assign(totalNumCells + 1, 0);
+	for(unsigned int n = 0; n < numSites; n++){
+		unsigned int cell = 0;
+		for(unsigned int c = 0; c < dimensions; c++){
+			cell = cell*numCells[c] + getCellCoordinate(
+				coordinates[dimensions*n + c],
+				c
+			);
+		}
+		siteCells[n] = cell;
+		cellStart[cell + 1]++;
+	}
+	for(unsigned int n = 0; n < totalNumCells; n++)
+		cellStart[n + 1] += cellStart[n];
+	cellSites.resize(numSites);
+	vector<unsigned int> cellPosition(cellStart.begin(), cellStart.end() - 1);
+	for(unsigned int n = 0; n < numSites; n++)
+		cellSites[cellPosition[siteCells[n]]++] = n;
+
+	setupTranslations(periodicVectors, upper);
+}
+
+vector<NeighborIndex::Neighbor> NeighborIndex::getNeighbors(
+	unsigned int basisIndex
+) const{
+	TBTKAssert(
+		basisIndex < numSites,
+		"NeighborIndex::getNeighbors()",
+		"Invalid basis index '" << basisIndex << "'. The number of"
+		<< " sites is " << numSites << ".",
+		""
+	);
+
+	const double *coordinates = geometry->getCoordinates();
+	double site[3] = {0, 0, 0};
+	for(unsigned int c = 0; c < dimensions; c++)
+		site[c] = coordinates[dimensions*basisIndex + c];
+
+	vector<Neighbor> neighbors;
+	double squaredCutoff = cutoff*cutoff;
+	for(unsigned int t = 0; t < translations.size(); t++){
+		//A neighbor at x + translation is found by searching for x
+		//around site - translation.
+		double center[3] = {
+			site[0] - translations[t].x,
+			site[1] - translations[t].y,
+			site[2] - translations[t].z
+		};
+
+		int first[3] = {0, 0, 0};
+		int last[3] = {0, 0, 0};
+		bool isEmpty = false;
+		for(unsigned int c = 0; c < dimensions; c++){
+			double cell = floor((center[c] - lower[c])/cellSize);
+			if(cell < -1 || cell > numCells[c]){
+				isEmpty = true;
+				break;
+			}
+			first[c] = max((int)cell - 1, 0);
+			last[c] = min((int)cell + 1, (int)numCells[c] - 1);
+		}
+		if(isEmpty)
+			continue;
+
+		for(int x = first[0]; x <= last[0]; x++){
+			for(int y = first[1]; y <= last[1]; y++){
+				for(int z = first[2]; z <= last[2]; z++){
+					int cellCoordinates[3] = {x, y, z};
+					unsigned int cell = 0;
+					for(unsigned int c = 0; c < dimensions; c++)
+						cell = cell*numCells[c] + cellCoordinates[c];
+
+					for(
+						unsigned int n = cellStart[cell];
+						n < cellStart[cell + 1];
+						n++
+					){
+						unsigned int neighbor = cellSites[n];
+						if(t == 0 && neighbor == basisIndex)
+							continue;
+
+						double displacement[3] = {0, 0, 0};
+						double squaredDistance = 0;
+						for(unsigned int c = 0; c < dimensions; c++){
+							displacement[c] = coordinates[dimensions*neighbor + c] - center[c];
+							squaredDistance += displacement[c]*displacement[c];
+						}
+						if(squaredDistance > squaredCutoff)
+							continue;
+
+						Neighbor result;
+						result.basisIndex = neighbor;
+						result.displacement = Vector3d({
+							displacement[0],
+							displacement[1],
+							displacement[2]
+						});
+						result.distance = sqrt(squaredDistance);
+						neighbors.push_back(result);
+					}
+				}
+			}
+		}
+	}
+
+	return neighbors;
+}
+
+void NeighborIndex::setupTranslations(
+	const vector<Vector3d> &periodicVectors,
+	const double *upper
+){
+	translations.push_back(Vector3d({0., 0., 0.}));
+	if(periodicVectors.size() == 0 || numSites == 0)
+		return;
+
+	//Restrict the periodic vectors to the dimensions of the Geometry.
+	vector<Vector3d> vectors;
+	for(unsigned int n = 0; n < periodicVectors.size(); n++){
+		Vector3d v = periodicVectors[n];
+		if(dimensions < 3)
+			v.z = 0;
+		if(dimensions < 2)
+			v.y = 0;
+		TBTKAssert(
+			v.norm() > 0,
+			"NeighborIndex::NeighborIndex()",
+			"Periodic vector " << n << " is zero in the dimensions"
+			<< " of the Geometry.",
+			""
+		);
+		vectors.push_back(v);
+	}
+
+	//Invert the Gram matrix G(m, n) = v_m*v_n using Gauss-Jordan
+	//elimination. The rows of the inverse give the dual vectors
+	//d_m = sum_n G^{-1}(m, n)v_n, which satisfy d_m*v_n = delta_{mn}.
+	unsigned int numVectors = vectors.size();
+	vector<vector<double>> gram(
+		numVectors,
+		vector<double>(2*numVectors, 0)
+	);
+	double scale = 0;
+	for(unsigned int m = 0; m < numVectors; m++){
+		for(unsigned int n = 0; n < numVectors; n++){
+			gram[m][n]
+				= Vector3d::dotProduct(vectors[m], vectors[n]);
+		}
+		gram[m][numVectors + m] = 1;
+		scale = max(scale, gram[m][m]);
+	}
+	for(unsigned int c = 0; c < numVectors; c++){
+		unsigned int pivot = c;
+		for(unsigned int r = c + 1; r < numVectors; r++)
+			if(abs(gram[r][c]) > abs(gram[pivot][c]))
+				pivot = r;
+		TBTKAssert(
+			abs(gram[pivot][c]) > 1e-10*scale,
+			"NeighborIndex::NeighborIndex()",
+			"The periodic vectors are linearly dependent in the"
+			<< " dimensions of the Geometry.",
+			""
+		);
+		swap(gram[c], gram[pivot]);
+		double normalization = gram[c][c];
+		for(unsigned int n = 0; n < 2*numVectors; n++)
+			gram[c][n] /= normalization;
+		for(unsigned int r = 0; r < numVectors; r++){
+			if(r == c)
+				continue;
+			double factor = gram[r][c];
+			for(unsigned int n = 0; n < 2*numVectors; n++)
+				gram[r][n] -= factor*gram[c][n];
+		}
+	}
+
+	//An image of the bounding box can only come within the cutoff if the
+	//translation T = sum_n m_n v_n has a length of at most the diagonal
+	//plus the cutoff. Since m_n = d_n*T, the multiples are bounded by
+	//|d_n| times this length. Note that 1/|d_n| is the distance between
+	//the lattice planes spanned by the other vectors, which for skewed
+	//vectors is smaller than |v_n|.
+	double extent[3];
+	double diagonal = 0;
+	for(unsigned int c = 0; c < 3; c++){
+		extent[c] = upper[c] - lower[c];
+		diagonal += extent[c]*extent[c];
+	}
+	diagonal = sqrt(diagonal);
+	vector<int> maxMultiple;
+	for(unsigned int m = 0; m < numVectors; m++){
+		Vector3d dual({0., 0., 0.});
+		for(unsigned int n = 0; n < numVectors; n++)
+			dual = dual + gram[m][numVectors + n]*vectors[n];
+		maxMultiple.push_back(
+			(int)ceil((diagonal + cutoff)*dual.norm())
+		);
+	}
+
+	//Iterate over all combinations of multiples and keep the
+	//translations for which the translated bounding box is within the
+	//cutoff from the bounding box.
+	vector<int> multiples(vectors.size());
+	for(unsigned int n = 0; n < vectors.size(); n++)
+		multiples[n] = -maxMultiple[n];
+	while(true){
+		Vector3d translation({0., 0., 0.});
+		bool isZero = true;
+		for(unsigned int n = 0; n < vectors.size(); n++){
+			translation = translation + multiples[n]*vectors[n];
+			if(multiples[n] != 0)
+				isZero = false;
+		}
+
+		double t[3] = {translation.x, translation.y, translation.z};
+		double squaredGap = 0;
+		for(unsigned int c = 0; c < 3; c++){
+			double gap = max(abs(t[c]) - extent[c], 0.);
+			squaredGap += gap*gap;
+		}
+		if(!isZero && squaredGap <= cutoff*cutoff)
+			translations.push_back(translation);
+
+		unsigned int n = 0;
+		while(n < vectors.size() && multiples[n] == maxMultiple[n]){
+			multiples[n] = -maxMultiple[n];
+			n++;
+		}
+		if(n == vectors.size())
+			break;
+		multiples[n]++;
+	}
+}
+
+int NeighborIndex::getCellCoordinate(
+	double coordinate,
+	unsigned int dimension
+) const{
+	int cell = (int)((coordinate - lower[dimension])/cellSize);
+
+	return min(max(cell, 0), (int)numCells[dimension] - 1);
+}
+
+};	//End of namespace TBTK
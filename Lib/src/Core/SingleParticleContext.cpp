@@ -143,6 +143,27 @@ SingleParticleContext::SingleParticleContext(
 
 		break;
 	}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		statistics = reader.read<Statistics>("statistics");
+		hoppingAmplitudeSet = HoppingAmplitudeSet(
+			reader.readString("hoppingAmplitudeSet"),
+			mode
+		);
+		if(reader.hasField("geometry")){
+			geometry = new Geometry(
+				reader.readString("geometry"),
+				mode,
+				hoppingAmplitudeSet
+			);
+		}
+		else{
+			geometry = nullptr;
+		}
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"SingleParticleContext::SingleParticleContext()",
@@ -233,6 +254,19 @@ string SingleParticleContext::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("SingleParticleContext");
+		writer.write("statistics", statistics);
+		writer.writeString(
+			"hoppingAmplitudeSet",
+			hoppingAmplitudeSet.serialize(mode)
+		);
+		if(geometry != nullptr)
+			writer.writeString("geometry", geometry->serialize(mode));
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"SingleParticleContext::serialize()",
@@ -20,17 +20,133 @@
 
 #include "TBTK/DataManager.h"
 #include "TBTK/Resource.h"
+#include "TBTK/Streams.h"
 #include "TBTK/TBTKMacros.h"
 
 #include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#ifdef TBTK_HDF5_ENABLED
+#	include <H5Cpp.h>
+#endif
 
 #include "TBTK/json.hpp"
 
 using namespace std;
 //using namespace nlohmann;
+#if defined(TBTK_HDF5_ENABLED) && !defined(H5_NO_NAMESPACE)
+	using namespace H5;
+#endif
 
 namespace TBTK{
 
+/** Get the current time in seconds since the epoch. */
+static double getCurrentTime(){
+	return chrono::duration<double>(
+		chrono::system_clock::now().time_since_epoch()
+	).count();
+}
+
+/** Get the name of the host. */
+static const string& getHostName(){
+	static string hostName;
+	if(hostName.size() == 0){
+		char buffer[256];
+		if(gethostname(buffer, sizeof(buffer)) == 0){
+			buffer[sizeof(buffer) - 1] = '\0';
+			hostName = buffer;
+		}
+		else{
+			hostName = "unknown";
+		}
+	}
+
+	return hostName;
+}
+
+/** Lock or unlock a file using flock(), retrying if interrupted. */
+static int lockFile(int fileDescriptor, int operation){
+	int result;
+	do{
+		result = flock(fileDescriptor, operation);
+	}while(result == -1 && errno == EINTR);
+
+	return result;
+}
+
+/** Read size bytes at the given offset, retrying on partial reads.
+ *  Returns false if the data could not be read. */
+static bool readFully(
+	int fileDescriptor,
+	char *buffer,
+	size_t size,
+	long long offset
+){
+	size_t numRead = 0;
+	while(numRead < size){
+		ssize_t n = pread(
+			fileDescriptor,
+			buffer + numRead,
+			size - numRead,
+			offset + numRead
+		);
+		if(n == -1 && errno == EINTR)
+			continue;
+		if(n <= 0)
+			return false;
+		numRead += n;
+	}
+
+	return true;
+}
+
+/** Write size bytes, retrying on partial writes. Returns false if the
+ *  data could not be written. */
+static bool writeFully(int fileDescriptor, const char *buffer, size_t size){
+	size_t numWritten = 0;
+	while(numWritten < size){
+		ssize_t n = write(
+			fileDescriptor,
+			buffer + numWritten,
+			size - numWritten
+		);
+		if(n == -1 && errno == EINTR)
+			continue;
+		if(n <= 0)
+			return false;
+		numWritten += n;
+	}
+
+	return true;
+}
+
+/** Append a 64-bit integer to a buffer in little-endian byte order,
+ *  independently of the byte order of the host. */
+static void appendLittleEndian(string &buffer, uint64_t value){
+	for(unsigned int n = 0; n < sizeof(value); n++)
+		buffer.push_back((char)((value >> 8*n) & 0xFF));
+}
+
+/** Read a 64-bit integer stored in little-endian byte order. */
+static uint64_t readLittleEndian(const char *buffer){
+	uint64_t value = 0;
+	for(unsigned int n = 0; n < sizeof(value); n++)
+		value |= (uint64_t)(unsigned char)buffer[n] << 8*n;
+
+	return value;
+}
+
 DataManager::DataManager(
 	const vector<double> &lowerBounds,
 	const vector<double> &upperBounds,
@@ -87,6 +203,13 @@ DataManager::DataManager(
 	this->dataManagerName = dataManagerName;
 
 	this->path = "";
+
+	reservationTimeout = 0;
+	journalOffset = 0;
+	reservationSearchStart = 0;
+
+	batchSize = 64;
+	numPendingResults = 0;
 }
 
 DataManager::DataManager(const string &serialization, Mode mode){
@@ -98,6 +221,13 @@ DataManager::DataManager(const string &serialization, Mode mode){
 		""
 	);
 
+	reservationTimeout = 0;
+	journalOffset = 0;
+	reservationSearchStart = 0;
+
+	batchSize = 64;
+	numPendingResults = 0;
+
 	switch(mode){
 	case Mode::JSON:
 		try{
@@ -212,6 +342,14 @@ DataManager::DataManager(const string &serialization, Mode mode){
 }
 
 DataManager::~DataManager(){
+	if(numPendingResults != 0){
+		Streams::err << "Warning in DataManager::~DataManager(): "
+			<< numPendingResults << " buffered results are"
+			<< " discarded. Call DataManager::close() after the last"
+			<< " call to DataManager::complete() to write them to"
+			<< " file.\n";
+	}
+
 	for(unsigned int n = 0; n < reservedDataPoints.size(); n++)
 		delete [] reservedDataPoints.at(n);
 	for(unsigned int n = 0; n < completedDataPoints.size(); n++)
@@ -226,6 +364,29 @@ void DataManager::setPath(const string &path){
 	}
 }
 
+void DataManager::setJournal(
+	const string &journalFilename,
+	double reservationTimeout
+){
+	TBTKAssert(
+		reservationTimeout >= 0,
+		"DataManager::setJournal()",
+		"Invalid reservation timeout '" << reservationTimeout << "'.",
+		"The timeout must be non-negative."
+	);
+
+	this->journalFilename = journalFilename;
+	this->reservationTimeout = reservationTimeout;
+	journalOffset = 0;
+	reservations.clear();
+
+	//Read the entries that already are in the journal.
+	if(journalFilename.compare("") != 0){
+		int fileDescriptor = lockJournal();
+		unlockJournal(fileDescriptor);
+	}
+}
+
 void DataManager::addDataType(const std::string &dataType, FileType fileType){
 	for(unsigned int n = 0; n < dataTypes.size(); n++){
 		TBTKAssert(
@@ -240,15 +401,53 @@ void DataManager::addDataType(const std::string &dataType, FileType fileType){
 	dataTypes.push_back(dataType);
 	fileTypes.push_back(fileType);
 	addDataTables();
+
+	//Entries for the new data type may already have been skipped while
+	//reading the journal. Read the journal from the beginning next time.
+	journalOffset = 0;
 }
 
 int DataManager::reserveDataPoint(const std::string &dataType){
+	int fileDescriptor = -1;
+	if(journalFilename.compare("") != 0)
+		fileDescriptor = lockJournal();
+
+	//Continue the search from the last reserved data point to avoid
+	//rescanning data points that already have been completed.
+	int id = -1;
 	for(unsigned int n = 0; n < numDataPoints; n++){
-		if(reserveDataPoint(dataType, n))
-			return n;
+		unsigned int candidate
+			= (reservationSearchStart + n)%numDataPoints;
+		if(reserveDataPoint(dataType, candidate)){
+			id = candidate;
+			reservationSearchStart = (candidate + 1)%numDataPoints;
+			break;
+		}
+	}
+
+	if(fileDescriptor != -1){
+		if(id != -1)
+			appendToJournal(fileDescriptor, 'R', dataType, id);
+		unlockJournal(fileDescriptor);
 	}
 
-	return -1;
+	return id;
+}
+
+void DataManager::renewReservation(const string &dataType, int id){
+	TBTKAssert(
+		id >= 0 && (unsigned int)id < numDataPoints,
+		"DataManager::renewReservation()",
+		"The ID is out of range.",
+		""
+	);
+
+	if(journalFilename.compare("") == 0)
+		return;
+
+	int fileDescriptor = lockJournal();
+	appendToJournal(fileDescriptor, 'R', dataType, id);
+	unlockJournal(fileDescriptor);
 }
 
 vector<double> DataManager::getParameters(int id) const{
@@ -292,6 +491,17 @@ string DataManager::getFilename(const string &dataType, int id) const{
 	case FileType::PNG:
 		filename += ".png";
 		break;
+	case FileType::SerializableBinary:
+		filename = dataType + ".bin";
+		if(dataManagerName.compare("") != 0)
+			filename = dataManagerName + "_" + filename;
+		break;
+	case FileType::SerializableHDF5:
+		if(dataManagerName.compare("") != 0)
+			filename = dataManagerName + ".h5";
+		else
+			filename = "DataManager.h5";
+		break;
 	default:
 		TBTKExit(
 			"DataManager::getFilename()",
@@ -323,6 +533,12 @@ void DataManager::markCompleted(
 
 		completedDataPoints.at(dataTypeIndex)[id] = true;
 	}
+
+	if(journalFilename.compare("") != 0){
+		int fileDescriptor = lockJournal();
+		appendToJournal(fileDescriptor, 'C', dataType, id);
+		unlockJournal(fileDescriptor);
+	}
 }
 
 void DataManager::complete(
@@ -337,11 +553,30 @@ void DataManager::complete(
 		""
 	);
 
-	Resource resource;
-	string filename = path + getFilename(dataType, id);
-	switch(fileTypes.at(getDataTypeIndex(dataType))){
+	unsigned int dataTypeIndex = getDataTypeIndex(dataType);
+	switch(fileTypes.at(dataTypeIndex)){
 	case FileType::SerializableJSON:
+	{
+		Resource resource;
 		resource.setData(serializable.serialize(Mode::JSON));
+		resource.write(path + getFilename(dataType, id));
+
+		markCompleted(dataType, id);
+
+		break;
+	}
+	case FileType::SerializableBinary:
+	case FileType::SerializableHDF5:
+		//The data point is marked completed by flush() once the result
+		//has been written to file.
+		pendingResults.resize(dataTypes.size());
+		pendingResults.at(dataTypeIndex).push_back(
+			make_pair(id, serializable.serialize(Mode::Binary))
+		);
+		numPendingResults++;
+		if(numPendingResults >= batchSize)
+			flush();
+
 		break;
 	default:
 		TBTKExit(
@@ -354,10 +589,120 @@ void DataManager::complete(
 			<< " completed using DataManager::markCompleted()."
 		);
 	}
+}
+
+void DataManager::setBatchSize(unsigned int batchSize){
+	TBTKAssert(
+		batchSize > 0,
+		"DataManager::setBatchSize()",
+		"The batch size must be larger than zero.",
+		""
+	);
+
+	this->batchSize = batchSize;
+	if(numPendingResults >= batchSize)
+		flush();
+}
+
+void DataManager::flush(){
+	for(unsigned int n = 0; n < pendingResults.size(); n++){
+		vector<pair<unsigned int, string>> &results
+			= pendingResults.at(n);
+		if(results.size() == 0)
+			continue;
+
+		switch(fileTypes.at(n)){
+		case FileType::SerializableBinary:
+			flushBinary(n);
+			break;
+		case FileType::SerializableHDF5:
+			flushHDF5(n);
+			break;
+		default:
+			TBTKExit(
+				"DataManager::flush()",
+				"Unsupported file type.",
+				"This should never happen, contact the"
+				<< " developer."
+			);
+		}
+
+		//Mark the whole batch completed while holding the journal
+		//lock once.
+		int fileDescriptor = -1;
+		if(journalFilename.compare("") != 0)
+			fileDescriptor = lockJournal();
+		for(unsigned int c = 0; c < results.size(); c++){
+			completedDataPoints.at(n)[results[c].first] = true;
+			if(fileDescriptor != -1){
+				appendToJournal(
+					fileDescriptor,
+					'C',
+					dataTypes.at(n),
+					results[c].first
+				);
+			}
+		}
+		if(fileDescriptor != -1)
+			unlockJournal(fileDescriptor);
+
+		results.clear();
+	}
+	numPendingResults = 0;
+}
+
+void DataManager::close(){
+	flush();
+}
+
+string DataManager::getSerialization(const string &dataType, int id) const{
+	TBTKAssert(
+		id >= 0 && (unsigned int)id < numDataPoints,
+		"DataManager::getSerialization()",
+		"The ID is out of range.",
+		""
+	);
+
+	unsigned int dataTypeIndex = getDataTypeIndex(dataType);
+	switch(fileTypes.at(dataTypeIndex)){
+	case FileType::SerializableJSON:
+	{
+		Resource resource;
+		resource.read(path + getFilename(dataType, id));
 
-	resource.write(filename);
+		return resource.getData();
+	}
+	case FileType::SerializableBinary:
+		return readBinary(dataTypeIndex, id);
+	case FileType::SerializableHDF5:
+		return readHDF5(dataTypeIndex, id);
+	default:
+		TBTKExit(
+			"DataManager::getSerialization()",
+			"Data type '" << dataType << "' is not stored as a"
+			<< " serialization.",
+			""
+		);
+	}
+}
 
-	markCompleted(dataType, id);
+Serializable::Mode DataManager::getSerializationMode(
+	const string &dataType
+) const{
+	switch(fileTypes.at(getDataTypeIndex(dataType))){
+	case FileType::SerializableJSON:
+		return Mode::JSON;
+	case FileType::SerializableBinary:
+	case FileType::SerializableHDF5:
+		return Mode::Binary;
+	default:
+		TBTKExit(
+			"DataManager::getSerializationMode()",
+			"Data type '" << dataType << "' is not stored as a"
+			<< " serialization.",
+			""
+		);
+	}
 }
 
 void DataManager::addDataTables(){
@@ -444,7 +789,7 @@ bool DataManager::reserveDataPoint(
 		for(unsigned int n = 0; n < dataTypes.size(); n++){
 			if(
 				completedDataPoints.at(n)[id]
-				|| reservedDataPoints.at(n)[id]
+				|| isReserved(n, id)
 			){
 				return false;
 			}
@@ -459,7 +804,7 @@ bool DataManager::reserveDataPoint(
 
 		if(
 			!completedDataPoints.at(dataTypeIndex)[id]
-			&& !reservedDataPoints.at(dataTypeIndex)[id]
+			&& !isReserved(dataTypeIndex, id)
 		){
 			reservedDataPoints.at(dataTypeIndex)[id] = true;
 			return true;
@@ -469,6 +814,506 @@ bool DataManager::reserveDataPoint(
 	}
 }
 
+bool DataManager::isReserved(
+	unsigned int dataTypeIndex,
+	unsigned int id
+) const{
+	if(!reservedDataPoints.at(dataTypeIndex)[id])
+		return false;
+	if(journalFilename.compare("") == 0)
+		return true;
+
+	map<pair<unsigned int, unsigned int>, Reservation>::const_iterator
+		iterator = reservations.find(make_pair(dataTypeIndex, id));
+	if(iterator == reservations.end())
+		return true;
+
+	const Reservation &reservation = iterator->second;
+	if(
+		reservationTimeout > 0
+		&& getCurrentTime() - reservation.time > reservationTimeout
+	){
+		return false;
+	}
+
+	//Release reservations held by processes on this host that no longer
+	//exist.
+	if(
+		reservation.isLocal
+		&& reservation.processID != getpid()
+		&& kill(reservation.processID, 0) == -1
+		&& errno == ESRCH
+	){
+		return false;
+	}
+
+	return true;
+}
+
+int DataManager::lockJournal(){
+	int fileDescriptor = open(
+		journalFilename.c_str(),
+		O_RDWR | O_CREAT | O_APPEND,
+		0644
+	);
+	TBTKAssert(
+		fileDescriptor != -1,
+		"DataManager::lockJournal()",
+		"Unable to open the journal '" << journalFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+
+	int result = lockFile(fileDescriptor, LOCK_EX);
+	TBTKAssert(
+		result == 0,
+		"DataManager::lockJournal()",
+		"Unable to lock the journal '" << journalFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+
+	long long size = lseek(fileDescriptor, 0, SEEK_END);
+	TBTKAssert(
+		size >= 0,
+		"DataManager::lockJournal()",
+		"Unable to read the journal '" << journalFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+	//The journal has been replaced. Read it from the beginning.
+	if(size < journalOffset)
+		journalOffset = 0;
+	if(size == journalOffset)
+		return fileDescriptor;
+
+	string buffer(size - journalOffset, '\0');
+	bool success = readFully(
+		fileDescriptor,
+		&buffer[0],
+		buffer.size(),
+		journalOffset
+	);
+	TBTKAssert(
+		success,
+		"DataManager::lockJournal()",
+		"Unable to read the journal '" << journalFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+
+	size_t lineStart = 0;
+	size_t lineEnd;
+	while((lineEnd = buffer.find('\n', lineStart)) != string::npos){
+		applyJournalEntry(buffer.substr(lineStart, lineEnd - lineStart));
+		lineStart = lineEnd + 1;
+	}
+	journalOffset += buffer.size();
+
+	//Entries are written while holding the lock, so an unterminated
+	//entry is left by a process that died while writing. Terminate it to
+	//keep it from being joined with the next entry.
+	if(lineStart != buffer.size() && writeFully(fileDescriptor, "\n", 1))
+		journalOffset++;
+
+	return fileDescriptor;
+}
+
+void DataManager::appendToJournal(
+	int fileDescriptor,
+	char entryType,
+	const string &dataType,
+	unsigned int id
+){
+	double time = getCurrentTime();
+	stringstream ss;
+	ss << fixed << setprecision(3);
+	for(unsigned int n = 0; n < dataTypes.size(); n++){
+		if(
+			dataType.compare("") != 0
+			&& dataTypes.at(n).compare(dataType) != 0
+		){
+			continue;
+		}
+
+		switch(entryType){
+		case 'R':
+		{
+			ss << "R\t" << id << "\t" << getHostName() << "\t"
+				<< getpid() << "\t" << time << "\t"
+				<< dataTypes.at(n) << "\n";
+
+			Reservation &reservation
+				= reservations[make_pair(n, id)];
+			reservation.time = time;
+			reservation.processID = getpid();
+			reservation.isLocal = true;
+			break;
+		}
+		case 'C':
+			ss << "C\t" << id << "\t" << dataTypes.at(n) << "\n";
+			reservations.erase(make_pair(n, id));
+			break;
+		default:
+			TBTKExit(
+				"DataManager::appendToJournal()",
+				"Unknown entry type '" << entryType << "'.",
+				"This should never happen, contact the developer."
+			);
+		}
+	}
+
+	string entries = ss.str();
+	bool success = writeFully(fileDescriptor, entries.data(), entries.size());
+	TBTKAssert(
+		success,
+		"DataManager::appendToJournal()",
+		"Unable to write to the journal '" << journalFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+	journalOffset += entries.size();
+}
+
+void DataManager::unlockJournal(int fileDescriptor){
+	lockFile(fileDescriptor, LOCK_UN);
+	::close(fileDescriptor);
+}
+
+void DataManager::applyJournalEntry(const string &entry){
+	vector<string> fields;
+	stringstream ss(entry);
+	string field;
+	while(getline(ss, field, '\t'))
+		fields.push_back(field);
+
+	//Malformed entries can only be left by processes that died while
+	//writing and are ignored, as are entries for unknown data types.
+	if(fields.size() == 0)
+		return;
+
+	const string &dataType = fields.back();
+	unsigned int dataTypeIndex = 0;
+	while(
+		dataTypeIndex < dataTypes.size()
+		&& dataTypes.at(dataTypeIndex).compare(dataType) != 0
+	){
+		dataTypeIndex++;
+	}
+	if(dataTypeIndex == dataTypes.size())
+		return;
+
+	try{
+		if(fields[0].compare("R") == 0 && fields.size() == 6){
+			unsigned long id = stoul(fields[1]);
+			if(id >= numDataPoints)
+				return;
+
+			Reservation reservation;
+			reservation.isLocal = fields[2].compare(getHostName()) == 0;
+			reservation.processID = stoi(fields[3]);
+			reservation.time = stod(fields[4]);
+
+			reservedDataPoints.at(dataTypeIndex)[id] = true;
+			reservations[make_pair(dataTypeIndex, id)] = reservation;
+		}
+		else if(fields[0].compare("C") == 0 && fields.size() == 3){
+			unsigned long id = stoul(fields[1]);
+			if(id >= numDataPoints)
+				return;
+
+			completedDataPoints.at(dataTypeIndex)[id] = true;
+			reservations.erase(make_pair(dataTypeIndex, id));
+		}
+	}
+	catch(const invalid_argument &e){
+	}
+	catch(const out_of_range &e){
+	}
+}
+
+void DataManager::flushBinary(unsigned int dataTypeIndex){
+	//Each record consists of the ID and the size of the serialization as
+	//little-endian 64-bit integers, followed by the serialization.
+	const vector<pair<unsigned int, string>> &results
+		= pendingResults.at(dataTypeIndex);
+	string buffer;
+	for(unsigned int n = 0; n < results.size(); n++){
+		appendLittleEndian(buffer, results[n].first);
+		appendLittleEndian(buffer, results[n].second.size());
+		buffer.append(results[n].second);
+	}
+
+	string filename = path + getFilename(dataTypes.at(dataTypeIndex), 0);
+	int fileDescriptor = open(
+		filename.c_str(),
+		O_WRONLY | O_CREAT | O_APPEND,
+		0644
+	);
+	TBTKAssert(
+		fileDescriptor != -1,
+		"DataManager::flushBinary()",
+		"Unable to open the file '" << filename << "'. "
+		<< strerror(errno),
+		""
+	);
+	lockFile(fileDescriptor, LOCK_EX);
+	bool success = writeFully(fileDescriptor, buffer.data(), buffer.size());
+	int error = errno;
+	lockFile(fileDescriptor, LOCK_UN);
+	::close(fileDescriptor);
+	TBTKAssert(
+		success,
+		"DataManager::flushBinary()",
+		"Unable to write to the file '" << filename << "'. "
+		<< strerror(error),
+		""
+	);
+}
+
+void DataManager::flushHDF5(unsigned int dataTypeIndex){
+#ifdef TBTK_HDF5_ENABLED
+	const vector<pair<unsigned int, string>> &results
+		= pendingResults.at(dataTypeIndex);
+	const string &dataType = dataTypes.at(dataTypeIndex);
+	string filename = path + getFilename(dataType, 0);
+
+	//HDF5 files can not be written to by several processes at the same
+	//time. Serialize the access through a lock file.
+	string lockFilename = filename + ".lock";
+	int lockDescriptor = open(lockFilename.c_str(), O_RDWR | O_CREAT, 0644);
+	TBTKAssert(
+		lockDescriptor != -1,
+		"DataManager::flushHDF5()",
+		"Unable to open the file '" << lockFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+	lockFile(lockDescriptor, LOCK_EX);
+
+	try{
+		H5::Exception::dontPrint();
+		H5File file(
+			filename,
+			access(filename.c_str(), F_OK) == 0
+				? H5F_ACC_RDWR
+				: H5F_ACC_TRUNC
+		);
+
+		//One dataset per data type with one variable length element
+		//per data point.
+		VarLenType type(&PredType::NATIVE_UINT8);
+		DataSet dataset;
+		if(H5Lexists(file.getId(), dataType.c_str(), H5P_DEFAULT) > 0){
+			dataset = file.openDataSet(dataType);
+		}
+		else{
+			hsize_t dimensions[1] = {numDataPoints};
+			DataSpace dataspace(1, dimensions);
+			DSetCreatPropList propertyList;
+			hsize_t chunkDimensions[1] = {min(numDataPoints, 1024u)};
+			propertyList.setChunk(1, chunkDimensions);
+			dataset = file.createDataSet(
+				dataType,
+				type,
+				dataspace,
+				propertyList
+			);
+		}
+
+		vector<hvl_t> buffer(results.size());
+		vector<hsize_t> coordinates(results.size());
+		for(unsigned int n = 0; n < results.size(); n++){
+			buffer[n].len = results[n].second.size();
+			buffer[n].p = (void*)results[n].second.data();
+			coordinates[n] = results[n].first;
+		}
+		DataSpace fileDataspace = dataset.getSpace();
+		fileDataspace.selectElements(
+			H5S_SELECT_SET,
+			results.size(),
+			coordinates.data()
+		);
+		hsize_t memoryDimensions[1] = {results.size()};
+		DataSpace memoryDataspace(1, memoryDimensions);
+		dataset.write(
+			buffer.data(),
+			type,
+			memoryDataspace,
+			fileDataspace
+		);
+		dataset.close();
+		file.close();
+	}
+	catch(const H5::Exception &error){
+		lockFile(lockDescriptor, LOCK_UN);
+		::close(lockDescriptor);
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"DataManager::flushHDF5()",
+			"While writing to '" << filename << "'.",
+			""
+		);
+	}
+
+	lockFile(lockDescriptor, LOCK_UN);
+	::close(lockDescriptor);
+#else
+	TBTKExit(
+		"DataManager::flushHDF5()",
+		"FileType::SerializableHDF5 is not supported.",
+		"TBTK has been built without HDF5."
+	);
+#endif
+}
+
+string DataManager::readBinary(
+	unsigned int dataTypeIndex,
+	unsigned int id
+) const{
+	string filename = path + getFilename(dataTypes.at(dataTypeIndex), 0);
+	int fileDescriptor = open(filename.c_str(), O_RDONLY);
+	TBTKAssert(
+		fileDescriptor != -1,
+		"DataManager::readBinary()",
+		"Unable to open the file '" << filename << "'. "
+		<< strerror(errno),
+		""
+	);
+	lockFile(fileDescriptor, LOCK_SH);
+
+	//Extend the index with the records that have been appended since the
+	//last read. Later records for the same ID replace earlier ones.
+	binaryIndices.resize(dataTypes.size());
+	binaryIndexOffsets.resize(dataTypes.size(), 0);
+	map<unsigned int, pair<long long, long long>> &index
+		= binaryIndices.at(dataTypeIndex);
+	long long &offset = binaryIndexOffsets.at(dataTypeIndex);
+	long long size = lseek(fileDescriptor, 0, SEEK_END);
+	if(size < offset){
+		index.clear();
+		offset = 0;
+	}
+	char header[2*sizeof(uint64_t)];
+	while(
+		offset + (long long)sizeof(header) <= size
+		&& readFully(fileDescriptor, header, sizeof(header), offset)
+	){
+		uint64_t recordID = readLittleEndian(header);
+		uint64_t serializationSize
+			= readLittleEndian(header + sizeof(uint64_t));
+		long long recordSize = sizeof(header) + serializationSize;
+		if(offset + recordSize > size)
+			break;
+		index[recordID] = make_pair(
+			offset + sizeof(header),
+			serializationSize
+		);
+		offset += recordSize;
+	}
+
+	map<unsigned int, pair<long long, long long>>::const_iterator iterator
+		= index.find(id);
+	if(iterator == index.end()){
+		lockFile(fileDescriptor, LOCK_UN);
+		::close(fileDescriptor);
+		TBTKExit(
+			"DataManager::readBinary()",
+			"No result stored for data point '" << id << "' in '"
+			<< filename << "'.",
+			""
+		);
+	}
+
+	string serialization(iterator->second.second, '\0');
+	bool success = readFully(
+		fileDescriptor,
+		&serialization[0],
+		serialization.size(),
+		iterator->second.first
+	);
+	lockFile(fileDescriptor, LOCK_UN);
+	::close(fileDescriptor);
+	TBTKAssert(
+		success,
+		"DataManager::readBinary()",
+		"Unable to read from the file '" << filename << "'.",
+		""
+	);
+
+	return serialization;
+}
+
+string DataManager::readHDF5(
+	unsigned int dataTypeIndex,
+	unsigned int id
+) const{
+#ifdef TBTK_HDF5_ENABLED
+	const string &dataType = dataTypes.at(dataTypeIndex);
+	string filename = path + getFilename(dataType, 0);
+	string lockFilename = filename + ".lock";
+	int lockDescriptor = open(lockFilename.c_str(), O_RDWR | O_CREAT, 0644);
+	TBTKAssert(
+		lockDescriptor != -1,
+		"DataManager::readHDF5()",
+		"Unable to open the file '" << lockFilename << "'. "
+		<< strerror(errno),
+		""
+	);
+	lockFile(lockDescriptor, LOCK_SH);
+
+	string serialization;
+	try{
+		H5::Exception::dontPrint();
+		H5File file(filename, H5F_ACC_RDONLY);
+		DataSet dataset = file.openDataSet(dataType);
+		VarLenType type(&PredType::NATIVE_UINT8);
+
+		DataSpace fileDataspace = dataset.getSpace();
+		hsize_t offset[1] = {id};
+		hsize_t count[1] = {1};
+		fileDataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+		DataSpace memoryDataspace(1, count);
+		hvl_t element;
+		dataset.read(&element, type, memoryDataspace, fileDataspace);
+		serialization.assign((const char*)element.p, element.len);
+		DataSet::vlenReclaim(&element, type, memoryDataspace);
+
+		dataset.close();
+		file.close();
+	}
+	catch(const H5::Exception &error){
+		lockFile(lockDescriptor, LOCK_UN);
+		::close(lockDescriptor);
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"DataManager::readHDF5()",
+			"While reading from '" << filename << "'.",
+			""
+		);
+	}
+
+	lockFile(lockDescriptor, LOCK_UN);
+	::close(lockDescriptor);
+
+	TBTKAssert(
+		serialization.size() != 0,
+		"DataManager::readHDF5()",
+		"No result stored for data point '" << id << "' in '"
+		<< filename << "'.",
+		""
+	);
+
+	return serialization;
+#else
+	TBTKExit(
+		"DataManager::readHDF5()",
+		"FileType::SerializableHDF5 is not supported.",
+		"TBTK has been built without HDF5."
+	);
+#endif
+}
+
 string DataManager::serialize(Mode mode) const{
 	switch(mode){
 	case Mode::JSON:
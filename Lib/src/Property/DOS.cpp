@@ -111,10 +111,20 @@ DOS::DOS(
 		}
 
 		break;
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		lowerBound = reader.read<double>("lowerBound");
+		upperBound = reader.read<double>("upperBound");
+		resolution = reader.read<int32_t>("resolution");
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"DOS::DOS()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -160,10 +170,24 @@ string DOS::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("DOS");
+		writer.write("lowerBound", lowerBound);
+		writer.write("upperBound", upperBound);
+		writer.write<int32_t>("resolution", resolution);
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"DOS::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
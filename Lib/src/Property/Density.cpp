@@ -113,9 +113,9 @@ Density& Density::operator=(Density &&rhs){
 }*/
 
 double Density::getMin() const{
-	const std::vector<double> &data = getData();
+	const double *data = getDataPointer();
 	double min = data[0];
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(data[n] < min)
 			min = data[n];
 
@@ -123,9 +123,9 @@ double Density::getMin() const{
 }
 
 double Density::getMax() const{
-	const std::vector<double> &data = getData();
+	const double *data = getDataPointer();
 	double max = data[0];
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(data[n] > max)
 			max = data[n];
 
@@ -144,10 +144,21 @@ string Density::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("Density");
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Density::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -108,10 +108,21 @@ string EigenValues::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("EigenValues");
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"EigenValues::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
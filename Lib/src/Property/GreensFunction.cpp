@@ -21,6 +21,8 @@
 #include "TBTK/Property/GreensFunction.h"
 #include "TBTK/TBTKMacros.h"
 
+#include "TBTK/json.hpp"
+
 using namespace std;
 
 namespace TBTK{
@@ -103,5 +105,93 @@ GreensFunction::GreensFunction(
 {
 }
 
+GreensFunction::GreensFunction(
+	const string &serialization,
+	Mode mode
+) :
+	EnergyResolvedProperty(
+		extract(
+			serialization,
+			mode,
+			"energyResolvedProperty"
+		),
+		mode
+	)
+{
+	TBTKAssert(
+		validate(serialization, "GreensFunction", mode),
+		"Property::GreensFunction::GreensFunction()",
+		"Unable to parse string as GreensFunction '" << serialization
+		<< "'.",
+		""
+	);
+
+	switch(mode){
+	case Mode::JSON:
+		try{
+			nlohmann::json j = nlohmann::json::parse(serialization);
+			type = static_cast<Type>(j.at("type").get<int>());
+		}
+		catch(nlohmann::json::exception e){
+			TBTKExit(
+				"Property::GreensFunction::GreensFunction()",
+				"Unable to parse string as GreensFunction '"
+				<< serialization << "'.",
+				""
+			);
+		}
+
+		break;
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		type = static_cast<Type>(reader.read<int32_t>("type"));
+
+		break;
+	}
+	default:
+		TBTKExit(
+			"Property::GreensFunction::GreensFunction()",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
+			""
+		);
+	}
+}
+
+string GreensFunction::serialize(Mode mode) const{
+	switch(mode){
+	case Mode::JSON:
+	{
+		nlohmann::json j;
+		j["id"] = "GreensFunction";
+		j["type"] = static_cast<int>(type);
+		j["energyResolvedProperty"] = nlohmann::json::parse(
+			EnergyResolvedProperty::serialize(mode)
+		);
+
+		return j.dump();
+	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("GreensFunction");
+		writer.write("type", static_cast<int32_t>(type));
+		writer.writeString(
+			"energyResolvedProperty",
+			EnergyResolvedProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
+	default:
+		TBTKExit(
+			"Property::GreensFunction::serialize()",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
+			""
+		);
+	}
+}
+
 };	//End of namespace Property
 };	//End of namespace TBTK
@@ -220,6 +220,48 @@ IndexDescriptor::IndexDescriptor(const std::string &serialization, Mode mode){
 			);
 		}
 		break;
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		int f = reader.read<int32_t>("format");
+		switch(f){
+		case static_cast<int>(Format::None):
+			format = Format::None;
+			break;
+		case static_cast<int>(Format::Ranges):
+		{
+			format = Format::Ranges;
+
+			vector<int> ranges = reader.readArray<int32_t>("ranges");
+			descriptor.rangeFormat.dimensions = ranges.size();
+			descriptor.rangeFormat.ranges = new int[ranges.size()];
+			for(unsigned int n = 0; n < ranges.size(); n++)
+				descriptor.rangeFormat.ranges[n] = ranges[n];
+
+			break;
+		}
+		case static_cast<int>(Format::Custom):
+			format = Format::Custom;
+
+			descriptor.customFormat.indexTree = new IndexTree(
+				reader.readString("indexTree"),
+				mode
+			);
+
+			break;
+		default:
+			TBTKExit(
+				"IndexDescriptor::IndexDescriptor",
+				"Unknown Format '" << f << "'.",
+				"The serialization string is either corrupted"
+				<< " or the serialization was created with a"
+				<< " newer version of TBTK that supports more"
+				<< " formats."
+			);
+		}
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"IndexDescriptor::IndexDescriptor()",
@@ -427,6 +469,47 @@ std::string IndexDescriptor::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("IndexDescriptor");
+		writer.write("format", static_cast<int32_t>(format));
+		switch(format){
+		case Format::None:
+			break;
+		case Format::Ranges:
+			writer.writeArray<int32_t>(
+				"ranges",
+				descriptor.rangeFormat.ranges,
+				descriptor.rangeFormat.dimensions
+			);
+			break;
+		case Format::Custom:
+			writer.writeString(
+				"indexTree",
+				descriptor.customFormat.indexTree->serialize(
+					mode
+				)
+			);
+			break;
+		case Format::Dynamic:
+		{
+			TBTKExit(
+				"IndexDescriptor::serialize()",
+				"Serializable::Mode::Binary is not supported"
+				<< " for Format::Dynamic.",
+				"Use Serializable::Mode::JSON instead."
+			);
+		}
+		default:
+			TBTKExit(
+				"IndexDescriptor::serialize()",
+				"Unknown Format.",
+				"This should never happen, contact the developer."
+			);
+		}
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"IndexDescriptor::serialize()",
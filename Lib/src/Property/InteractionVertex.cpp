@@ -84,5 +84,52 @@ InteractionVertex::InteractionVertex(
 {
 }
 
+InteractionVertex::InteractionVertex(
+	const IndexTree &indexTree,
+	const vector<double> &energies
+) :
+	EnergyResolvedProperty(indexTree, energies)
+{
+}
+
+InteractionVertex::InteractionVertex(
+	const IndexTree &indexTree,
+	const vector<double> &energies,
+	const complex<double> *data
+) :
+	EnergyResolvedProperty(indexTree, energies, data)
+{
+}
+
+InteractionVertex::InteractionVertex(
+	const IndexTree &indexTree,
+	const vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy
+) :
+	EnergyResolvedProperty(
+		EnergyType::BosonicMatsubara,
+		indexTree,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy
+	)
+{
+}
+
+InteractionVertex::InteractionVertex(
+	const IndexTree &indexTree,
+	const vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy,
+	const complex<double> *data
+) :
+	EnergyResolvedProperty(
+		EnergyType::BosonicMatsubara,
+		indexTree,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy,
+		data
+	)
+{
+}
+
 };	//End of namespace Property
 };	//End of namespace TBTK
@@ -142,10 +142,20 @@ LDOS::LDOS(
 		}
 
 		break;
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		lowerBound = reader.read<double>("lowerBound");
+		upperBound = reader.read<double>("upperBound");
+		resolution = reader.read<int32_t>("resolution");
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"LDOS::LDOS()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -193,10 +203,24 @@ string LDOS::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("LDOS");
+		writer.write("lowerBound", lowerBound);
+		writer.write("upperBound", upperBound);
+		writer.write<int32_t>("resolution", resolution);
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"LDOS::serialize()",
-			"Onle Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -87,6 +87,53 @@ Susceptibility::Susceptibility(
 {
 }
 
+Susceptibility::Susceptibility(
+	const IndexTree &indexTree,
+	const vector<double> &energies
+) :
+	EnergyResolvedProperty(indexTree, energies)
+{
+}
+
+Susceptibility::Susceptibility(
+	const IndexTree &indexTree,
+	const vector<double> &energies,
+	const complex<double> *data
+) :
+	EnergyResolvedProperty(indexTree, energies, data)
+{
+}
+
+Susceptibility::Susceptibility(
+	const IndexTree &indexTree,
+	const vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy
+) :
+	EnergyResolvedProperty(
+		EnergyType::BosonicMatsubara,
+		indexTree,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy
+	)
+{
+}
+
+Susceptibility::Susceptibility(
+	const IndexTree &indexTree,
+	const vector<int> &matsubaraEnergyIndices,
+	double fundamentalMatsubaraEnergy,
+	const complex<double> *data
+) :
+	EnergyResolvedProperty(
+		EnergyType::BosonicMatsubara,
+		indexTree,
+		matsubaraEnergyIndices,
+		fundamentalMatsubaraEnergy,
+		data
+	)
+{
+}
+
 Susceptibility::Susceptibility(
 	const string &serialization,
 	Mode mode
@@ -122,11 +169,14 @@ Susceptibility::Susceptibility(
 			);
 		}
 
+		break;
+	case Mode::Binary:
 		break;
 	default:
 		TBTKExit(
 			"Property::Susceptibility::Susceptibility()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -144,10 +194,21 @@ string Susceptibility::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("Susceptibility");
+		writer.writeString(
+			"energyResolvedProperty",
+			EnergyResolvedProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"Property::Susceptibility::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
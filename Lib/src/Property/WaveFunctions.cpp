@@ -175,10 +175,19 @@ WaveFunctions::WaveFunctions(
 		}
 
 		break;
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		isContinuous = reader.read<bool>("isContinuous");
+		states = reader.readArray<uint32_t>("states");
+
+		break;
+	}
 	default:
 		TBTKExit(
 			"WaveFunctions::WaveFunctions()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -265,9 +274,9 @@ complex<double>& WaveFunctions::operator()(
 }
 
 double WaveFunctions::getMinAbs() const{
-	const std::vector<complex<double>> &data = getData();
+	const complex<double> *data = getDataPointer();
 	double min = abs(data[0]);
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(abs(data[n]) < min)
 			min = abs(data[n]);
 
@@ -275,9 +284,9 @@ double WaveFunctions::getMinAbs() const{
 }
 
 double WaveFunctions::getMaxAbs() const{
-	const std::vector<complex<double>> &data = getData();
+	const complex<double> *data = getDataPointer();
 	double max = abs(data[0]);
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(abs(data[n]) > max)
 			max = abs(data[n]);
 
@@ -285,9 +294,9 @@ double WaveFunctions::getMaxAbs() const{
 }
 
 double WaveFunctions::getMinArg() const{
-	const std::vector<complex<double>> &data = getData();
+	const complex<double> *data = getDataPointer();
 	double min = arg(data[0]);
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(arg(data[n]) < min)
 			min = arg(data[n]);
 
@@ -295,9 +304,9 @@ double WaveFunctions::getMinArg() const{
 }
 
 double WaveFunctions::getMaxArg() const{
-	const std::vector<complex<double>> &data = getData();
+	const complex<double> *data = getDataPointer();
 	double max = arg(data[0]);
-	for(unsigned int n = 1; n < data.size(); n++)
+	for(unsigned int n = 1; n < getSize(); n++)
 		if(arg(data[n]) > max)
 			max = arg(data[n]);
 
@@ -319,10 +328,23 @@ string WaveFunctions::serialize(Mode mode) const{
 
 		return j.dump();
 	}
+	case Mode::Binary:
+	{
+		BinaryWriter writer("WaveFunctions");
+		writer.write("isContinuous", isContinuous);
+		writer.writeArray<uint32_t>("states", states);
+		writer.writeString(
+			"abstractProperty",
+			AbstractProperty::serialize(mode)
+		);
+
+		return writer.getSerialization();
+	}
 	default:
 		TBTKExit(
 			"WaveFunctions::serialize()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -39,7 +39,7 @@ ArnoldiIterator::ArnoldiIterator(Solver::ArnoldiIterator &aSolver){
 }*/
 
 Property::EigenValues ArnoldiIterator::getEigenValues(){
-	int size = aSolver->getNumEigenValues();
+	int size = aSolver->getNumCalculatedEigenValues();
 	const complex<double> *ev = aSolver->getEigenValues();
 
 	Property::EigenValues eigenValues(size);
@@ -124,7 +124,7 @@ Property::WaveFunctions ArnoldiIterator::calculateWaveFunctions(
 
 	complex<double> *positions = new complex<double>[numPoles];
 	complex<double> *amplitudes = new complex<double>[numPoles];
-	for(int n = 0; n < aSolver->getNumEigenValues(); n++){
+	for(int n = 0; n < aSolver->getNumCalculatedEigenValues(); n++){
 		positions[n] = aSolver->getEigenValue(n);
 
 		complex<double> uTo = aSolver->getAmplitude(n, to);
@@ -157,7 +157,7 @@ Property::DOS ArnoldiIterator::calculateDOS(){
 	Property::DOS dos(lowerBound, upperBound, energyResolution);
 	std::vector<double> &data = dos.getDataRW();
 	double dE = (upperBound - lowerBound)/energyResolution;
-	for(int n = 0; n < aSolver->getNumEigenValues(); n++){
+	for(int n = 0; n < aSolver->getNumCalculatedEigenValues(); n++){
 		int e = (int)(((real(ev[n]) - lowerBound)/(upperBound - lowerBound))*energyResolution);
 		if(e >= 0 && e < energyResolution){
 			data[e] += 1./dE;
@@ -453,7 +453,7 @@ void ArnoldiIterator::calculateLDOSCallback(
 	int energyResolution = pe->getEnergyResolution();
 
 	double dE = (upperBound - lowerBound)/energyResolution;
-	for(int n = 0; n < pe->aSolver->getNumEigenValues(); n++){
+	for(int n = 0; n < pe->aSolver->getNumCalculatedEigenValues(); n++){
 		if(real(eigenValues[n]) > l_lim && real(eigenValues[n]) < u_lim){
 			complex<double> u = pe->aSolver->getAmplitude(n, index);
 
@@ -491,7 +491,7 @@ void ArnoldiIterator::calculateSpinPolarizedLDOSCallback(
 	index_u.at(spin_index) = 0;
 	index_d.at(spin_index) = 1;
 	double dE = (upperBound - lowerBound)/energyResolution;
-	for(int n = 0; n < pe->aSolver->getNumEigenValues(); n++){
+	for(int n = 0; n < pe->aSolver->getNumCalculatedEigenValues(); n++){
 		if(real(eigenValues[n]) > l_lim && real(eigenValues[n]) < u_lim){
 			complex<double> u_u = pe->aSolver->getAmplitude(n, index_u);
 			complex<double> u_d = pe->aSolver->getAmplitude(n, index_d);
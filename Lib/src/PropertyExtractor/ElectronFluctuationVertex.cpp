@@ -400,12 +400,17 @@ Property::InteractionVertex ElectronFluctuationVertex::calculateInteractionVerte
 	switch(chargeSusceptibility.getEnergyType()){
 	case Property::EnergyResolvedProperty<complex<double>>::EnergyType::Real:
 	{
-		Property::InteractionVertex interactionVertex(
-			memoryLayout,
-			chargeSusceptibility.getLowerBound(),
-			chargeSusceptibility.getUpperBound(),
-			chargeSusceptibility.getResolution()
-		);
+		Property::InteractionVertex interactionVertex = chargeSusceptibility.isUniform()
+			? Property::InteractionVertex(
+				memoryLayout,
+				chargeSusceptibility.getLowerBound(),
+				chargeSusceptibility.getUpperBound(),
+				chargeSusceptibility.getResolution()
+			)
+			: Property::InteractionVertex(
+				memoryLayout,
+				chargeSusceptibility.getEnergies()
+			);
 
 		calculate(
 			calculateInteractionVertexCallback,
@@ -418,12 +423,18 @@ Property::InteractionVertex ElectronFluctuationVertex::calculateInteractionVerte
 	}
 	case Property::EnergyResolvedProperty<complex<double>>::EnergyType::BosonicMatsubara:
 	{
-		Property::InteractionVertex interactionVertex(
-			memoryLayout,
-			chargeSusceptibility.getLowerMatsubaraEnergyIndex(),
-			chargeSusceptibility.getUpperMatsubaraEnergyIndex(),
-			chargeSusceptibility.getFundamentalMatsubaraEnergy()
-		);
+		Property::InteractionVertex interactionVertex = chargeSusceptibility.isUniform()
+			? Property::InteractionVertex(
+				memoryLayout,
+				chargeSusceptibility.getLowerMatsubaraEnergyIndex(),
+				chargeSusceptibility.getUpperMatsubaraEnergyIndex(),
+				chargeSusceptibility.getFundamentalMatsubaraEnergy()
+			)
+			: Property::InteractionVertex(
+				memoryLayout,
+				chargeSusceptibility.getMatsubaraEnergyIndices(),
+				chargeSusceptibility.getFundamentalMatsubaraEnergy()
+			);
 
 		calculate(
 			calculateInteractionVertexCallback,
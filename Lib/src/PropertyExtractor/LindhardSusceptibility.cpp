@@ -49,6 +49,7 @@ void LindhardSusceptibility::setEnergyWindow(
 	);
 
 	energyType = EnergyType::Real;
+	nonUniformEnergies.clear();
 }
 
 void LindhardSusceptibility::setEnergyWindow(
@@ -95,6 +96,44 @@ void LindhardSusceptibility::setEnergyWindow(
 		= lowerBosonicMatsubaraEnergyIndex;
 	this->upperBosonicMatsubaraEnergyIndex
 		= upperBosonicMatsubaraEnergyIndex;
+	sparseBosonicMatsubaraEnergyIndices.clear();
+}
+
+void LindhardSusceptibility::setEnergies(const vector<double> &energies){
+	TBTKAssert(
+		energies.size() > 0,
+		"PropertyExtractor::LindhardSusceptibility::setEnergies()",
+		"The 'energies' must contain at least one energy.",
+		""
+	);
+
+	energyType = EnergyType::Real;
+	nonUniformEnergies = energies;
+}
+
+void LindhardSusceptibility::setBosonicMatsubaraEnergyIndices(
+	const vector<int> &bosonicMatsubaraEnergyIndices
+){
+	TBTKAssert(
+		bosonicMatsubaraEnergyIndices.size() > 0,
+		"PropertyExtractor::LindhardSusceptibility::setBosonicMatsubaraEnergyIndices()",
+		"The 'bosonicMatsubaraEnergyIndices' must contain at least one"
+		<< " index.",
+		""
+	);
+	for(unsigned int n = 0; n < bosonicMatsubaraEnergyIndices.size(); n++){
+		TBTKAssert(
+			bosonicMatsubaraEnergyIndices[n]%2 == 0,
+			"PropertyExtractor::LindhardSusceptibility::setBosonicMatsubaraEnergyIndices()",
+			"The Matsubara energy index '"
+			<< bosonicMatsubaraEnergyIndices[n] << "' must be"
+			<< " even.",
+			""
+		);
+	}
+
+	energyType = EnergyType::Matsubara;
+	sparseBosonicMatsubaraEnergyIndices = bosonicMatsubaraEnergyIndices;
 }
 
 Property::Susceptibility LindhardSusceptibility::calculateSusceptibility(
@@ -397,6 +436,27 @@ Property::Susceptibility LindhardSusceptibility::calculateSusceptibility(
 	switch(energyType){
 	case EnergyType::Real:
 	{
+		if(nonUniformEnergies.size() != 0){
+			energies.assign(
+				nonUniformEnergies.begin(),
+				nonUniformEnergies.end()
+			);
+
+			Property::Susceptibility susceptibility(
+				memoryLayout,
+				nonUniformEnergies
+			);
+
+			calculate(
+				calculateSusceptibilityCallback,
+				allIndices,
+				memoryLayout,
+				susceptibility
+			);
+
+			return susceptibility;
+		}
+
 		double lowerBound = getLowerBound();
 		double upperBound = getUpperBound();
 		int energyResolution = getEnergyResolution();
@@ -429,6 +489,42 @@ Property::Susceptibility LindhardSusceptibility::calculateSusceptibility(
 	}
 	case EnergyType::Matsubara:
 	{
+		double temperature = solver->getModel().getTemperature();
+		double kT = UnitHandler::getK_BN()*temperature;
+		double fundamentalMatsubaraEnergy = M_PI*kT;
+
+		if(sparseBosonicMatsubaraEnergyIndices.size() != 0){
+			energies.clear();
+			energies.reserve(
+				sparseBosonicMatsubaraEnergyIndices.size()
+			);
+			for(
+				unsigned int n = 0;
+				n < sparseBosonicMatsubaraEnergyIndices.size();
+				n++
+			){
+				energies.push_back(
+					(double)sparseBosonicMatsubaraEnergyIndices[n]
+					*complex<double>(0, 1)*M_PI*kT
+				);
+			}
+
+			Property::Susceptibility susceptibility(
+				memoryLayout,
+				sparseBosonicMatsubaraEnergyIndices,
+				fundamentalMatsubaraEnergy
+			);
+
+			calculate(
+				calculateSusceptibilityCallback,
+				allIndices,
+				memoryLayout,
+				susceptibility
+			);
+
+			return susceptibility;
+		}
+
 		TBTKAssert(
 			lowerBosonicMatsubaraEnergyIndex
 			<= upperBosonicMatsubaraEnergyIndex,
@@ -444,10 +540,6 @@ Property::Susceptibility LindhardSusceptibility::calculateSusceptibility(
 			- lowerBosonicMatsubaraEnergyIndex
 		)/2 + 1;
 
-		double temperature = solver->getModel().getTemperature();
-		double kT = UnitHandler::getK_BN()*temperature;
-		double fundamentalMatsubaraEnergy = M_PI*kT;
-
 		energies.clear();
 		energies.reserve(numMatsubaraEnergies);
 		for(int n = 0; n < (int)numMatsubaraEnergies; n++){
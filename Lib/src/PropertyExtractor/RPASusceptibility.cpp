@@ -412,12 +412,17 @@ Property::Susceptibility RPASusceptibility::calculateChargeSusceptibility(
 		for(int n = 0; n < energyResolution; n++)
 			energies.push_back(lowerBound + n*dE);*/
 
-		Property::Susceptibility susceptibility(
-			memoryLayout,
-			bareSusceptibility.getLowerBound(),
-			bareSusceptibility.getUpperBound(),
-			bareSusceptibility.getResolution()
-		);
+		Property::Susceptibility susceptibility = bareSusceptibility.isUniform()
+			? Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getLowerBound(),
+				bareSusceptibility.getUpperBound(),
+				bareSusceptibility.getResolution()
+			)
+			: Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getEnergies()
+			);
 
 		chargeSusceptibilityTree.clear();
 		calculate(
@@ -462,12 +467,18 @@ Property::Susceptibility RPASusceptibility::calculateChargeSusceptibility(
 			);
 		}*/
 
-		Property::Susceptibility susceptibility(
-			memoryLayout,
-			bareSusceptibility.getLowerMatsubaraEnergyIndex(),
-			bareSusceptibility.getUpperMatsubaraEnergyIndex(),
-			bareSusceptibility.getFundamentalMatsubaraEnergy()
-		);
+		Property::Susceptibility susceptibility = bareSusceptibility.isUniform()
+			? Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getLowerMatsubaraEnergyIndex(),
+				bareSusceptibility.getUpperMatsubaraEnergyIndex(),
+				bareSusceptibility.getFundamentalMatsubaraEnergy()
+			)
+			: Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getMatsubaraEnergyIndices(),
+				bareSusceptibility.getFundamentalMatsubaraEnergy()
+			);
 
 		chargeSusceptibilityTree.clear();
 		calculate(
@@ -790,12 +801,17 @@ Property::Susceptibility RPASusceptibility::calculateSpinSusceptibility(
 	switch(bareSusceptibility.getEnergyType()){
 	case Property::EnergyResolvedProperty<complex<double>>::EnergyType::Real:
 	{
-		Property::Susceptibility susceptibility(
-			memoryLayout,
-			bareSusceptibility.getLowerBound(),
-			bareSusceptibility.getUpperBound(),
-			bareSusceptibility.getResolution()
-		);
+		Property::Susceptibility susceptibility = bareSusceptibility.isUniform()
+			? Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getLowerBound(),
+				bareSusceptibility.getUpperBound(),
+				bareSusceptibility.getResolution()
+			)
+			: Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getEnergies()
+			);
 
 		spinSusceptibilityTree.clear();
 		calculate(
@@ -809,12 +825,18 @@ Property::Susceptibility RPASusceptibility::calculateSpinSusceptibility(
 	}
 	case Property::EnergyResolvedProperty<complex<double>>::EnergyType::BosonicMatsubara:
 	{
-		Property::Susceptibility susceptibility(
-			memoryLayout,
-			bareSusceptibility.getLowerMatsubaraEnergyIndex(),
-			bareSusceptibility.getUpperMatsubaraEnergyIndex(),
-			bareSusceptibility.getFundamentalMatsubaraEnergy()
-		);
+		Property::Susceptibility susceptibility = bareSusceptibility.isUniform()
+			? Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getLowerMatsubaraEnergyIndex(),
+				bareSusceptibility.getUpperMatsubaraEnergyIndex(),
+				bareSusceptibility.getFundamentalMatsubaraEnergy()
+			)
+			: Property::Susceptibility(
+				memoryLayout,
+				bareSusceptibility.getMatsubaraEnergyIndices(),
+				bareSusceptibility.getFundamentalMatsubaraEnergy()
+			);
 
 		spinSusceptibilityTree.clear();
 		calculate(
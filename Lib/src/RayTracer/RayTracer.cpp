@@ -23,6 +23,11 @@
 #include "TBTK/Smooth.h"
 #include "TBTK/Streams.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 
@@ -117,12 +122,11 @@ void RayTracer::plot(const Model& model, const Property::Density &density){
 		emptyFields,
 		[&density, min, max](const HitDescriptor &hitDescriptor) -> RayTracer::Material
 		{
-			Material material;
-			material.color.r = 255*(density(hitDescriptor.getIndex()) - min)/(max - min);
-			material.color.g = 255*(density(hitDescriptor.getIndex()) - min)/(max - min);
-			material.color.b = 255*(density(hitDescriptor.getIndex()) - min)/(max - min);
-
-			return material;
+			return getDensityMaterial(
+				density(hitDescriptor.getIndex()),
+				min,
+				max
+			);
 		}
 	);
 }
@@ -148,30 +152,10 @@ void RayTracer::plot(
 		emptyFields,
 		[&magnetization](HitDescriptor &hitDescriptor) -> RayTracer::Material
 		{
-			Vector3d directionFromObject = hitDescriptor.getDirectionFromObject();
-			const SpinMatrix& spinMatrix = magnetization(
-				hitDescriptor.getIndex()
-			);
-			Vector3d spinDirection = spinMatrix.getDirection();
-			double projection = Vector3d::dotProduct(
-				directionFromObject,
-				spinDirection
+			return getMagnetizationMaterial(
+				hitDescriptor,
+				magnetization(hitDescriptor.getIndex())
 			);
-//			double density = spinMatrix.getDensity();
-
-			Material material;
-			if(projection > 0){
-				material.color.r = 255;
-				material.color.g = 0;
-				material.color.b = 0;
-			}
-			else{
-				material.color.r = 255;
-				material.color.g = 255;
-				material.color.b = 255;
-			}
-
-			return material;
 		}
 	);
 }
@@ -338,75 +322,195 @@ void RayTracer::interactivePlot(
 	);
 }
 
-void RayTracer::render(
-	const IndexDescriptor &indexDescriptor,
+void RayTracer::renderSequence(
 	const Model &model,
-	const vector<const FieldWrapper*> &fields,
-	function<Material(HitDescriptor &hitDescriptor)> &&lambdaColorPicker,
-	function<void(Mat &canvas, const Index &index)> &&lambdaInteractive
+	const vector<const Property::Density*> &densities,
+	const string &filenamePrefix,
+	const string &filenameSuffix
 ){
-	//Setup viewport.
-	const Vector3d &cameraPosition = renderContext.getCameraPosition();
-	const Vector3d &focus = renderContext.getFocus();
-	const Vector3d &up = renderContext.getUp();
-	unsigned int width = renderContext.getWidth();
-	unsigned int height = renderContext.getHeight();
-	Vector3d unitY = up.unit();
-	Vector3d unitX = ((focus - cameraPosition)*up).unit();
-	unitY = (unitX*(focus - cameraPosition)).unit();
-	double scaleFactor = (focus - cameraPosition).norm()/(double)width;
-
-	//Get geometry.
-	const Geometry *geometry = model.getGeometry();
+	TBTKAssert(
+		densities.size() > 0,
+		"RayTracer::renderSequence()",
+		"The sequence is empty.",
+		""
+	);
+	const IndexDescriptor &indexDescriptor
+		= densities[0]->getIndexDescriptor();
+	double min = densities[0]->getMin();
+	double max = densities[0]->getMax();
+	for(unsigned int n = 0; n < densities.size(); n++){
+		TBTKAssert(
+			densities[n]->getIndexDescriptor().getFormat()
+				== IndexDescriptor::Format::Custom,
+			"RayTracer::renderSequence()",
+			"Only storage format IndexDescriptor::Format::Custom"
+			<< " supported.",
+			"Use calculateProperty(patterns) instead of "
+				<< "calculateProperty(pattern, ranges) when"
+				<< " extracting properties."
+		);
+		TBTKAssert(
+			densities[n]->getIndexDescriptor().getSize()
+				== indexDescriptor.getSize(),
+			"RayTracer::renderSequence()",
+			"Incompatible Densities. Density " << n << " has"
+			<< " size " << densities[n]->getIndexDescriptor().getSize()
+			<< ", but density 0 has size "
+			<< indexDescriptor.getSize() << ".",
+			"All Densities in a sequence must contain the same"
+			<< " Indices."
+		);
+		if(densities[n]->getMin() < min)
+			min = densities[n]->getMin();
+		if(densities[n]->getMax() > max)
+			max = densities[n]->getMax();
+	}
 
-	//Setup IndexTree.
-	const IndexTree &indexTree = indexDescriptor.getIndexTree();
-/*	IndexTree::Iterator iterator = indexTree.begin();
-	vector<Vector3d> coordinates;
-	while(!iterator.getHasReachedEnd()){
-		Index index = iterator.getIndex();
+	renderSequence(
+		indexDescriptor,
+		model,
+		densities.size(),
+		[&densities, min, max](
+			HitDescriptor &hitDescriptor,
+			unsigned int frame
+		) -> RayTracer::Material
+		{
+			return getDensityMaterial(
+				(*densities[frame])(hitDescriptor.getIndex()),
+				min,
+				max
+			);
+		},
+		filenamePrefix,
+		filenameSuffix
+	);
+}
 
-		Index i = index;
-		for(unsigned int n = 0; n < i.getSize(); n++)
-			if(i.at(n) < 0)
-				i.at(n) = IDX_ALL;
+void RayTracer::renderSequence(
+	const Model &model,
+	const vector<const Property::Magnetization*> &magnetizations,
+	const string &filenamePrefix,
+	const string &filenameSuffix
+){
+	TBTKAssert(
+		magnetizations.size() > 0,
+		"RayTracer::renderSequence()",
+		"The sequence is empty.",
+		""
+	);
+	const IndexDescriptor &indexDescriptor
+		= magnetizations[0]->getIndexDescriptor();
+	for(unsigned int n = 0; n < magnetizations.size(); n++){
+		TBTKAssert(
+			magnetizations[n]->getIndexDescriptor().getFormat()
+				== IndexDescriptor::Format::Custom,
+			"RayTracer::renderSequence()",
+			"Only storage format IndexDescriptor::Format::Custom"
+			<< " supported.",
+			"Use calculateProperty(patterns) instead of "
+				<< "calculateProperty(pattern, ranges) when"
+				<< " extracting properties."
+		);
+		TBTKAssert(
+			magnetizations[n]->getIndexDescriptor().getSize()
+				== indexDescriptor.getSize(),
+			"RayTracer::renderSequence()",
+			"Incompatible Magnetizations. Magnetization " << n
+			<< " has size "
+			<< magnetizations[n]->getIndexDescriptor().getSize()
+			<< ", but magnetization 0 has size "
+			<< indexDescriptor.getSize() << ".",
+			"All Magnetizations in a sequence must contain the"
+			<< " same Indices."
+		);
+	}
 
-		vector<Index> indices = model.getHoppingAmplitudeSet().getIndexList(i);
+	renderSequence(
+		indexDescriptor,
+		model,
+		magnetizations.size(),
+		[&magnetizations](
+			HitDescriptor &hitDescriptor,
+			unsigned int frame
+		) -> RayTracer::Material
+		{
+			return getMagnetizationMaterial(
+				hitDescriptor,
+				(*magnetizations[frame])(
+					hitDescriptor.getIndex()
+				)
+			);
+		},
+		filenamePrefix,
+		filenameSuffix
+	);
+}
 
-		coordinates.push_back(Vector3d({0., 0., 0.}));
-		for(unsigned int n = 0; n < indices.size(); n++){
-			const double *c = geometry->getCoordinates(indices.at(n));
-			coordinates.back().x += c[0]/indices.size();
-			coordinates.back().y += c[1]/indices.size();
-			coordinates.back().z += c[2]/indices.size();
-		}
+vector<Vector3d> RayTracer::getCoordinates(
+	const IndexDescriptor &indexDescriptor,
+	const Model &model
+) const{
+	const Geometry *geometry = model.getGeometry();
+	const IndexTree &indexTree = indexDescriptor.getIndexTree();
 
-		iterator.searchNext();
-	}*/
-	vector<Vector3d> coordinates;
+	vector<Index> patterns;
 	for(
 		IndexTree::ConstIterator iterator = indexTree.cbegin();
 		iterator != indexTree.cend();
 		++iterator
 	){
-		Index index = *iterator;
-
-		Index i = index;
+		Index i = *iterator;
 		for(unsigned int n = 0; n < i.getSize(); n++)
 			if(i.at(n) < 0)
 				i.at(n) = IDX_ALL;
 
-		vector<Index> indices = model.getHoppingAmplitudeSet().getIndexList(i);
+		patterns.push_back(i);
+	}
+
+	vector<Vector3d> coordinates(patterns.size());
+	#pragma omp parallel for
+	for(unsigned int c = 0; c < patterns.size(); c++){
+		vector<Index> indices
+			= model.getHoppingAmplitudeSet().getIndexList(
+				patterns[c]
+			);
 
-		coordinates.push_back(Vector3d({0., 0., 0.}));
+		coordinates[c] = Vector3d({0., 0., 0.});
 		for(unsigned int n = 0; n < indices.size(); n++){
-			const double *c = geometry->getCoordinates(indices.at(n));
-			coordinates.back().x += c[0]/indices.size();
-			coordinates.back().y += c[1]/indices.size();
-			coordinates.back().z += c[2]/indices.size();
+			const double *x = geometry->getCoordinates(
+				indices.at(n)
+			);
+			coordinates[c].x += x[0]/indices.size();
+			coordinates[c].y += x[1]/indices.size();
+			coordinates[c].z += x[2]/indices.size();
 		}
 	}
 
+	return coordinates;
+}
+
+void RayTracer::render(
+	const IndexDescriptor &indexDescriptor,
+	const Model &model,
+	const vector<const FieldWrapper*> &fields,
+	function<Material(HitDescriptor &hitDescriptor)> &&lambdaColorPicker,
+	function<void(Mat &canvas, const Index &index)> &&lambdaInteractive
+){
+	//Setup viewport.
+	const Vector3d &cameraPosition = renderContext.getCameraPosition();
+	const Vector3d &focus = renderContext.getFocus();
+	const Vector3d &up = renderContext.getUp();
+	unsigned int width = renderContext.getWidth();
+	unsigned int height = renderContext.getHeight();
+	Vector3d unitY = up.unit();
+	Vector3d unitX = ((focus - cameraPosition)*up).unit();
+	unitY = (unitX*(focus - cameraPosition)).unit();
+	double scaleFactor = (focus - cameraPosition).norm()/(double)width;
+
+	//Setup IndexTree and coordinates.
+	const IndexTree &indexTree = indexDescriptor.getIndexTree();
+	vector<Vector3d> coordinates = getCoordinates(indexDescriptor, model);
+
 	//Setup canvas and HitDescriptors.
 	if(renderResult != nullptr)
 		delete renderResult;
@@ -414,28 +518,46 @@ void RayTracer::render(
 	Mat canvas = renderResult->getCanvas();
 	vector<HitDescriptor> **hitDescriptors = renderResult->getHitDescriptors();
 
-	//Render.
-	for(unsigned int x = 0; x < width; x++){
-		for(unsigned int y = 0; y < height; y++){
-			Vector3d target = focus
-				+ (scaleFactor*((double)x - width/2.))*unitX
-				+ (scaleFactor*((double)y - height/2.))*unitY;
-			Vector3d rayDirection = (target - cameraPosition).unit();
-
-			Color color = trace(
-				coordinates,
-				cameraPosition,
-				rayDirection,
-				indexTree,
-				fields,
-				hitDescriptors[x][y],
-				lambdaColorPicker,
-				renderContext.getNumDeflections()
-			);
+	BoundingVolumeHierarchy boundingVolumeHierarchy(
+		coordinates,
+		renderContext.getStateRadius()
+	);
 
-			canvas.at<Vec3f>(height - 1 - y, x)[0] = color.b;
-			canvas.at<Vec3f>(height - 1 - y, x)[1] = color.g;
-			canvas.at<Vec3f>(height - 1 - y, x)[2] = color.r;
+	//Render. The image is divided into tiles that are distributed over
+	//the threads. Every pixel is written by a single thread, but the
+	//color picker and the fields are called concurrently.
+	const unsigned int TILE_SIZE = 16;
+	int numTilesX = (width + TILE_SIZE - 1)/TILE_SIZE;
+	int numTilesY = (height + TILE_SIZE - 1)/TILE_SIZE;
+	#pragma omp parallel for schedule(dynamic)
+	for(int tile = 0; tile < numTilesX*numTilesY; tile++){
+		unsigned int xStart = (tile%numTilesX)*TILE_SIZE;
+		unsigned int yStart = (tile/numTilesX)*TILE_SIZE;
+		unsigned int xEnd = min(xStart + TILE_SIZE, width);
+		unsigned int yEnd = min(yStart + TILE_SIZE, height);
+		for(unsigned int x = xStart; x < xEnd; x++){
+			for(unsigned int y = yStart; y < yEnd; y++){
+				Vector3d target = focus
+					+ (scaleFactor*((double)x - width/2.))*unitX
+					+ (scaleFactor*((double)y - height/2.))*unitY;
+				Vector3d rayDirection
+					= (target - cameraPosition).unit();
+
+				Color color = trace(
+					boundingVolumeHierarchy,
+					cameraPosition,
+					rayDirection,
+					indexTree,
+					fields,
+					hitDescriptors[x][y],
+					lambdaColorPicker,
+					renderContext.getNumDeflections()
+				);
+
+				canvas.at<Vec3f>(height - 1 - y, x)[0] = color.b;
+				canvas.at<Vec3f>(height - 1 - y, x)[1] = color.g;
+				canvas.at<Vec3f>(height - 1 - y, x)[2] = color.r;
+			}
 		}
 	}
 
@@ -493,44 +615,26 @@ void RayTracer::render(
 }
 
 RayTracer::Color RayTracer::trace(
-	const vector<Vector3d> &coordinates,
+	const BoundingVolumeHierarchy &boundingVolumeHierarchy,
 	const Vector3d &raySource,
 	const Vector3d &rayDirection,
 	const IndexTree &indexTree,
 	const vector<const FieldWrapper*> &fields,
 	vector<HitDescriptor> &hitDescriptors,
-	function<Material(HitDescriptor &hitDescriptor)> lambdaColorPicker,
+	const function<Material(HitDescriptor &hitDescriptor)> &lambdaColorPicker,
 	unsigned int numDeflections
 ){
-	//Parameters.
-	double stateRadius = renderContext.getStateRadius();
-
-	//Trace ray and determine hit objects.
-	vector<unsigned int> hits;
-	for(unsigned int n = 0; n < coordinates.size(); n++){
-		if(
-			((coordinates.at(n) - raySource)*rayDirection).norm() < stateRadius
-			&& Vector3d::dotProduct(coordinates.at(n) - raySource, rayDirection) > 0
-		){
-			hits.push_back(n);
-		}
-	}
+	//Trace ray and determine the closest hit object.
+	int minDistanceIndex = boundingVolumeHierarchy.getClosestHit(
+		raySource,
+		rayDirection
+	);
 
 	Color color;
 	color.r = 0;
 	color.g = 0;
 	color.b = 0;
-	if(hits.size() > 0){
-		double minDistance = (coordinates.at(hits.at(0)) - raySource).norm();
-		unsigned int minDistanceIndex = hits.at(0);
-		for(unsigned int n = 1; n < hits.size(); n++){
-			double distance = (coordinates.at(hits.at(n)) - raySource).norm();
-			if(distance < minDistance){
-				minDistance = distance;
-				minDistanceIndex = hits.at(n);
-			}
-		}
-
+	if(minDistanceIndex != -1){
 		HitDescriptor hitDescriptor(renderContext);
 		hitDescriptor.setRaySource(raySource);
 		hitDescriptor.setRayDirection(
@@ -542,7 +646,7 @@ RayTracer::Color RayTracer::trace(
 			)
 		);
 		hitDescriptor.setCoordinate(
-			coordinates.at(
+			boundingVolumeHierarchy.getCoordinate(
 				minDistanceIndex
 			)
 		);
@@ -580,7 +684,7 @@ RayTracer::Color RayTracer::trace(
 				hitDescriptor.getDirectionFromObject(), rayDirection
 			)).unit();
 			Color specularColor = trace(
-				coordinates,
+				boundingVolumeHierarchy,
 				impactPosition,
 				newDirection,
 				indexTree,
@@ -609,6 +713,202 @@ RayTracer::Color RayTracer::trace(
 	return color;
 }
 
+void RayTracer::renderSequence(
+	const IndexDescriptor &indexDescriptor,
+	const Model &model,
+	unsigned int numFrames,
+	function<Material(HitDescriptor &hitDescriptor, unsigned int frame)> &&lambdaColorPicker,
+	const string &filenamePrefix,
+	const string &filenameSuffix
+){
+	//Setup viewport.
+	const Vector3d &cameraPosition = renderContext.getCameraPosition();
+	const Vector3d &focus = renderContext.getFocus();
+	const Vector3d &up = renderContext.getUp();
+	unsigned int width = renderContext.getWidth();
+	unsigned int height = renderContext.getHeight();
+	unsigned int numDeflections = renderContext.getNumDeflections();
+	Vector3d unitY = up.unit();
+	Vector3d unitX = ((focus - cameraPosition)*up).unit();
+	unitY = (unitX*(focus - cameraPosition)).unit();
+	double scaleFactor = (focus - cameraPosition).norm()/(double)width;
+
+	//Setup the scene.
+	const IndexTree &indexTree = indexDescriptor.getIndexTree();
+	BoundingVolumeHierarchy boundingVolumeHierarchy(
+		getCoordinates(indexDescriptor, model),
+		renderContext.getStateRadius()
+	);
+
+	//Trace the rays once for all frames.
+	vector<vector<HitDescriptor>> hits(width*height);
+	#pragma omp parallel for schedule(dynamic)
+	for(unsigned int x = 0; x < width; x++){
+		for(unsigned int y = 0; y < height; y++){
+			Vector3d target = focus
+				+ (scaleFactor*((double)x - width/2.))*unitX
+				+ (scaleFactor*((double)y - height/2.))*unitY;
+			Vector3d rayDirection = (target - cameraPosition).unit();
+
+			traceHits(
+				boundingVolumeHierarchy,
+				cameraPosition,
+				rayDirection,
+				indexTree,
+				hits[width*y + x],
+				numDeflections
+			);
+		}
+	}
+
+	//Shade and save the frames.
+	unsigned int numDigits = 1;
+	for(unsigned int n = 10; n <= numFrames - 1; n *= 10)
+		numDigits++;
+	#pragma omp parallel for schedule(dynamic)
+	for(unsigned int frame = 0; frame < numFrames; frame++){
+		function<Material(HitDescriptor &hitDescriptor)> frameColorPicker
+			= [&lambdaColorPicker, frame](
+				HitDescriptor &hitDescriptor
+			){
+				return lambdaColorPicker(hitDescriptor, frame);
+			};
+
+		Mat canvas = Mat::zeros(height, width, CV_32FC3);
+		for(unsigned int x = 0; x < width; x++){
+			for(unsigned int y = 0; y < height; y++){
+				Color color = shadeHits(
+					hits[width*y + x],
+					frameColorPicker,
+					numDeflections
+				);
+
+				canvas.at<Vec3f>(height - 1 - y, x)[0] = color.b;
+				canvas.at<Vec3f>(height - 1 - y, x)[1] = color.g;
+				canvas.at<Vec3f>(height - 1 - y, x)[2] = color.r;
+			}
+		}
+
+		stringstream ss;
+		ss << filenamePrefix << setfill('0') << setw(numDigits)
+			<< frame << filenameSuffix;
+		imwrite(ss.str(), getCharImage(canvas));
+	}
+}
+
+void RayTracer::traceHits(
+	const BoundingVolumeHierarchy &boundingVolumeHierarchy,
+	const Vector3d &raySource,
+	const Vector3d &rayDirection,
+	const IndexTree &indexTree,
+	vector<HitDescriptor> &hits,
+	unsigned int numDeflections
+) const{
+	Vector3d source = raySource;
+	Vector3d direction = rayDirection;
+	for(unsigned int n = 0; n <= numDeflections; n++){
+		int site = boundingVolumeHierarchy.getClosestHit(
+			source,
+			direction
+		);
+		if(site == -1)
+			break;
+
+		HitDescriptor hitDescriptor(renderContext);
+		hitDescriptor.setRaySource(source);
+		hitDescriptor.setRayDirection(direction);
+		hitDescriptor.setIndex(indexTree.getPhysicalIndex(site));
+		hitDescriptor.setCoordinate(
+			boundingVolumeHierarchy.getCoordinate(site)
+		);
+		const Vector3d &directionFromObject
+			= hitDescriptor.getDirectionFromObject();
+		const Vector3d &impactPosition
+			= hitDescriptor.getImpactPosition();
+
+		direction = (direction - 2*directionFromObject*Vector3d::dotProduct(
+			directionFromObject, direction
+		)).unit();
+		source = impactPosition;
+
+		hits.push_back(std::move(hitDescriptor));
+	}
+}
+
+RayTracer::Color RayTracer::shadeHits(
+	vector<HitDescriptor> &hits,
+	const function<Material(HitDescriptor &hitDescriptor)> &lambdaColorPicker,
+	unsigned int numDeflections
+) const{
+	//The color of each hit depends on the color of the next deflection,
+	//so the hits are shaded in reverse order.
+	Color color;
+	color.r = 0;
+	color.g = 0;
+	color.b = 0;
+	for(int n = hits.size() - 1; n >= 0; n--){
+		Material material = lambdaColorPicker(hits[n]);
+
+		double lightProjection = Vector3d::dotProduct(
+			hits[n].getDirectionFromObject().unit(),
+			Vector3d({0, 0, 1})
+		);
+		Color hitColor;
+		hitColor.r = material.color.r*(material.ambient + material.diffusive*lightProjection)/(material.ambient + material.diffusive);
+		hitColor.g = material.color.g*(material.ambient + material.diffusive*lightProjection)/(material.ambient + material.diffusive);
+		hitColor.b = material.color.b*(material.ambient + material.diffusive*lightProjection)/(material.ambient + material.diffusive);
+
+		if((unsigned int)n < numDeflections){
+			hitColor.r = hitColor.r*(1 - material.specular) + material.specular*color.r;
+			hitColor.g = hitColor.g*(1 - material.specular) + material.specular*color.g;
+			hitColor.b = hitColor.b*(1 - material.specular) + material.specular*color.b;
+		}
+
+		color = hitColor;
+	}
+
+	return color;
+}
+
+RayTracer::Material RayTracer::getDensityMaterial(
+	double density,
+	double min,
+	double max
+){
+	Material material;
+	material.color.r = 255*(density - min)/(max - min);
+	material.color.g = 255*(density - min)/(max - min);
+	material.color.b = 255*(density - min)/(max - min);
+
+	return material;
+}
+
+RayTracer::Material RayTracer::getMagnetizationMaterial(
+	HitDescriptor &hitDescriptor,
+	const SpinMatrix &spinMatrix
+){
+	Vector3d directionFromObject = hitDescriptor.getDirectionFromObject();
+	Vector3d spinDirection = spinMatrix.getDirection();
+	double projection = Vector3d::dotProduct(
+		directionFromObject,
+		spinDirection
+	);
+
+	Material material;
+	if(projection > 0){
+		material.color.r = 255;
+		material.color.g = 0;
+		material.color.b = 0;
+	}
+	else{
+		material.color.r = 255;
+		material.color.g = 255;
+		material.color.b = 255;
+	}
+
+	return material;
+}
+
 RayTracer::Color RayTracer::traceFields(
 	const vector<const FieldWrapper*> &fields,
 	const Vector3d &raySource,
@@ -672,7 +972,10 @@ Mat RayTracer::getCharImage() const{
 		"First render an image."
 	);
 
-	Mat &canvas = renderResult->getCanvas();
+	return getCharImage(renderResult->getCanvas());
+}
+
+Mat RayTracer::getCharImage(const Mat &canvas){
 
 	double minValue = canvas.at<Vec3f>(0, 0)[0];
 	double maxValue = canvas.at<Vec3f>(0, 0)[0];
@@ -734,6 +1037,7 @@ RayTracer::HitDescriptor::HitDescriptor(
 	const HitDescriptor &hitDescriptor
 ) :
 	renderContext(hitDescriptor.renderContext),
+	raySource(hitDescriptor.raySource),
 	rayDirection(hitDescriptor.rayDirection),
 	index(hitDescriptor.index),
 	coordinate(hitDescriptor.coordinate)
@@ -761,6 +1065,7 @@ RayTracer::HitDescriptor::HitDescriptor(
 	HitDescriptor &&hitDescriptor
 ) :
 	renderContext(std::move(hitDescriptor.renderContext)),
+	raySource(std::move(hitDescriptor.raySource)),
 	rayDirection(std::move(hitDescriptor.rayDirection)),
 	index(std::move(hitDescriptor.index)),
 	coordinate(std::move(hitDescriptor.coordinate))
@@ -794,6 +1099,7 @@ RayTracer::HitDescriptor& RayTracer::HitDescriptor::operator=(
 ){
 	if(this != &rhs){
 		renderContext = rhs.renderContext;
+		raySource = rhs.raySource;
 		rayDirection = rhs.rayDirection;
 		index = rhs.index;
 		coordinate = rhs.coordinate;
@@ -817,6 +1123,7 @@ RayTracer::HitDescriptor& RayTracer::HitDescriptor::operator=(
 ){
 	if(this != &rhs){
 		renderContext = rhs.renderContext;
+		raySource = rhs.raySource;
 		rayDirection = rhs.rayDirection;
 		index = rhs.index;
 		coordinate = rhs.coordinate;
@@ -872,6 +1179,191 @@ const Vector3d& RayTracer::HitDescriptor::getDirectionFromObject(){
 	return *directionFromObject;
 }
 
+RayTracer::BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+	const vector<Vector3d> &coordinates,
+	double radius
+) :
+	coordinates(coordinates),
+	radius(radius)
+{
+	for(unsigned int n = 0; n < coordinates.size(); n++)
+		sites.push_back(n);
+
+	if(coordinates.size() != 0)
+		build(0, coordinates.size());
+}
+
+int RayTracer::BoundingVolumeHierarchy::getClosestHit(
+	const Vector3d &raySource,
+	const Vector3d &rayDirection
+) const{
+	if(nodes.size() == 0)
+		return -1;
+
+	double source[3] = {raySource.x, raySource.y, raySource.z};
+	double direction[3] = {rayDirection.x, rayDirection.y, rayDirection.z};
+
+	int closestHit = -1;
+	double minDistance = numeric_limits<double>::infinity();
+
+	//The hierarchy is balanced, so the depth is bounded by the number of
+	//bits in an unsigned int.
+	unsigned int stack[2*sizeof(unsigned int)*8];
+	unsigned int stackSize = 0;
+	stack[stackSize++] = 0;
+	while(stackSize != 0){
+		const Node &node = nodes[stack[--stackSize]];
+		if(!intersects(node, source, direction, minDistance))
+			continue;
+
+		if(node.secondChild == 0){
+			for(unsigned int n = node.first; n < node.end; n++){
+				const Vector3d &coordinate = coordinates[sites[n]];
+				if(
+					((coordinate - raySource)*rayDirection).norm() < radius
+					&& Vector3d::dotProduct(coordinate - raySource, rayDirection) > 0
+				){
+					double distance = (coordinate - raySource).norm();
+					if(
+						distance < minDistance
+						|| (
+							distance == minDistance
+							&& (int)sites[n] < closestHit
+						)
+					){
+						minDistance = distance;
+						closestHit = sites[n];
+					}
+				}
+			}
+		}
+		else{
+			//Push the child that is furthest away along the ray
+			//first, such that the closest child is visited first.
+			unsigned int firstChild = &node - &nodes[0] + 1;
+			if(direction[node.axis] >= 0){
+				stack[stackSize++] = node.secondChild;
+				stack[stackSize++] = firstChild;
+			}
+			else{
+				stack[stackSize++] = firstChild;
+				stack[stackSize++] = node.secondChild;
+			}
+		}
+	}
+
+	return closestHit;
+}
+
+unsigned int RayTracer::BoundingVolumeHierarchy::build(
+	unsigned int first,
+	unsigned int end
+){
+	Node node;
+	node.first = first;
+	node.end = end;
+	node.secondChild = 0;
+	node.axis = 0;
+	for(unsigned int c = 0; c < 3; c++){
+		node.lower[c] = numeric_limits<double>::infinity();
+		node.upper[c] = -numeric_limits<double>::infinity();
+	}
+	for(unsigned int n = first; n < end; n++){
+		const Vector3d &coordinate = coordinates[sites[n]];
+		double c[3] = {coordinate.x, coordinate.y, coordinate.z};
+		for(unsigned int i = 0; i < 3; i++){
+			node.lower[i] = min(node.lower[i], c[i]);
+			node.upper[i] = max(node.upper[i], c[i]);
+		}
+	}
+
+	unsigned int position = nodes.size();
+	nodes.push_back(node);
+	if(end - first <= MAX_LEAF_SIZE)
+		return position;
+
+	unsigned int axis = 0;
+	for(unsigned int c = 1; c < 3; c++)
+		if(node.upper[c] - node.lower[c] > node.upper[axis] - node.lower[axis])
+			axis = c;
+
+	unsigned int middle = (first + end)/2;
+	const vector<Vector3d> &coordinates = this->coordinates;
+	nth_element(
+		sites.begin() + first,
+		sites.begin() + middle,
+		sites.begin() + end,
+		[&coordinates, axis](unsigned int lhs, unsigned int rhs){
+			switch(axis){
+			case 0:
+				return coordinates[lhs].x < coordinates[rhs].x;
+			case 1:
+				return coordinates[lhs].y < coordinates[rhs].y;
+			default:
+				return coordinates[lhs].z < coordinates[rhs].z;
+			}
+		}
+	);
+
+	build(first, middle);
+	unsigned int secondChild = build(middle, end);
+
+	//The reference to the node may have been invalidated by the
+	//recursive calls.
+	nodes[position].axis = axis;
+	nodes[position].secondChild = secondChild;
+
+	return position;
+}
+
+bool RayTracer::BoundingVolumeHierarchy::intersects(
+	const Node &node,
+	const double *raySource,
+	const double *rayDirection,
+	double maxDistance
+) const{
+	//Every site in the node is further away than maxDistance if the
+	//bounding box is.
+	double squaredDistance = 0;
+	for(unsigned int c = 0; c < 3; c++){
+		if(raySource[c] < node.lower[c]){
+			double d = node.lower[c] - raySource[c];
+			squaredDistance += d*d;
+		}
+		else if(raySource[c] > node.upper[c]){
+			double d = raySource[c] - node.upper[c];
+			squaredDistance += d*d;
+		}
+	}
+	if(squaredDistance > maxDistance*maxDistance)
+		return false;
+
+	//Slab test against the bounding box extended by the radius of the
+	//spheres, for the half line in front of the ray source.
+	double tMin = 0;
+	double tMax = numeric_limits<double>::infinity();
+	for(unsigned int c = 0; c < 3; c++){
+		double lower = node.lower[c] - radius;
+		double upper = node.upper[c] + radius;
+		if(rayDirection[c] == 0){
+			if(raySource[c] < lower || raySource[c] > upper)
+				return false;
+		}
+		else{
+			double t0 = (lower - raySource[c])/rayDirection[c];
+			double t1 = (upper - raySource[c])/rayDirection[c];
+			if(t0 > t1)
+				swap(t0, t1);
+			tMin = max(tMin, t0);
+			tMax = min(tMax, t1);
+			if(tMin > tMax)
+				return false;
+		}
+	}
+
+	return true;
+}
+
 RayTracer::RenderResult::RenderResult(unsigned int width, unsigned int height){
 	this->width = width;
 	this->height = height;
@@ -29,6 +29,7 @@
 #include "TBTK/Streams.h"
 #include "TBTK/TBTKMacros.h"
 
+#include <algorithm>
 #include <iostream>
 
 using namespace std;
@@ -42,6 +43,7 @@ ArnoldiIterator::ArnoldiIterator() : Communicator(true){
 	//Arnoldi variables (ARPACK)
 	calculateEigenVectors = false;
 	numEigenValues = 0;
+	numCalculatedEigenValues = 0;
 	numLanczosVectors = 0;
 	shift = 0.;
 	tolerance = 0.;
@@ -182,6 +184,250 @@ void ArnoldiIterator::run(){
 		);
 	}
 	sort();
+	numCalculatedEigenValues = numEigenValues;
+}
+
+void ArnoldiIterator::runSpectrumSlicing(
+	double lowerBound,
+	double upperBound,
+	int numSlices
+){
+	TBTKAssert(
+		lowerBound < upperBound,
+		"ArnoldiIterator::runSpectrumSlicing()",
+		"The lower bound '" << lowerBound << "' must be smaller than"
+		<< " the upper bound '" << upperBound << "'.",
+		""
+	);
+	TBTKAssert(
+		numSlices > 0,
+		"ArnoldiIterator::runSpectrumSlicing()",
+		"The number of slices must be larger than 0.",
+		""
+	);
+
+	if(getGlobalVerbose() && getVerbose()){
+		Streams::out << "Running ArnoldiIterator with spectrum slicing"
+			<< " (" << numSlices << " slices).\n";
+	}
+
+	Model &model = getModel();
+	int basisSize = model.getBasisSize();
+	double sliceWidth = (upperBound - lowerBound)/numSlices;
+
+	//Eigenvectors are needed to tell an eigenpair that is found by two
+	//neighboring slices apart from a degenerate eigenpair. Without them
+	//the slices are treated as strictly non-overlapping.
+	double margin = 0;
+	if(calculateEigenVectors)
+		margin = 1e-8*(upperBound - lowerBound);
+
+	vector<vector<complex<double>>> sliceEigenValues(numSlices);
+	vector<vector<complex<double>>> sliceEigenVectors(numSlices);
+	vector<char> sliceIsComplete(numSlices, true);
+
+	#pragma omp parallel
+	{
+		//Each thread uses a single worker for all of its slices, which
+		//allows the LUSolver to reuse the column permutation.
+		ArnoldiIterator worker;
+		worker.setVerbose(false);
+		worker.setModel(model);
+		worker.setMode(Mode::ShiftAndInvert);
+		worker.setNumEigenValues(numEigenValues);
+		worker.setCalculateEigenVectors(calculateEigenVectors);
+		worker.setNumLanczosVectors(numLanczosVectors);
+		worker.setTolerance(tolerance);
+		worker.setMaxIterations(maxIterations);
+
+		#pragma omp for schedule(dynamic)
+		for(int slice = 0; slice < numSlices; slice++){
+			double sliceLowerBound = lowerBound + slice*sliceWidth;
+			double sliceUpperBound = lowerBound + (slice+1)*sliceWidth;
+			worker.setCentralValue(
+				(sliceLowerBound + sliceUpperBound)/2.
+			);
+
+			worker.initShiftAndInvert();
+
+			//ARPACK keeps internal state between the calls in the
+			//reverse communication loop and can therefore only
+			//run one Arnoldi loop at the time.
+			#pragma omp critical (TBTK_ARNOLDI_ITERATOR)
+			worker.arnoldiLoop();
+
+			double maxDistance = 0;
+			for(int n = 0; n < numEigenValues; n++){
+				double eigenValue = real(worker.eigenValues[n]);
+				maxDistance = max(
+					maxDistance,
+					abs(eigenValue - worker.shift)
+				);
+
+				if(
+					eigenValue < lowerBound
+					|| eigenValue > upperBound
+					|| eigenValue < sliceLowerBound - margin
+					|| (
+						slice != numSlices - 1
+						&& eigenValue
+							>= sliceUpperBound + margin
+					)
+				){
+					continue;
+				}
+
+				sliceEigenValues[slice].push_back(
+					worker.eigenValues[n]
+				);
+				if(calculateEigenVectors){
+					sliceEigenVectors[slice].insert(
+						sliceEigenVectors[slice].end(),
+						worker.eigenVectors + n*basisSize,
+						worker.eigenVectors
+							+ (n+1)*basisSize
+					);
+				}
+			}
+
+			if(
+				numEigenValues < basisSize
+				&& maxDistance < sliceWidth/2.
+			){
+				sliceIsComplete[slice] = false;
+			}
+		}
+	}
+
+	for(int slice = 0; slice < numSlices; slice++){
+		if(!sliceIsComplete[slice]){
+			Streams::out << "Warning in"
+				<< " ArnoldiIterator::runSpectrumSlicing():"
+				<< " The eigenvalues calculated for the slice ["
+				<< lowerBound + slice*sliceWidth << ", "
+				<< lowerBound + (slice+1)*sliceWidth << "] do"
+				<< " not reach the boundaries of the slice."
+				<< " Some eigenvalues may be missing. Increase"
+				<< " the number of eigenvalues or the number of"
+				<< " slices.\n";
+		}
+	}
+
+	mergeSlices(sliceEigenValues, sliceEigenVectors, margin);
+
+	if(getGlobalVerbose() && getVerbose()){
+		Streams::out << "Number of eigenvalues in the interval: "
+			<< numCalculatedEigenValues << "\n";
+	}
+}
+
+void ArnoldiIterator::mergeSlices(
+	const vector<vector<complex<double>>> &sliceEigenValues,
+	const vector<vector<complex<double>>> &sliceEigenVectors,
+	double margin
+){
+	int basisSize = getModel().getBasisSize();
+
+	//Candidates on the form (eigenvalue, (slice, state)).
+	vector<pair<double, pair<unsigned int, unsigned int>>> candidates;
+	for(unsigned int slice = 0; slice < sliceEigenValues.size(); slice++){
+		for(
+			unsigned int state = 0;
+			state < sliceEigenValues[slice].size();
+			state++
+		){
+			candidates.push_back(
+				make_pair(
+					real(sliceEigenValues[slice][state]),
+					make_pair(slice, state)
+				)
+			);
+		}
+	}
+	std::sort(candidates.begin(), candidates.end());
+
+	vector<pair<unsigned int, unsigned int>> accepted;
+	for(unsigned int n = 0; n < candidates.size(); n++){
+		unsigned int slice = candidates[n].second.first;
+		unsigned int state = candidates[n].second.second;
+
+		//Project the candidate onto the accepted eigenvectors from
+		//other slices with (almost) the same eigenvalue. A candidate
+		//that mainly lies in their span has already been found. The
+		//slices do not overlap if eigenvectors are not calculated.
+		double projection = 0;
+		for(
+			int c = (int)accepted.size() - 1;
+			c >= 0 && calculateEigenVectors;
+			c--
+		){
+			unsigned int acceptedSlice = accepted[c].first;
+			unsigned int acceptedState = accepted[c].second;
+			if(
+				candidates[n].first
+				- real(
+					sliceEigenValues[acceptedSlice][
+						acceptedState
+					]
+				) > margin
+			){
+				break;
+			}
+			if(acceptedSlice == slice)
+				continue;
+
+			const complex<double> *u
+				= &sliceEigenVectors[slice][state*basisSize];
+			const complex<double> *v = &sliceEigenVectors[
+				acceptedSlice
+			][acceptedState*basisSize];
+			complex<double> overlap = 0;
+			double uNorm = 0;
+			double vNorm = 0;
+			for(int i = 0; i < basisSize; i++){
+				overlap += conj(v[i])*u[i];
+				uNorm += norm(u[i]);
+				vNorm += norm(v[i]);
+			}
+			projection += norm(overlap)/(uNorm*vNorm);
+		}
+
+		if(projection < 0.5)
+			accepted.push_back(make_pair(slice, state));
+	}
+
+	numCalculatedEigenValues = accepted.size();
+
+	if(residuals != nullptr){
+		delete [] residuals;
+		residuals = nullptr;
+	}
+	if(eigenValues != nullptr)
+		delete [] eigenValues;
+	eigenValues = new complex<double>[numCalculatedEigenValues];
+	if(eigenVectors != nullptr){
+		delete [] eigenVectors;
+		eigenVectors = nullptr;
+	}
+	if(calculateEigenVectors){
+		eigenVectors = new complex<double>[
+			numCalculatedEigenValues*basisSize
+		];
+	}
+
+	for(unsigned int n = 0; n < accepted.size(); n++){
+		unsigned int slice = accepted[n].first;
+		unsigned int state = accepted[n].second;
+		eigenValues[n] = sliceEigenValues[slice][state];
+		if(calculateEigenVectors){
+			for(int c = 0; c < basisSize; c++){
+				eigenVectors[n*basisSize + c]
+					= sliceEigenVectors[slice][
+						state*basisSize + c
+					];
+			}
+		}
+	}
 }
 
 void ArnoldiIterator::arnoldiLoop(){
@@ -276,9 +522,6 @@ void ArnoldiIterator::arnoldiLoop(){
 			eigenVectors = new complex<double>[numEigenValues*model.getBasisSize()];
 		double *workev = new double[3*numLanczosVectors];
 
-		//Only used in Mode::ShiftAndInvert.
-		Matrix<double> b(basisSize, 1);
-
 		//Main loop ()
 		int counter = 0;
 		while(true){
@@ -323,8 +566,7 @@ void ArnoldiIterator::arnoldiLoop(){
 					ido,
 					basisSize,
 					workd,
-					ipntr,
-					b
+					ipntr
 				)
 			){
 				break;
@@ -448,9 +690,6 @@ void ArnoldiIterator::arnoldiLoop(){
 			eigenVectors = new complex<double>[numEigenValues*model.getBasisSize()];
 		complex<double> *workev = new complex<double>[2*numLanczosVectors];
 
-		//Only used in Mode::ShiftAndInvert.
-		Matrix<complex<double>> b(basisSize, 1);
-
 		//Main loop ()
 		int counter = 0;
 		while(true){
@@ -496,8 +735,7 @@ void ArnoldiIterator::arnoldiLoop(){
 					ido,
 					basisSize,
 					workd,
-					ipntr,
-					b
+					ipntr
 				)
 			){
 				break;
@@ -620,8 +858,7 @@ bool ArnoldiIterator::executeReverseCommunicationMessage(
 	int ido,
 	int basisSize,
 	double *workd,
-	int *ipntr,
-	Matrix<double> &b
+	int *ipntr
 ){
 	if(ido == -1 || ido == 1){
 		switch(mode){
@@ -637,14 +874,12 @@ bool ArnoldiIterator::executeReverseCommunicationMessage(
 			//Solve x = (A - sigma*I)^{-1}b, where b =
 			//workd[ipntr[0]] and x = workd[ipntr[1]]. "-1"
 			//is for conversion between Fortran one based
-			//indices and c++ zero based indices.
+			//indices and c++ zero based indices. The solution is
+			//calculated in place in workd[ipntr[1]].
 			for(int n = 0; n < basisSize; n++)
-				b.at(n, 0) = workd[(ipntr[0] - 1) + n];
+				workd[(ipntr[1] - 1) + n] = workd[(ipntr[0] - 1) + n];
 
-			luSolver.solve(b);
-
-			for(int n = 0; n < basisSize; n++)
-				workd[(ipntr[1] - 1) + n] = b.at(n, 0);
+			luSolver.solve(workd + (ipntr[1] - 1));
 
 			break;
 		default:
@@ -676,8 +911,7 @@ bool ArnoldiIterator::executeReverseCommunicationMessage(
 	int ido,
 	int basisSize,
 	complex<double> *workd,
-	int *ipntr,
-	Matrix<complex<double>> &b
+	int *ipntr
 ){
 	if(ido == -1 || ido == 1){
 		switch(mode){
@@ -708,14 +942,12 @@ bool ArnoldiIterator::executeReverseCommunicationMessage(
 			//Solve x = (A - sigma*I)^{-1}b, where b =
 			//workd[ipntr[0]] and x = workd[ipntr[1]]. "-1"
 			//is for conversion between Fortran one based
-			//indices and c++ zero based indices.
+			//indices and c++ zero based indices. The solution is
+			//calculated in place in workd[ipntr[1]].
 			for(int n = 0; n < basisSize; n++)
-				b.at(n, 0) = workd[(ipntr[0] - 1) + n];
+				workd[(ipntr[1] - 1) + n] = workd[(ipntr[0] - 1) + n];
 
-			luSolver.solve(b);
-
-			for(int n = 0; n < basisSize; n++)
-				workd[(ipntr[1] - 1) + n] = b.at(n, 0);
+			luSolver.solve(workd + (ipntr[1] - 1));
 
 			break;
 		default:
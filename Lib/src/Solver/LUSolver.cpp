@@ -23,6 +23,8 @@
 #include "slu_ddefs.h"
 #include "slu_zdefs.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace TBTK{
@@ -32,8 +34,11 @@ LUSolver::LUSolver() : Communicator(true){
 	U = nullptr;
 	rowPermutations = nullptr;
 	columnPermutations = nullptr;
+	eliminationTree = nullptr;
 	statistics = nullptr;
 	matrixDataType = DataType::None;
+	reuseSymbolicFactorization = true;
+	patternNumRows = 0;
 }
 
 LUSolver::~LUSolver(){
@@ -45,6 +50,8 @@ LUSolver::~LUSolver(){
 		delete [] rowPermutations;
 	if(columnPermutations != nullptr)
 		delete [] columnPermutations;
+	if(eliminationTree != nullptr)
+		delete [] eliminationTree;
 	if(statistics != nullptr)
 		StatFree(statistics);
 }
@@ -73,6 +80,14 @@ void LUSolver::setMatrix(const SparseMatrix<double> &sparseMatrix){
 		""
 	);
 
+	bool samePattern = updateSparsityPattern(
+		numRows,
+		numColumns,
+		numMatrixElements,
+		cscColumnPointers,
+		cscRows
+	);
+
 	//Prepare Input for SuperLU matrix constructor.
 	int *sluColumnPointers = new int[numColumns+1];
 	for(unsigned int n = 0; n < numColumns+1; n++)
@@ -100,9 +115,10 @@ void LUSolver::setMatrix(const SparseMatrix<double> &sparseMatrix){
 		SLU_GE
 	);
 
-	allocatePermutationMatrices(numRows, numColumns);
+	if(!samePattern)
+		allocatePermutationMatrices(numRows, numColumns);
 	initStatistics();
-	performLUFactorization(sluMatrix);
+	performLUFactorization(sluMatrix, samePattern);
 
 	//Clean up
 	Destroy_CompCol_Matrix(&sluMatrix);
@@ -132,6 +148,14 @@ void LUSolver::setMatrix(const SparseMatrix<complex<double>> &sparseMatrix){
 		""
 	);
 
+	bool samePattern = updateSparsityPattern(
+		numRows,
+		numColumns,
+		numMatrixElements,
+		cscColumnPointers,
+		cscRows
+	);
+
 	//Prepare Input for SuperLU matrix constructor.
 	int *sluColumnPointers = new int[numColumns+1];
 	for(unsigned int n = 0; n < numColumns+1; n++)
@@ -191,9 +215,10 @@ void LUSolver::setMatrix(const SparseMatrix<complex<double>> &sparseMatrix){
 		);
 	}
 
-	allocatePermutationMatrices(numRows, numColumns);
+	if(!samePattern)
+		allocatePermutationMatrices(numRows, numColumns);
 	initStatistics();
-	performLUFactorization(sluMatrix);
+	performLUFactorization(sluMatrix, samePattern);
 
 	//Clean up
 	Destroy_CompCol_Matrix(&sluMatrix);
@@ -207,8 +232,48 @@ void LUSolver::allocatePermutationMatrices(
 		delete [] rowPermutations;
 	if(columnPermutations != nullptr)
 		delete [] columnPermutations;
+	if(eliminationTree != nullptr)
+		delete [] eliminationTree;
 	rowPermutations = new int[numRows];
 	columnPermutations = new int[numColumns];
+	eliminationTree = new int[numColumns];
+}
+
+bool LUSolver::updateSparsityPattern(
+	unsigned int numRows,
+	unsigned int numColumns,
+	unsigned int numMatrixElements,
+	const unsigned int *columnPointers,
+	const unsigned int *rows
+){
+	bool samePattern = (
+		reuseSymbolicFactorization
+		&& L != nullptr
+		&& numRows == patternNumRows
+		&& numColumns + 1 == patternColumnPointers.size()
+		&& numMatrixElements == patternRows.size()
+		&& equal(
+			columnPointers,
+			columnPointers + numColumns + 1,
+			patternColumnPointers.begin()
+		)
+		&& equal(
+			rows,
+			rows + numMatrixElements,
+			patternRows.begin()
+		)
+	);
+
+	if(!samePattern){
+		patternNumRows = numRows;
+		patternColumnPointers.assign(
+			columnPointers,
+			columnPointers + numColumns + 1
+		);
+		patternRows.assign(rows, rows + numMatrixElements);
+	}
+
+	return samePattern;
 }
 
 void LUSolver::initStatistics(){
@@ -267,31 +332,44 @@ void LUSolver::checkXgstrfErrors(
 
 void LUSolver::initOptionsAndPermutationMatrices(
 	superlu_options_t &options,
-	SuperMatrix &matrix
+	SuperMatrix &matrix,
+	bool samePattern
 ){
 	//Initialize options.
 	set_default_options(&options);
 	options.ColPerm = COLAMD;
 
+	//Reuse the column permutations from the previous factorization.
+	//SuperLU still recalculates the elimination tree in sp_preorder(),
+	//and row permutations are still calculated through partial
+	//pivoting.
+	if(samePattern)
+		options.Fact = SamePattern;
+
 	//Calculate column permutations.
 	if(options.ColPerm != MY_PERMC && options.Fact == DOFACT)
 		get_perm_c(options.ColPerm, &matrix, columnPermutations);
 }
 
 //LU factorization performed in accordance with the procedure used in
-//zgssv.c in SuperLU 5.2.1. See this file for further details.
-void LUSolver::performLUFactorization(SuperMatrix &matrix){
+//zgssv.c and zgssvx.c in SuperLU 5.2.1. See these files for further details.
+void LUSolver::performLUFactorization(SuperMatrix &matrix, bool samePattern){
 	allocateLUMatrices();
 
 	superlu_options_t options;
-	initOptionsAndPermutationMatrices(options, matrix);
-
-	int *etree = new int[matrix.ncol];
+	initOptionsAndPermutationMatrices(options, matrix, samePattern);
 
 	//Create new matrix resulting from post multiplication by the column
-	//permutation matrix, i.e. matrix*columnPermutations.
+	//permutation matrix, i.e. matrix*columnPermutations, and calculate
+	//the elimination tree.
 	SuperMatrix matrixCP;
-	sp_preorder(&options, &matrix, columnPermutations, etree, &matrixCP);
+	sp_preorder(
+		&options,
+		&matrix,
+		columnPermutations,
+		eliminationTree,
+		&matrixCP
+	);
 
 	//Query optimization parameters.
 	int panelSize = sp_ienv(1);
@@ -310,7 +388,7 @@ void LUSolver::performLUFactorization(SuperMatrix &matrix){
 			&matrixCP,
 			relax,
 			panelSize,
-			etree,
+			eliminationTree,
 			nullptr,
 			lwork,
 			columnPermutations,
@@ -332,7 +410,7 @@ void LUSolver::performLUFactorization(SuperMatrix &matrix){
 			&matrixCP,
 			relax,
 			panelSize,
-			etree,
+			eliminationTree,
 			nullptr,
 			lwork,
 			columnPermutations,
@@ -354,35 +432,50 @@ void LUSolver::performLUFactorization(SuperMatrix &matrix){
 		);
 	}
 
-	SUPERLU_FREE(etree);
 	Destroy_CompCol_Permuted(&matrixCP);
 }
 
 void LUSolver::solve(Matrix<double> &b){
-	unsigned int numRows = b.getNumRows();
-	unsigned int numColumns = b.getNumCols();
-	checkSolveAssert(numRows);
+	checkSolveAssert(b.getNumRows());
+	if(b.getNumCols() == 0)
+		return;
+
+	//Matrix stores the elements column wise, which is the format used by
+	//SuperLU.
+	solve(&b.at(0, 0), b.getNumCols());
+}
+
+void LUSolver::solve(Matrix<complex<double>> &b){
+	checkSolveAssert(b.getNumRows());
+	if(b.getNumCols() == 0)
+		return;
+
+	//Matrix stores the elements column wise, which is the format used by
+	//SuperLU.
+	solve(&b.at(0, 0), b.getNumCols());
+}
+
+void LUSolver::solve(double *b, unsigned int numRightHandSides){
+	checkSolveAssert();
 
 	TBTKAssert(
 		matrixDataType == DataType::Double,
-//		U->Dtype == SLU_D,
 		"LUSolver::solve()",
 		"The matrix is complex, therefore 'b' must be complex.",
 		""
 	);
 
-	//Setup right hand side on SuperLU format.
-	double *sluBValues = new double[numRows*numColumns];
-	for(unsigned int row = 0; row < numRows; row++)
-		for(unsigned int col = 0; col < numColumns; col++)
-			sluBValues[col*numRows + row] = b.at(row, col);
+	if(numRightHandSides == 0)
+		return;
 
+	//Wrap the right hand sides in a SuperLU matrix without copying.
+	unsigned int numRows = L->nrow;
 	SuperMatrix sluB;
 	dCreate_Dense_Matrix(
 		&sluB,
 		numRows,
-		numColumns,
-		sluBValues,
+		numRightHandSides,
+		b,
 		numRows,	//Leading dimension
 		SLU_DN,
 		SLU_D,
@@ -403,132 +496,64 @@ void LUSolver::solve(Matrix<double> &b){
 	);
 	checkXgstrsErrors(info, "dgstrs");
 
-	//Copy results to return value
-	for(unsigned int row = 0; row < numRows; row++)
-		for(unsigned int col = 0; col < numColumns; col++)
-			b.at(row, col) = sluBValues[col*numRows + row];
-
-	Destroy_Dense_Matrix(&sluB);
+	//Only destroy the wrapper since b is owned by the caller.
+	Destroy_SuperMatrix_Store(&sluB);
 }
 
-void LUSolver::solve(Matrix<complex<double>> &b){
-	unsigned int numRows = b.getNumRows();
-	unsigned int numColumns = b.getNumCols();
-	checkSolveAssert(numRows);
+void LUSolver::solve(complex<double> *b, unsigned int numRightHandSides){
+	checkSolveAssert();
 
-//	switch(U->Dtype){
-//	case SLU_D:
+	if(numRightHandSides == 0)
+		return;
+
+	unsigned int numRows = L->nrow;
 	switch(matrixDataType){
 	case DataType::Double:
 	{
-		//Setup right hand side on SuperLU format.
-		double *sluBValuesReal = new double[numRows*numColumns];
-		double *sluBValuesImag = new double[numRows*numColumns];
+		//Store the real parts of all right hand sides followed by the
+		//imaginary parts, such that both are solved for in a single
+		//call. Parts that are zero for all right hand sides are not
+		//solved for.
+		unsigned int size = numRows*numRightHandSides;
+		vector<double> parts(2*size);
 		bool isReal = true;
 		bool isImag = true;
-		for(unsigned int row = 0; row < numRows; row++){
-			for(unsigned int col = 0; col < numColumns; col++){
-				double r = real(b.at(row, col));
-				double i = imag(b.at(row, col));
-				sluBValuesReal[col*numRows + row] = r;
-				sluBValuesImag[col*numRows + row] = i;
-
-				if(r != 0)
-					isImag = false;
-				if(i != 0)
-					isReal = false;
-			}
+		for(unsigned int n = 0; n < size; n++){
+			parts[n] = real(b[n]);
+			parts[size + n] = imag(b[n]);
+
+			if(parts[n] != 0)
+				isImag = false;
+			if(parts[size + n] != 0)
+				isReal = false;
 		}
 
-		SuperMatrix sluBReal;
-		dCreate_Dense_Matrix(
-			&sluBReal,
-			numRows,
-			numColumns,
-			sluBValuesReal,
-			numRows,	//Leading dimension
-			SLU_DN,
-			SLU_D,
-			SLU_GE
-		);
-
-		SuperMatrix sluBImag;
-		dCreate_Dense_Matrix(
-			&sluBImag,
-			numRows,
-			numColumns,
-			sluBValuesImag,
-			numRows,	//Leading dimension
-			SLU_DN,
-			SLU_D,
-			SLU_GE
-		);
-
-		//Solve real part
-		if(!isImag){
-			int info;
-			dgstrs(
-				NOTRANS,
-				L,
-				U,
-				columnPermutations,
-				rowPermutations,
-				&sluBReal,
-				statistics,
-				&info
-			);
-			checkXgstrsErrors(info, "dgstrs");
-		}
-
-		//Solve imaginary part
-		if(!isReal){
-			int info;
-			dgstrs(
-				NOTRANS,
-				L,
-				U,
-				columnPermutations,
-				rowPermutations,
-				&sluBImag,
-				statistics,
-				&info
-			);
-			checkXgstrsErrors(info, "dgstrs");
-		}
+		if(isReal && isImag)
+			return;
+		else if(isReal)
+			solve(parts.data(), numRightHandSides);
+		else if(isImag)
+			solve(parts.data() + size, numRightHandSides);
+		else
+			solve(parts.data(), 2*numRightHandSides);
 
 		//Copy results to return value
-		for(unsigned int row = 0; row < numRows; row++){
-			for(unsigned int col = 0; col < numColumns; col++){
-				b.at(row, col) = complex<double>(
-					sluBValuesReal[col*numRows + row],
-					sluBValuesImag[col*numRows + row]
-				);
-			}
-		}
-
-		Destroy_Dense_Matrix(&sluBReal);
-		Destroy_Dense_Matrix(&sluBImag);
+		for(unsigned int n = 0; n < size; n++)
+			b[n] = complex<double>(parts[n], parts[size + n]);
 
 		break;
 	}
-//	case SLU_Z:
 	case DataType::ComplexDouble:
 	{
-		//Setup right hand side on SuperLU format.
-		doublecomplex *sluBValues = new doublecomplex[numRows*numColumns];
-		for(unsigned int row = 0; row < numRows; row++){
-			for(unsigned int col = 0; col < numColumns; col++){
-				sluBValues[col*numRows + row].r = real(b.at(row, col));
-				sluBValues[col*numRows + row].i = imag(b.at(row, col));
-			}
-		}
-
+		//Wrap the right hand sides in a SuperLU matrix without
+		//copying. complex<double> and doublecomplex have the same
+		//memory layout.
 		SuperMatrix sluB;
 		zCreate_Dense_Matrix(
 			&sluB,
 			numRows,
-			numColumns,
-			sluBValues,
+			numRightHandSides,
+			reinterpret_cast<doublecomplex*>(b),
 			numRows,	//Leading dimension
 			SLU_DN,
 			SLU_Z,
@@ -549,17 +574,8 @@ void LUSolver::solve(Matrix<complex<double>> &b){
 		);
 		checkXgstrsErrors(info, "zgstrs");
 
-		//Copy results to return value
-		for(unsigned int row = 0; row < numRows; row++){
-			for(unsigned int col = 0; col < numColumns; col++){
-				b.at(row, col) = complex<double>(
-					sluBValues[col*numRows + row].r,
-					sluBValues[col*numRows + row].i
-				);
-			}
-		}
-
-		Destroy_Dense_Matrix(&sluB);
+		//Only destroy the wrapper since b is owned by the caller.
+		Destroy_SuperMatrix_Store(&sluB);
 
 		break;
 	}
@@ -573,7 +589,7 @@ void LUSolver::solve(Matrix<complex<double>> &b){
 	}
 }
 
-void LUSolver::checkSolveAssert(unsigned int numRows){
+void LUSolver::checkSolveAssert(){
 	TBTKAssert(
 		L != nullptr,
 		"LUSolver::solve()",
@@ -581,6 +597,10 @@ void LUSolver::checkSolveAssert(unsigned int numRows){
 		"Use LUSolver::setMatrix() to set a matrix to use on the left"
 		<< " hand side."
 	);
+}
+
+void LUSolver::checkSolveAssert(unsigned int numRows){
+	checkSolveAssert();
 
 	TBTKAssert(
 		(int)numRows == L->nrow,
@@ -44,11 +44,13 @@ LindhardSusceptibility::LindhardSusceptibility(
 			model.getTemperature()
 		);
 	}
+
+	calculateAllOrbitals = false;
 }
 
 LindhardSusceptibility::LindhardSusceptibility(
 	const MomentumSpaceContext &momentumSpaceContext,
-	int *kPlusQLookupTable,
+	const int *kPlusQLookupTable,
 	double *fermiDiracLookupTable
 ) :
 	Susceptibility(
@@ -58,6 +60,8 @@ LindhardSusceptibility::LindhardSusceptibility(
 	)
 {
 	this->fermiDiracLookupTable = fermiDiracLookupTable;
+
+	calculateAllOrbitals = false;
 }
 
 LindhardSusceptibility::~LindhardSusceptibility(){
@@ -66,11 +70,14 @@ LindhardSusceptibility::~LindhardSusceptibility(){
 }
 
 LindhardSusceptibility* LindhardSusceptibility::createSlave(){
-	return new LindhardSusceptibility(
+	LindhardSusceptibility *slave = new LindhardSusceptibility(
 		getMomentumSpaceContext(),
 		getKPlusQLookupTable(),
 		fermiDiracLookupTable
 	);
+	slave->setCalculateAllOrbitals(calculateAllOrbitals);
+
+	return slave;
 }
 
 inline complex<double> LindhardSusceptibility::getPoleTimesTwoFermi(
@@ -398,26 +405,281 @@ vector<complex<double>> LindhardSusceptibility::calculateSusceptibilityLindhard(
 	return result;
 }
 
+extern "C" {
+	void zgemm_(
+		char *transa,
+		char *transb,
+		int *m,
+		int *n,
+		int *k,
+		complex<double> *alpha,
+		complex<double> *a,
+		int *lda,
+		complex<double> *b,
+		int *ldb,
+		complex<double> *beta,
+		complex<double> *c,
+		int *ldc
+	);
+}
+
+vector<complex<double>> LindhardSusceptibility::calculateSusceptibilityAllOrbitals(
+	const Index &kIndex,
+	const vector<complex<double>> &energies
+){
+	const MomentumSpaceContext &momentumSpaceContext = getMomentumSpaceContext();
+	const vector<vector<double>> &mesh = momentumSpaceContext.getMesh();
+	const Model &model = momentumSpaceContext.getModel();
+	int numOrbitals = momentumSpaceContext.getNumOrbitals();
+	int numOrbitalPairs = numOrbitals*numOrbitals;
+	int numEnergies = energies.size();
+	double chemicalPotential = model.getChemicalPotential();
+	double temperature = model.getTemperature();
+
+	//Get linear index corresponding to kIndex.
+	int kLinearIndex = model.getHoppingAmplitudeSet().getFirstIndexInBlock(
+		kIndex
+	);
+	vector<double> k;
+
+	//Amplitude products u_{s1}(o3)u_{s1}^{*}(o0) at k' and
+	//u_{s2}(o1)u_{s2}^{*}(o2) at k'+q, stored as column major
+	//numOrbitalPairs x numOrbitals matrices.
+	vector<complex<double>> amplitudeProducts0(numOrbitalPairs*numOrbitals);
+	vector<complex<double>> amplitudeProducts1(numOrbitalPairs*numOrbitals);
+	//Band pair weights stored as one column major numOrbitals x
+	//numEnergies matrix for each state1.
+	vector<complex<double>> weights(numOrbitals*numOrbitals*numEnergies);
+	//Weights contracted with amplitudeProducts1, stored as a column major
+	//(numOrbitalPairs*numEnergies) x numOrbitals matrix.
+	vector<complex<double>> contractedWeights(
+		numOrbitalPairs*numEnergies*numOrbitals
+	);
+	//Accumulated result stored as a column major
+	//(numOrbitalPairs*numEnergies) x numOrbitalPairs matrix.
+	vector<complex<double>> accumulator(
+		numOrbitalPairs*numEnergies*numOrbitalPairs,
+		0.
+	);
+
+	for(unsigned int meshPoint = 0; meshPoint < mesh.size(); meshPoint++){
+		int kPlusQLinearIndex = getKPlusQLinearIndex<true>(
+			meshPoint,
+			k,
+			kLinearIndex
+		);
+		int kPlusQMeshPoint = kPlusQLinearIndex/numOrbitals;
+
+		for(int state = 0; state < numOrbitals; state++){
+			for(int o0 = 0; o0 < numOrbitals; o0++){
+				complex<double> a0 = conj(
+					momentumSpaceContext.getAmplitude(
+						meshPoint,
+						state,
+						o0
+					)
+				);
+				complex<double> a1 = conj(
+					momentumSpaceContext.getAmplitude(
+						kPlusQMeshPoint,
+						state,
+						o0
+					)
+				);
+				for(int o1 = 0; o1 < numOrbitals; o1++){
+					amplitudeProducts0[
+						numOrbitalPairs*state
+						+ o1*numOrbitals + o0
+					] = momentumSpaceContext.getAmplitude(
+						meshPoint,
+						state,
+						o1
+					)*a0;
+					amplitudeProducts1[
+						numOrbitalPairs*state
+						+ o1*numOrbitals + o0
+					] = momentumSpaceContext.getAmplitude(
+						kPlusQMeshPoint,
+						state,
+						o1
+					)*a1;
+				}
+			}
+		}
+
+		for(int state1 = 0; state1 < numOrbitals; state1++){
+			double e1 = momentumSpaceContext.getEnergy(
+				meshPoint,
+				state1
+			);
+			for(int state2 = 0; state2 < numOrbitals; state2++){
+				double e2 = momentumSpaceContext.getEnergy(
+					kPlusQLinearIndex + state2
+				);
+				double fermiDifference = fermiDiracLookupTable[
+					kPlusQLinearIndex + state2
+				] - fermiDiracLookupTable[
+					meshPoint*numOrbitals + state1
+				];
+				for(int e = 0; e < numEnergies; e++){
+					complex<double> &weight = weights[
+						numOrbitals*(
+							numEnergies*state1 + e
+						) + state2
+					];
+					if(abs(imag(energies[e])) < 1e-10){
+						weight = getPoleTimesTwoFermi(
+							energies[e],
+							e2,
+							e1,
+							chemicalPotential,
+							temperature,
+							kPlusQLinearIndex,
+							meshPoint,
+							state2,
+							state1,
+							numOrbitals
+						);
+					}
+					else{
+						weight = fermiDifference/(
+							energies[e] + e2 - e1
+						);
+					}
+				}
+			}
+		}
+
+		//contractedWeights_{state1}(o1o2, e)
+		//	= sum_{state2} amplitudeProducts1(o1o2, state2)
+		//	*weights_{state1}(state2, e)
+		char noTranspose = 'N';
+		char transpose = 'T';
+		complex<double> one = 1;
+		complex<double> zero = 0;
+		for(int state1 = 0; state1 < numOrbitals; state1++){
+			zgemm_(
+				&noTranspose,
+				&noTranspose,
+				&numOrbitalPairs,
+				&numEnergies,
+				&numOrbitals,
+				&one,
+				amplitudeProducts1.data(),
+				&numOrbitalPairs,
+				weights.data() + numOrbitals*numEnergies*state1,
+				&numOrbitals,
+				&zero,
+				contractedWeights.data()
+					+ numOrbitalPairs*numEnergies*state1,
+				&numOrbitalPairs
+			);
+		}
+
+		//accumulator(o1o2e, o3o0) += sum_{state1}
+		//	contractedWeights(o1o2e, state1)
+		//	*amplitudeProducts0(o3o0, state1)
+		int numRows = numOrbitalPairs*numEnergies;
+		zgemm_(
+			&noTranspose,
+			&transpose,
+			&numRows,
+			&numOrbitalPairs,
+			&numOrbitals,
+			&one,
+			contractedWeights.data(),
+			&numRows,
+			amplitudeProducts0.data(),
+			&numOrbitalPairs,
+			&one,
+			accumulator.data(),
+			&numRows
+		);
+	}
+
+	//Reorder and normalize the result.
+	vector<complex<double>> result(numOrbitalPairs*numOrbitalPairs*numEnergies);
+	for(int o0 = 0; o0 < numOrbitals; o0++){
+		for(int o1 = 0; o1 < numOrbitals; o1++){
+			for(int o2 = 0; o2 < numOrbitals; o2++){
+				for(int o3 = 0; o3 < numOrbitals; o3++){
+					unsigned int resultOffset = (
+						((o0*numOrbitals + o1)*numOrbitals + o2)
+						*numOrbitals + o3
+					)*numEnergies;
+					unsigned int accumulatorOffset
+						= numOrbitalPairs*numEnergies*(
+							o3*numOrbitals + o0
+						) + o1*numOrbitals + o2;
+					for(int e = 0; e < numEnergies; e++){
+						result[resultOffset + e]
+							= -accumulator[
+								accumulatorOffset
+								+ numOrbitalPairs*e
+							]/(double)mesh.size();
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
 vector<complex<double>> LindhardSusceptibility::calculateSusceptibility(
 	const Index &index,
 	const std::vector<std::complex<double>> &energies
 ){
-	if(getKPlusQLookupTable() != nullptr){
-		return calculateSusceptibilityLindhard<
-			true
-		>(
-			index,
-			energies
+	if(calculateAllOrbitals){
+		vector<Index> indices = index.split();
+		TBTKAssert(
+			indices.size() == 5,
+			"LindhardSusceptibility::calculateSusceptibility()",
+			"The Index must be a compound Index with 5 component"
+			<< " Indices, but '" << indices.size() << "' components"
+			<< " supplied.",
+			""
 		);
-	}
-	else{
-		return calculateSusceptibilityLindhard<
-			false
-		>(
-			index,
-			energies
+		int numOrbitals = getMomentumSpaceContext().getNumOrbitals();
+		unsigned int offset = 0;
+		for(unsigned int n = 1; n < 5; n++){
+			TBTKAssert(
+				indices[n].getSize() == 1
+				&& indices[n][0] >= 0
+				&& indices[n][0] < numOrbitals,
+				"LindhardSusceptibility::calculateSusceptibility()",
+				"Only single subindex orbitals in the range [0, "
+				<< numOrbitals << ") supported when all orbitals"
+				<< " are calculated at once, but '"
+				<< indices[n].toString() << "' supplied.",
+				""
+			);
+			offset = offset*numOrbitals + indices[n][0];
+		}
+		offset *= energies.size();
+
+		if(
+			cachedOrbitalTensor.size() == 0
+			|| !cachedKIndex.equals(indices[0])
+			|| cachedEnergies != energies
+		){
+			cachedOrbitalTensor = calculateSusceptibilityAllOrbitals(
+				indices[0],
+				energies
+			);
+			cachedKIndex = indices[0];
+			cachedEnergies = energies;
+		}
+
+		return vector<complex<double>>(
+			cachedOrbitalTensor.begin() + offset,
+			cachedOrbitalTensor.begin() + offset + energies.size()
 		);
 	}
+
+	//The k+q lookup table is shared through the MomentumSpaceContext and
+	//is therefore always available.
+	return calculateSusceptibilityLindhard<true>(index, energies);
 }
 
 }	//End of namespace Solver
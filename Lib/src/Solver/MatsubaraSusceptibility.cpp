@@ -22,6 +22,11 @@
 #include "TBTK/Solver/MatsubaraSusceptibility.h"
 #include "TBTK/UnitHandler.h"
 
+#ifdef TBTK_FFTW3_ENABLED
+#	include "TBTK/FourierTransform.h"
+#endif
+
+#include <cmath>
 #include <complex>
 #include <iomanip>
 
@@ -34,7 +39,7 @@ MatsubaraSusceptibility::MatsubaraSusceptibility(
 	const MomentumSpaceContext &momentumSpaceContext,
 	const Property::GreensFunction &greensFunction
 ) :
-	Susceptibility(Algorithm::Lindhard, momentumSpaceContext),
+	Susceptibility(Algorithm::Matsubara, momentumSpaceContext),
 	greensFunction(greensFunction)
 {
 }
@@ -48,12 +53,22 @@ MatsubaraSusceptibility* MatsubaraSusceptibility::createSlave(){
 }
 
 vector<complex<double>> MatsubaraSusceptibility::calculateSusceptibility(
-	const Index &index
+	const Index &index,
+	const vector<complex<double>> &energies
 ){
-	TBTKNotYetImplemented(
-		"MatsubaraSusceptibility::calculateSusceptibility()"
+	TBTKExit(
+		"Solver::MatsubaraSusceptibility::calculateSusceptibility()",
+		"This function is not supported by this solver.",
+		"The Matsubara energies are determined by the Green's"
+		<< " function. Use"
+		<< " MatsubaraSusceptibility::calculateSusceptibility(const"
+		<< " Index &index) instead."
 	);
+}
 
+vector<complex<double>> MatsubaraSusceptibility::calculateSusceptibility(
+	const Index &index
+){
 	vector<Index> components = index.split();
 	TBTKAssert(
 		components.size() == 5,
@@ -80,20 +95,150 @@ vector<complex<double>> MatsubaraSusceptibility::calculateSusceptibility(
 		<< " Property::EnergyResolvedProperty::EnergyType::FermionMatsubara",
 		""
 	);
-	unsigned int numMatsubaraEnergies
-		= greensFunction.getNumMatsubaraEnergies();
-//	unsigned int lowerFermionicMatsubaraEnergyIndex
-//		= greensFunction.getLowerMatsubaraEnergyIndex();
-//	vector<int> matsubaraIndices;
-//	for(unsigned int n = 0; n < numMatsubaraEnergies; n++)
-//		matsubaraIndices[n] = lowerFermionicMatsubaraEnergyIndex + 2*n;
+	TBTKAssert(
+		greensFunction.isUniform(),
+		"Solver::MatsubaraSusceptibility::calculateSusceptibility()",
+		"The Green's function must be given on a contiguous set of"
+		<< " Matsubara energies since the Matsubara sum is calculated"
+		<< " as a convolution.",
+		""
+	);
+
+	//The susceptibility is calculated for all mesh points at once, so
+	//only recalculate it if the intra block Indices have changed.
+	Index intraBlockIndicesCompound({
+		intraBlockIndices[0],
+		intraBlockIndices[1],
+		intraBlockIndices[2],
+		intraBlockIndices[3]
+	});
+	if(
+		cachedSusceptibility.size() == 0
+		|| !cachedIntraBlockIndices.equals(intraBlockIndicesCompound)
+	){
+		calculateSusceptibilityAllMeshPoints(intraBlockIndices);
+		cachedIntraBlockIndices = intraBlockIndicesCompound;
+	}
+
+	unsigned int numMeshPoints = getMomentumSpaceContext().getMesh().size();
+	unsigned int numBosonicMatsubaraEnergies
+		= 2*greensFunction.getNumMatsubaraEnergies() - 1;
+	unsigned int gridPosition = getGridPosition(kIndex);
 
 	vector<complex<double>> susceptibility;
-	susceptibility.reserve(numMatsubaraEnergies);
-	for(unsigned int n = 0; n < numMatsubaraEnergies; n++){
-		susceptibility.push_back(0.);
+	susceptibility.reserve(numBosonicMatsubaraEnergies);
+	for(unsigned int n = 0; n < numBosonicMatsubaraEnergies; n++){
+		susceptibility.push_back(
+			cachedSusceptibility[n*numMeshPoints + gridPosition]
+		);
+	}
+
+	return susceptibility;
+}
+
+unsigned int MatsubaraSusceptibility::getGridPosition(
+	const Index &kIndex
+) const{
+	const vector<unsigned int> &numMeshPoints
+		= getMomentumSpaceContext().getNumMeshPoints();
+	TBTKAssert(
+		kIndex.getSize() == numMeshPoints.size(),
+		"Solver::MatsubaraSusceptibility::getGridPosition()",
+		"The momentum Index '" << kIndex.toString() << "' is"
+		<< " incompatible with the " << numMeshPoints.size()
+		<< "-dimensional mesh.",
+		""
+	);
+
+	unsigned int gridPosition = 0;
+	for(unsigned int n = 0; n < numMeshPoints.size(); n++)
+		gridPosition = gridPosition*numMeshPoints[n] + kIndex[n];
+
+	return gridPosition;
+}
+
+#ifdef TBTK_FFTW3_ENABLED
+/** Perform an unnormalized Fourier transform in place over all dimensions of
+ *  the array 'data', which is stored with the Matsubara energy as the major
+ *  index and the row-major momentum grid as the minor index. */
+static void transformMomentumAndEnergy(
+	vector<complex<double>> &data,
+	const vector<unsigned int> &numMeshPoints,
+	unsigned int numEnergies,
+	int sign
+){
+	unsigned int gridSize = data.size()/numEnergies;
+
+	//Transform the momentum dimensions for each energy.
+	vector<complex<double>> momentumBuffer(gridSize);
+	FourierTransform::Plan<complex<double>> *momentumPlan;
+	switch(numMeshPoints.size()){
+	case 1:
+		momentumPlan = new FourierTransform::Plan<complex<double>>(
+			momentumBuffer.data(),
+			momentumBuffer.data(),
+			numMeshPoints[0],
+			sign
+		);
+		break;
+	case 2:
+		momentumPlan = new FourierTransform::Plan<complex<double>>(
+			momentumBuffer.data(),
+			momentumBuffer.data(),
+			numMeshPoints[0],
+			numMeshPoints[1],
+			sign
+		);
+		break;
+	case 3:
+		momentumPlan = new FourierTransform::Plan<complex<double>>(
+			momentumBuffer.data(),
+			momentumBuffer.data(),
+			numMeshPoints[0],
+			numMeshPoints[1],
+			numMeshPoints[2],
+			sign
+		);
+		break;
+	default:
+		TBTKExit(
+			"Solver::MatsubaraSusceptibility::calculateSusceptibilityAllMeshPoints()",
+			"Only 1-3 dimensional meshes supported.",
+			""
+		);
+	}
+	momentumPlan->setNormalizationFactor(1.);
+	for(unsigned int e = 0; e < numEnergies; e++){
+		for(unsigned int n = 0; n < gridSize; n++)
+			momentumBuffer[n] = data[e*gridSize + n];
+		FourierTransform::transform(*momentumPlan);
+		for(unsigned int n = 0; n < gridSize; n++)
+			data[e*gridSize + n] = momentumBuffer[n];
+	}
+	delete momentumPlan;
+
+	//Transform the energy dimension for each momentum.
+	vector<complex<double>> energyBuffer(numEnergies);
+	FourierTransform::Plan<complex<double>> energyPlan(
+		energyBuffer.data(),
+		energyBuffer.data(),
+		numEnergies,
+		sign
+	);
+	energyPlan.setNormalizationFactor(1.);
+	for(unsigned int n = 0; n < gridSize; n++){
+		for(unsigned int e = 0; e < numEnergies; e++)
+			energyBuffer[e] = data[e*gridSize + n];
+		FourierTransform::transform(energyPlan);
+		for(unsigned int e = 0; e < numEnergies; e++)
+			data[e*gridSize + n] = energyBuffer[e];
 	}
+}
+#endif
 
+void MatsubaraSusceptibility::calculateSusceptibilityAllMeshPoints(
+	const Index intraBlockIndices[4]
+){
 	const MomentumSpaceContext &momentumSpaceContext
 		= getMomentumSpaceContext();
 	const vector<vector<double>> &mesh = momentumSpaceContext.getMesh();
@@ -102,60 +247,129 @@ vector<complex<double>> MatsubaraSusceptibility::calculateSusceptibility(
 	const BrillouinZone &brillouinZone
 		= momentumSpaceContext.getBrillouinZone();
 
-	vector<unsigned int> kVector;
-	kVector.reserve(kIndex.getSize());
-	for(unsigned int n = 0; n < kIndex.getSize(); n++)
-		kVector.push_back(kIndex[n]);
-	vector<double> k = brillouinZone.getMinorMeshPoint(
-		kVector,
-		numMeshPoints
+	unsigned int gridSize = 1;
+	for(unsigned int n = 0; n < numMeshPoints.size(); n++)
+		gridSize *= numMeshPoints[n];
+	TBTKAssert(
+		gridSize == mesh.size(),
+		"Solver::MatsubaraSusceptibility::calculateSusceptibilityAllMeshPoints()",
+		"The number of mesh points '" << mesh.size() << "' does not"
+		<< " agree with the mesh dimensions.",
+		""
 	);
 
+	unsigned int numFermionicMatsubaraEnergies
+		= greensFunction.getNumMatsubaraEnergies();
+	unsigned int numBosonicMatsubaraEnergies
+		= 2*numFermionicMatsubaraEnergies - 1;
+
+	//Zero padding in the energy direction turns the periodic convolution
+	//into the linear convolution required for the Matsubara sum. The
+	//momentum direction is periodic and needs no padding.
+#ifdef TBTK_FFTW3_ENABLED
+	unsigned int numEnergies = 2*numFermionicMatsubaraEnergies;
+#else
+	unsigned int numEnergies = numFermionicMatsubaraEnergies;
+#endif
+
+	//Gather G_{da}(p, i\nu_n) and G_{bc}(p, i\nu_n) on the row-major
+	//momentum grid.
+	vector<complex<double>> g0(numEnergies*gridSize, 0.);
+	vector<complex<double>> g1(numEnergies*gridSize, 0.);
+	const vector<complex<double>> &data = greensFunction.getData();
 	for(unsigned int meshPoint = 0; meshPoint < mesh.size(); meshPoint++){
-		Index qIndex = brillouinZone.getMinorCellIndex(
-			{mesh[meshPoint][0], mesh[meshPoint][1]},
-			numMeshPoints
-		);
-		Index kPlusQIndex = brillouinZone.getMinorCellIndex(
-			{k[0] + mesh[meshPoint][0], k[1] + mesh[meshPoint][1]},
+		Index kIndex = brillouinZone.getMinorCellIndex(
+			mesh[meshPoint],
 			numMeshPoints
 		);
+		unsigned int gridPosition = getGridPosition(kIndex);
+		int offset0 = greensFunction.getOffset({
+			Index(kIndex, intraBlockIndices[3]),
+			Index(kIndex, intraBlockIndices[0])
+		});
+		int offset1 = greensFunction.getOffset({
+			Index(kIndex, intraBlockIndices[1]),
+			Index(kIndex, intraBlockIndices[2])
+		});
+		for(unsigned int n = 0; n < numFermionicMatsubaraEnergies; n++){
+			g0[n*gridSize + gridPosition] = data[offset0 + n];
+			g1[n*gridSize + gridPosition] = data[offset1 + n];
+		}
+	}
 
-		for(unsigned int n = 0; n < numMatsubaraEnergies; n++){
-			for(unsigned int c = 0; c < numMatsubaraEnergies; c++){
-/*				if(n+c >= numMatsubaraEnergies)
-					continue;
-
-				susceptibility[n] += greensFunction(
-					{
-						Index(
-							qIndex,
-							intraBlockIndices[3]
-						),
-						Index(
-							qIndex,
-							intraBlockIndices[0]
-						)
-					},
-					c
-				)*greensFunction(
-					{
-						Index(
-							kPlusQIndex,
-							intraBlockIndices[1]
-						),
-						Index(
-							kPlusQIndex,
-							intraBlockIndices[2]
-						)
-					},
-					n + c
-				);*/
-			}
+	double kT = greensFunction.getFundamentalMatsubaraEnergy()/M_PI;
+	cachedSusceptibility.assign(numBosonicMatsubaraEnergies*gridSize, 0.);
+
+#ifdef TBTK_FFTW3_ENABLED
+	//The correlation \sum_{p,n}g0(p, n)g1(p+k, n+m) is given by
+	//F^{-1}[F^{-1}[g0]F[g1]]/(numEnergies*gridSize) for unnormalized
+	//transforms.
+	transformMomentumAndEnergy(g0, numMeshPoints, numEnergies, 1);
+	transformMomentumAndEnergy(g1, numMeshPoints, numEnergies, -1);
+	for(unsigned int n = 0; n < g0.size(); n++)
+		g0[n] *= g1[n];
+	transformMomentumAndEnergy(g0, numMeshPoints, numEnergies, 1);
+
+	double prefactor = -kT/(
+		mesh.size()*(double)numEnergies*(double)gridSize
+	);
+	for(unsigned int e = 0; e < numBosonicMatsubaraEnergies; e++){
+		int m = (int)e - (int)(numFermionicMatsubaraEnergies - 1);
+		unsigned int energy = (m + numEnergies)%numEnergies;
+		for(unsigned int n = 0; n < gridSize; n++){
+			cachedSusceptibility[e*gridSize + n]
+				= prefactor*g0[energy*gridSize + n];
+		}
+	}
+#else
+	//Direct summation when no FFT library is available. The momentum
+	//grid coordinates are precomputed to make p+k a cheap operation.
+	vector<vector<unsigned int>> coordinates(gridSize);
+	for(unsigned int n = 0; n < gridSize; n++){
+		coordinates[n].resize(numMeshPoints.size());
+		unsigned int remainder = n;
+		for(int c = numMeshPoints.size()-1; c >= 0; c--){
+			coordinates[n][c] = remainder%numMeshPoints[c];
+			remainder /= numMeshPoints[c];
 		}
 	}
 
-	return susceptibility;
+	double prefactor = -kT/mesh.size();
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp parallel for
+#endif
+	for(unsigned int k = 0; k < gridSize; k++){
+		for(unsigned int p = 0; p < gridSize; p++){
+			unsigned int pPlusK = 0;
+			for(unsigned int c = 0; c < numMeshPoints.size(); c++){
+				pPlusK = pPlusK*numMeshPoints[c] + (
+					coordinates[p][c] + coordinates[k][c]
+				)%numMeshPoints[c];
+			}
+
+			for(
+				unsigned int e = 0;
+				e < numBosonicMatsubaraEnergies;
+				e++
+			){
+				int m = (int)e
+					- (int)(numFermionicMatsubaraEnergies - 1);
+				int nBegin = max(0, -m);
+				int nEnd = min(
+					(int)numFermionicMatsubaraEnergies,
+					(int)numFermionicMatsubaraEnergies - m
+				);
+				complex<double> sum = 0;
+				for(int n = nBegin; n < nEnd; n++){
+					sum += g0[n*gridSize + p]
+						*g1[(n + m)*gridSize + pPlusK];
+				}
+				cachedSusceptibility[e*gridSize + k]
+					+= prefactor*sum;
+			}
+		}
+	}
+#endif
 }
 
 }	//End of namespace Solver
@@ -51,8 +51,6 @@ SelfEnergy::SelfEnergy(
 }
 
 SelfEnergy::~SelfEnergy(){
-	if(kMinusQLookupTable != nullptr)
-		delete [] kMinusQLookupTable;
 }
 
 void SelfEnergy::init(){
@@ -67,7 +65,8 @@ void SelfEnergy::init(){
 		""
 	);
 	TBTKAssert(
-		interactionVertex.getNumMatsubaraEnergies()%2 == 1,
+		!interactionVertex.isUniform()
+		|| interactionVertex.getNumMatsubaraEnergies()%2 == 1,
 		"Solver::SelfEnergy::init()",
 		"The number of summation energies must be an odd number but it"
 		<< " is '" << interactionVertex.getNumMatsubaraEnergies()
@@ -87,103 +86,34 @@ void SelfEnergy::init(){
 		""
 	);
 
-	if(kMinusQLookupTable != nullptr){
-		delete [] kMinusQLookupTable;
-		kMinusQLookupTable = nullptr;
-	}
-
-	isInitialized = true;
-}
-
-void SelfEnergy::generateKMinusQLookupTable(){
-	if(kMinusQLookupTable != nullptr)
-		return;
-
-	Timer::tick("Calculate k-q lookup table.");
-	const vector<vector<double>> &mesh = momentumSpaceContext.getMesh();
-	const vector<unsigned int> &numMeshPoints = momentumSpaceContext.getNumMeshPoints();
-	const BrillouinZone &brillouinZone = momentumSpaceContext.getBrillouinZone();
-	const Model &model = getModel();
-	unsigned int numOrbitals = momentumSpaceContext.getNumOrbitals();
-
-	kMinusQLookupTable = new int[mesh.size()*mesh.size()];
-
-	string cacheName = "cache/kMinusQLookupTable";
+	//Energies and weights for the sum over the Matsubara energies of the
+	//interaction vertex. The weights are one unless the interaction vertex
+	//is given on a sparse set of Matsubara energies, in which case each
+	//included Matsubara energy represents the left out Matsubara energies
+	//next to it.
+	summationEnergies.clear();
+	summationWeights.clear();
 	for(
 		unsigned int n = 0;
-		n < numMeshPoints.size();
+		n < interactionVertex.getNumMatsubaraEnergies();
 		n++
 	){
-		cacheName += "_" + to_string(numMeshPoints.at(n));
-	}
-	ifstream fin(cacheName);
-	if(fin){
-		unsigned int counter = 0;
-		int value;
-		while(fin >> value){
-			TBTKAssert(
-				counter < mesh.size()*mesh.size(),
-				"Solver::SelfEnergy::generateKMinusQLookupTable()",
-				"Found cache file '" << cacheName << "',"
-				<< " but the cache is too large.",
-				"Clear the cache to recalculate"
-				<< " kMinusQLookupTable."
-			);
-			kMinusQLookupTable[counter] = value;
-			counter++;
-		}
-		fin.close();
-
-		TBTKAssert(
-			counter == mesh.size()*mesh.size(),
-			"Solver::SelfEnergy::generateKMinusQLookupTable()",
-			"Found cache file '" << cacheName << "',"
-			<< " but the cache is too small.",
-			"Clear the cache to recalculate kMinusQLookupTable."
+		summationEnergies.push_back(
+			interactionVertex.getMatsubaraEnergy(n)
+		);
+		summationWeights.push_back(
+			interactionVertex.getMatsubaraSummationWeight(n)
 		);
-
-		Timer::tock();
-
-		return;
 	}
 
-#ifdef TBTK_USE_OPEN_MP
-	#pragma omp parallel for
-#endif
-	for(unsigned int k = 0; k < mesh.size(); k++){
-		const vector<double> &K = mesh.at(k);
-		for(unsigned int q = 0; q < mesh.size(); q++){
-			const vector<double> &Q = mesh.at(q);
-
-			vector<double> kMinusQ;
-			for(unsigned int n = 0; n < K.size(); n++)
-				kMinusQ.push_back(K.at(n) - Q.at(n));
-
-			Index qIndex = brillouinZone.getMinorCellIndex(
-				Q,
-				numMeshPoints
-			);
-			int qLinearIndex = model.getHoppingAmplitudeSet().getFirstIndexInBlock(
-				qIndex
-			);
-			Index kMinusQIndex = brillouinZone.getMinorCellIndex(
-				kMinusQ,
-				numMeshPoints
-			);
-			kMinusQLookupTable[
-				k*mesh.size() + qLinearIndex/numOrbitals
-			] = model.getHoppingAmplitudeSet().getFirstIndexInBlock(
-				kMinusQIndex
-			);
-		}
-	}
+	isInitialized = true;
+}
 
-	ofstream fout(cacheName);
-	if(fout)
-		for(unsigned int n = 0; n < mesh.size()*mesh.size(); n++)
-			fout << kMinusQLookupTable[n] << "\n";
+void SelfEnergy::generateKMinusQLookupTable(){
+	if(kMinusQLookupTable != nullptr)
+		return;
 
-	Timer::tock();
+	kMinusQLookupTable = momentumSpaceContext.getKMinusQLookupTable();
 }
 
 template<>
@@ -334,11 +264,11 @@ void SelfEnergy::selfEnergyMainLoop(
 	#pragma omp parallel for default(none) shared( \
 		mesh, \
 		kLinearIndex, \
-		/*k,*/ \
+		k, \
 		/*kIndex,*/ \
 		numOrbitals, \
-		/*intraBlockIndices0,*/ \
-		/*intraBlockIndices1,*/ \
+		intraBlockIndices0, \
+		intraBlockIndices1, \
 		momentumSpaceContext, \
 		model, \
 		results, \
@@ -397,17 +327,6 @@ void SelfEnergy::selfEnergyMainLoop(
 							{(int)propagatorStart},
 							intraBlockIndices1
 						});
-					vector<complex<double>> summationEnergies;
-					for(
-						unsigned int n = 0;
-						n < interactionVertex.getNumMatsubaraEnergies();
-						n++
-					){
-						summationEnergies.push_back(
-							interactionVertex.getMatsubaraEnergy(n)
-						);
-					}
-
 					for(
 						unsigned int state = 0;
 						state < numOrbitals;
@@ -437,7 +356,7 @@ void SelfEnergy::selfEnergyMainLoop(
 							e0++
 						){
 //							complex<double> numerator = selfEnergyVertex[e0]*greensFunctionNumerator;
-							complex<double> numerator = selfEnergyVertexData[offsetSelfEnergyVertex + e0]*greensFunctionNumerator;
+							complex<double> numerator = summationWeights[e0]*selfEnergyVertexData[offsetSelfEnergyVertex + e0]*greensFunctionNumerator;
 							complex<double> E = summationEnergies[e0] - relativeStateEnergy;
 
 							if(singleSelfEnergyEnergy){
@@ -51,13 +51,15 @@ LindhardSusceptibilityCalculator::LindhardSusceptibilityCalculator(
 
 LindhardSusceptibilityCalculator::LindhardSusceptibilityCalculator(
 	const MomentumSpaceContext &momentumSpaceContext,
-	int *kPlusQLookupTable,
-	double *fermiDiracLookupTable
+	const int *kPlusQLookupTable,
+	double *fermiDiracLookupTable,
+	SusceptibilityCache *susceptibilityCache
 ) :
 	SusceptibilityCalculator(
 		Algorithm::Lindhard,
 		momentumSpaceContext,
-		kPlusQLookupTable
+		kPlusQLookupTable,
+		susceptibilityCache
 	)
 {
 	susceptibilityIsSafeFromPoles = false;
@@ -74,7 +76,8 @@ LindhardSusceptibilityCalculator* LindhardSusceptibilityCalculator::createSlave(
 	return new LindhardSusceptibilityCalculator(
 		getMomentumSpaceContext(),
 		getKPlusQLookupTable(),
-		fermiDiracLookupTable
+		fermiDiracLookupTable,
+		&getSusceptibilityCache()
 	);
 }
 
@@ -405,7 +408,7 @@ vector<complex<double>> LindhardSusceptibilityCalculator::calculateSusceptibilit
 
 	//Try to return cashed result
 	SerializableVector<complex<double>> result;
-	if(getSusceptibilityTree().get(result, resultIndex))
+	if(getSusceptibilityCache().get(result, resultIndex))
 		return result;
 
 	const MomentumSpaceContext &momentumSpaceContext = getMomentumSpaceContext();
@@ -39,12 +39,14 @@ MatsubaraSusceptibilityCalculator::MatsubaraSusceptibilityCalculator(
 
 MatsubaraSusceptibilityCalculator::MatsubaraSusceptibilityCalculator(
 	const MomentumSpaceContext &momentumSpaceContext,
-	int *kPlusQLookupTable
+	const int *kPlusQLookupTable,
+	SusceptibilityCache *susceptibilityCache
 ) :
 	SusceptibilityCalculator(
 		Algorithm::Matsubara,
 		momentumSpaceContext,
-		kPlusQLookupTable
+		kPlusQLookupTable,
+		susceptibilityCache
 	)
 {
 	greensFunction = nullptr;
@@ -58,7 +60,8 @@ MatsubaraSusceptibilityCalculator::~MatsubaraSusceptibilityCalculator(){
 MatsubaraSusceptibilityCalculator* MatsubaraSusceptibilityCalculator::createSlave(){
 	return new MatsubaraSusceptibilityCalculator(
 		getMomentumSpaceContext(),
-		getKPlusQLookupTable()
+		getKPlusQLookupTable(),
+		&getSusceptibilityCache()
 	);
 }
 
@@ -141,7 +144,7 @@ vector<complex<double>> MatsubaraSusceptibilityCalculator::calculateSusceptibili
 
 	//Try to return cashed result
 	SerializableVector<complex<double>> result;
-	if(getSusceptibilityTree().get(result, resultIndex))
+	if(getSusceptibilityCache().get(result, resultIndex))
 		return result;
 
 	const vector<complex<double>> &energies = getEnergies();
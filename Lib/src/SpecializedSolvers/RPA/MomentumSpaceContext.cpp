@@ -20,26 +20,82 @@
 
 #include "TBTK/RPA/MomentumSpaceContext.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
 using namespace std;
 
 namespace TBTK{
 
+/** Header of the binary cache files for the k+q and k-q lookup tables. The
+ *  header is followed by the lookup table, stored as
+ *  numMeshPoints*numMeshPoints ints. */
+class LookupTableCacheHeader{
+public:
+	/** Identifies the file as a lookup table cache file. */
+	char magic[8];
+
+	/** File format version. */
+	unsigned int version;
+
+	/** 1 for k+q and -1 for k-q. */
+	int sign;
+
+	/** Key calculated by
+	 *  MomentumSpaceContext::getLookupTableCacheKey(). */
+	unsigned long long key;
+
+	/** Number of mesh points. */
+	unsigned long long numMeshPoints;
+
+	/** Magic identifying lookup table cache files. */
+	static const char MAGIC[8];
+
+	/** Current file format version. Should be increased whenever the
+	 *  format or the content of the lookup tables is changed. */
+	static const unsigned int VERSION;
+};
+
+const char LookupTableCacheHeader::MAGIC[8]
+	= {'T', 'B', 'T', 'K', 'K', 'Q', 'L', 'T'};
+const unsigned int LookupTableCacheHeader::VERSION = 1;
+
 MomentumSpaceContext::MomentumSpaceContext(){
+	model = nullptr;
 	brillouinZone = nullptr;
 	numOrbitals = 0;
+	useIrreducibleBrillouinZone = false;
+	irreducibleModel = nullptr;
+	solver = nullptr;
+	keepSolver = true;
 	propertyExtractor = nullptr;
 	energies = nullptr;
 	amplitudes = nullptr;
 	isInitialized = false;
+	kPlusQLookupTable = nullptr;
+	kMinusQLookupTable = nullptr;
+	kPlusQLookupTableFile = nullptr;
+	kMinusQLookupTableFile = nullptr;
 }
 
 MomentumSpaceContext::~MomentumSpaceContext(){
 	if(propertyExtractor != nullptr)
 		delete propertyExtractor;
+	if(solver != nullptr)
+		delete solver;
 	if(energies != nullptr)
 		delete [] energies;
 	if(amplitudes != nullptr)
 		delete [] amplitudes;
+	if(irreducibleModel != nullptr)
+		delete irreducibleModel;
+	clearLookupTables();
 }
 
 void MomentumSpaceContext::init(){
@@ -91,15 +147,96 @@ void MomentumSpaceContext::init(){
 		<< " are set using MomentumSpaceContext::setNumOrbitals()."
 	);
 
-	Timer::tick("Diagonalize");
-	solver = Solver::BlockDiagonalizer();
-	solver.setModel(*model);
-	solver.run();
-	Timer::tock();
+	if(useIrreducibleBrillouinZone){
+		irreducibleMesh = brillouinZone->getIrreducibleMesh(
+			numMeshPoints
+		);
 
-	if(propertyExtractor != nullptr)
+		unsigned int numSymmetryOperations
+			= brillouinZone->getSymmetryOperations().size();
+		TBTKAssert(
+			orbitalRepresentations.size() == 0
+			|| orbitalRepresentations.size()
+				== numSymmetryOperations,
+			"MomentumSpaceContext::init()",
+			"The number of orbital representations '"
+			<< orbitalRepresentations.size() << "' does not agree"
+			<< " with the number of symmetry operations '"
+			<< numSymmetryOperations << "' of the BrillouinZone.",
+			""
+		);
+		for(unsigned int n = 0; n < orbitalRepresentations.size(); n++){
+			TBTKAssert(
+				orbitalRepresentations[n].getNumRows()
+					== numOrbitals
+				&& orbitalRepresentations[n].getNumCols()
+					== numOrbitals,
+				"MomentumSpaceContext::init()",
+				"Orbital representation " << n << " is a '"
+				<< orbitalRepresentations[n].getNumRows()
+				<< "x" << orbitalRepresentations[n].getNumCols()
+				<< "' matrix, but the number of orbitals is '"
+				<< numOrbitals << "'.",
+				""
+			);
+		}
+	}
+	else{
+		irreducibleMesh = BrillouinZone::IrreducibleMesh(mesh.size());
+	}
+
+	//The Index of each irreducible mesh point is only calculated once.
+	vector<Index> kIndices(irreducibleMesh.getNumPoints());
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp parallel for
+#endif
+	for(unsigned int n = 0; n < irreducibleMesh.getNumPoints(); n++){
+		kIndices[n] = brillouinZone->getMinorCellIndex(
+			mesh[irreducibleMesh.getPoint(n)],
+			numMeshPoints
+		);
+	}
+
+	if(useIrreducibleBrillouinZone){
+		//Create a Model that only contains the blocks of the
+		//irreducible mesh points.
+		if(irreducibleModel != nullptr)
+			delete irreducibleModel;
+		irreducibleModel = new Model();
+		irreducibleModel->setTemperature(model->getTemperature());
+		irreducibleModel->setChemicalPotential(
+			model->getChemicalPotential()
+		);
+		irreducibleModel->setStatistics(model->getStatistics());
+		const HoppingAmplitudeSet &hoppingAmplitudeSet
+			= model->getHoppingAmplitudeSet();
+		for(unsigned int n = 0; n < irreducibleMesh.getNumPoints(); n++){
+			for(
+				HoppingAmplitudeSet::ConstIterator iterator
+					= hoppingAmplitudeSet.cbegin(kIndices[n]);
+				iterator != hoppingAmplitudeSet.cend(kIndices[n]);
+				++iterator
+			){
+				*irreducibleModel << *iterator;
+			}
+		}
+		irreducibleModel->construct();
+	}
+
+	Timer::tick("Diagonalize");
+	if(propertyExtractor != nullptr){
 		delete propertyExtractor;
-	propertyExtractor = new PropertyExtractor::BlockDiagonalizer(solver);
+		propertyExtractor = nullptr;
+	}
+	if(solver != nullptr)
+		delete solver;
+	solver = new Solver::BlockDiagonalizer();
+	if(useIrreducibleBrillouinZone)
+		solver->setModel(*irreducibleModel);
+	else
+		solver->setModel(*model);
+	solver->run();
+	Timer::tock();
 
 	if(energies != nullptr)
 		delete [] energies;
@@ -109,12 +246,61 @@ void MomentumSpaceContext::init(){
 		delete [] amplitudes;
 	amplitudes = new complex<double>[model->getBasisSize()*numOrbitals];
 
+	//Copy the eigenvalues and eigenvectors of the irreducible mesh points
+	//block by block from the solver. The orbitals are the last subindex
+	//and therefore have the same order within a block as in 'energies'
+	//and 'amplitudes'.
+	const HoppingAmplitudeSet &hoppingAmplitudeSet
+		= solver->getModel().getHoppingAmplitudeSet();
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp parallel for
+#endif
+	for(unsigned int n = 0; n < irreducibleMesh.getNumPoints(); n++){
+		unsigned int meshPoint = irreducibleMesh.getPoint(n);
+		unsigned int firstState
+			= hoppingAmplitudeSet.getFirstIndexInBlock(kIndices[n]);
+		TBTKAssert(
+			solver->getNumStatesInBlock(firstState) == numOrbitals,
+			"MomentumSpaceContext::init()",
+			"The block with block Index " << kIndices[n].toString()
+			<< " has " << solver->getNumStatesInBlock(firstState)
+			<< " states, but the number of orbitals is "
+			<< numOrbitals << ".",
+			"Make sure the number of orbitals set using"
+			<< " MomentumSpaceContext::setNumOrbitals() agrees with"
+			<< " the Model."
+		);
+
+		const double *blockEnergies
+			= solver->getEigenValuesInBlock(firstState);
+		for(
+			unsigned int orbital = 0;
+			orbital < numOrbitals;
+			orbital++
+		){
+			energies[meshPoint*numOrbitals + orbital]
+				= blockEnergies[orbital];
+		}
+
+		const complex<double> *blockAmplitudes
+			= solver->getEigenVectorsInBlock(firstState);
+		complex<double> *meshPointAmplitudes
+			= &amplitudes[meshPoint*numOrbitals*numOrbitals];
+		for(unsigned int c = 0; c < numOrbitals*numOrbitals; c++)
+			meshPointAmplitudes[c] = blockAmplitudes[c];
+	}
+
+	//Unfold the eigenvalues and eigenvectors to the remaining mesh
+	//points.
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp parallel for
+#endif
 	for(unsigned int meshPoint = 0; meshPoint < mesh.size(); meshPoint++){
-		vector<double> k = mesh.at(meshPoint);
-		Index kIndex = brillouinZone->getMinorCellIndex(
-			k,
-			numMeshPoints
+		unsigned int irreduciblePoint = irreducibleMesh.getPoint(
+			irreducibleMesh.getIrreduciblePoint(meshPoint)
 		);
+		if(irreduciblePoint == meshPoint)
+			continue;
 
 		for(
 			unsigned int orbital = 0;
@@ -122,32 +308,298 @@ void MomentumSpaceContext::init(){
 			orbital++
 		){
 			energies[meshPoint*numOrbitals + orbital]
-				= propertyExtractor->getEigenValue(
-					kIndex,
-					orbital
-				);
+				= energies[irreduciblePoint*numOrbitals + orbital];
+		}
+
+		const complex<double> *irreducibleAmplitudes
+			= &amplitudes[irreduciblePoint*numOrbitals*numOrbitals];
+		complex<double> *meshPointAmplitudes
+			= &amplitudes[meshPoint*numOrbitals*numOrbitals];
+		if(orbitalRepresentations.size() == 0){
+			for(unsigned int n = 0; n < numOrbitals*numOrbitals; n++)
+				meshPointAmplitudes[n] = irreducibleAmplitudes[n];
+
+			continue;
 		}
 
+		const Matrix<complex<double>> &U = orbitalRepresentations[
+			irreducibleMesh.getSymmetryOperation(meshPoint)
+		];
 		for(unsigned int state = 0; state < numOrbitals; state++){
 			for(
-				unsigned int orbital1 = 0;
-				orbital1 < numOrbitals;
-				orbital1++
+				unsigned int orbital0 = 0;
+				orbital0 < numOrbitals;
+				orbital0++
 			){
-				amplitudes[
-					meshPoint*numOrbitals*numOrbitals
-					+ state*numOrbitals
-					+ orbital1
-				] = propertyExtractor->getAmplitude(
-					kIndex,
-					state,
-					{(int)orbital1}
-				);
+				complex<double> amplitude = 0.;
+				for(
+					unsigned int orbital1 = 0;
+					orbital1 < numOrbitals;
+					orbital1++
+				){
+					amplitude += U.at(orbital0, orbital1)
+						*irreducibleAmplitudes[
+							state*numOrbitals + orbital1
+						];
+				}
+				meshPointAmplitudes[state*numOrbitals + orbital0]
+					= amplitude;
 			}
 		}
 	}
 
+	if(keepSolver){
+		propertyExtractor
+			= new PropertyExtractor::BlockDiagonalizer(*solver);
+	}
+	else{
+		delete solver;
+		solver = nullptr;
+	}
+
 	isInitialized = true;
 }
 
+const int* MomentumSpaceContext::getKPlusMinusQLookupTable(
+	int sign
+) const{
+	TBTKAssert(
+		sign == 1 || sign == -1,
+		"MomentumSpaceContext::getKPlusMinusQLookupTable()",
+		"'sign' must be 1 or -1, but '" << sign << "' was given.",
+		"This should never happen, contact the developer."
+	);
+	TBTKAssert(
+		model != nullptr,
+		"MomentumSpaceContext::getKPlusMinusQLookupTable()",
+		"Model not set.",
+		"Use MomentumSpaceContext::setModel() to set the Model."
+	);
+	TBTKAssert(
+		brillouinZone != nullptr,
+		"MomentumSpaceContext::getKPlusMinusQLookupTable()",
+		"BrillouinZone not set.",
+		"Use MomentumSpaceContext::setBrillouinZone() to set the"
+		<< " BrillouinZone."
+	);
+	TBTKAssert(
+		numOrbitals != 0,
+		"MomentumSpaceContext::getKPlusMinusQLookupTable()",
+		"The number of orbitals must be larger than 0.",
+		"Use MomentumSpaceContext::setNumOrbitals() to set the"
+		<< " number of orbitals."
+	);
+
+	//The pointer is only read and written inside the critical section,
+	//since it is not safe to read it while another thread generates the
+	//lookup table.
+	const int *result;
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp critical (TBTK_MOMENTUM_SPACE_CONTEXT)
+#endif
+	{
+		const int *&lookupTable = (sign == 1)
+			? kPlusQLookupTable
+			: kMinusQLookupTable;
+		MemoryMappedFile *&lookupTableFile = (sign == 1)
+			? kPlusQLookupTableFile
+			: kMinusQLookupTableFile;
+
+		if(lookupTable == nullptr){
+			if(sign == 1)
+				Timer::tick("Calculate k+q lookup table.");
+			else
+				Timer::tick("Calculate k-q lookup table.");
+
+			const HoppingAmplitudeSet &hoppingAmplitudeSet
+				= model->getHoppingAmplitudeSet();
+			unsigned int numMeshPoints = mesh.size();
+			size_t tableSize
+				= sizeof(int)*numMeshPoints*numMeshPoints;
+
+			LookupTableCacheHeader header;
+			memset(&header, 0, sizeof(header));
+			memcpy(
+				header.magic,
+				LookupTableCacheHeader::MAGIC,
+				sizeof(header.magic)
+			);
+			header.version = LookupTableCacheHeader::VERSION;
+			header.sign = sign;
+			header.key = getLookupTableCacheKey(sign);
+			header.numMeshPoints = numMeshPoints;
+
+			stringstream ss;
+			ss << ((sign == 1)
+				? "cache/kPlusQLookupTable_"
+				: "cache/kMinusQLookupTable_"
+			) << hex << setw(16) << setfill('0') << header.key
+			<< ".bin";
+			string cacheName = ss.str();
+
+			//Map the table from the cache if a valid cache file
+			//exists.
+			if(ifstream(cacheName)){
+				MemoryMappedFile *file = new MemoryMappedFile(
+					cacheName,
+					MemoryMappedFile::Mode::ReadOnly
+				);
+				if(
+					file->getSize()
+						== sizeof(header) + tableSize
+					&& memcmp(
+						file->getData(),
+						&header,
+						sizeof(header)
+					) == 0
+				){
+					lookupTableFile = file;
+					lookupTable = (const int*)(
+						file->getData() + sizeof(header)
+					);
+				}
+				else{
+					delete file;
+				}
+			}
+
+			if(lookupTable == nullptr){
+				int *table = new int[numMeshPoints*numMeshPoints];
+
+				//The block of each mesh point is only looked up
+				//once, rather than once for every k.
+				vector<unsigned int> qBlocks(numMeshPoints);
+				for(unsigned int q = 0; q < numMeshPoints; q++){
+					qBlocks[q] = hoppingAmplitudeSet.getFirstIndexInBlock(
+						brillouinZone->getMinorCellIndex(
+							mesh[q],
+							this->numMeshPoints
+						)
+					)/numOrbitals;
+				}
+
+#ifdef TBTK_USE_OPEN_MP
+				#pragma omp parallel for
+#endif
+				for(unsigned int k = 0; k < numMeshPoints; k++){
+					const vector<double> &K = mesh[k];
+					vector<double> kPlusMinusQ(K.size());
+					for(
+						unsigned int q = 0;
+						q < numMeshPoints;
+						q++
+					){
+						const vector<double> &Q = mesh[q];
+						for(unsigned int n = 0; n < K.size(); n++)
+							kPlusMinusQ[n] = K[n] + sign*Q[n];
+
+						Index kPlusMinusQIndex
+							= brillouinZone->getMinorCellIndex(
+								kPlusMinusQ,
+								this->numMeshPoints
+							);
+						table[
+							k*numMeshPoints + qBlocks[q]
+						] = hoppingAmplitudeSet.getFirstIndexInBlock(
+							kPlusMinusQIndex
+						);
+					}
+				}
+
+				//Write the table to a temporary file that is
+				//renamed once it is complete, such that other
+				//processes never see a partially written file.
+				//The cache is skipped if the cache directory
+				//does not exist.
+				string temporaryName = cacheName + ".tmp"
+					+ to_string(getpid());
+				ofstream fout(temporaryName, ios::binary);
+				if(fout){
+					fout.write((const char*)&header, sizeof(header));
+					fout.write((const char*)table, tableSize);
+					fout.close();
+					if(
+						!fout
+						|| rename(
+							temporaryName.c_str(),
+							cacheName.c_str()
+						) != 0
+					){
+						remove(temporaryName.c_str());
+					}
+				}
+
+				lookupTable = table;
+			}
+
+			Timer::tock();
+		}
+
+		result = lookupTable;
+	}
+
+	return result;
+}
+
+void MomentumSpaceContext::assertLookupTablesNotGenerated(
+	const string &functionName
+) const{
+	bool isGenerated;
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp critical (TBTK_MOMENTUM_SPACE_CONTEXT)
+#endif
+	isGenerated = (
+		kPlusQLookupTable != nullptr
+		|| kMinusQLookupTable != nullptr
+	);
+
+	TBTKAssert(
+		!isGenerated,
+		functionName,
+		"Unable to change the parameters of the MomentumSpaceContext"
+		<< " once the k+q or k-q lookup tables have been generated.",
+		"The lookup tables are shared by the solvers that use the"
+		<< " MomentumSpaceContext. Create a new MomentumSpaceContext"
+		<< " instead."
+	);
+}
+
+unsigned long long MomentumSpaceContext::getLookupTableCacheKey(
+	int sign
+) const{
+	//FNV-1a hash of everything that the lookup table depends on.
+	unsigned long long key = 14695981039346656037ull;
+	auto hash = [&key](const void *data, size_t size){
+		for(size_t n = 0; n < size; n++){
+			key ^= ((const unsigned char*)data)[n];
+			key *= 1099511628211ull;
+		}
+	};
+
+	hash(&sign, sizeof(sign));
+
+	const vector<Vector3d> &basisVectors
+		= brillouinZone->getBasisVectors();
+	unsigned int numDimensions = brillouinZone->getNumDimensions();
+	hash(&numDimensions, sizeof(numDimensions));
+	for(unsigned int n = 0; n < basisVectors.size(); n++){
+		double components[3] = {
+			basisVectors[n].x,
+			basisVectors[n].y,
+			basisVectors[n].z
+		};
+		hash(components, sizeof(components));
+	}
+
+	int meshType = static_cast<int>(brillouinZone->getMeshType());
+	hash(&meshType, sizeof(meshType));
+
+	for(unsigned int n = 0; n < numMeshPoints.size(); n++)
+		hash(&numMeshPoints[n], sizeof(numMeshPoints[n]));
+
+	hash(&numOrbitals, sizeof(numOrbitals));
+
+	return key;
+}
+
 }	//End of namesapce TBTK
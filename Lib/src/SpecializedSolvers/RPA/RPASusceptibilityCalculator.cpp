@@ -63,11 +63,19 @@ RPASusceptibilityCalculator::RPASusceptibilityCalculator(
 	);
 
 	interactionAmplitudesAreGenerated = false;
+
+	rpaSusceptibilityCache = new SusceptibilityCache();
+	rpaChargeSusceptibilityCache = new SusceptibilityCache();
+	rpaSpinSusceptibilityCache = new SusceptibilityCache();
+
+	isMaster = true;
 }
 
 RPASusceptibilityCalculator::RPASusceptibilityCalculator(
-	SusceptibilityCalculator &susceptibilityCalculator
-//	LindhardSusceptibilityCalculator &lindhardSusceptibilityCalculator
+	SusceptibilityCalculator &susceptibilityCalculator,
+	SusceptibilityCache *rpaSusceptibilityCache,
+	SusceptibilityCache *rpaChargeSusceptibilityCache,
+	SusceptibilityCache *rpaSpinSusceptibilityCache
 ){
 	this->susceptibilityCalculator = susceptibilityCalculator.createSlave();
 
@@ -77,16 +85,31 @@ RPASusceptibilityCalculator::RPASusceptibilityCalculator(
 	Jp = 0.;
 
 	interactionAmplitudesAreGenerated = false;
+
+	this->rpaSusceptibilityCache = rpaSusceptibilityCache;
+	this->rpaChargeSusceptibilityCache = rpaChargeSusceptibilityCache;
+	this->rpaSpinSusceptibilityCache = rpaSpinSusceptibilityCache;
+
+	isMaster = false;
 }
 
 RPASusceptibilityCalculator::~RPASusceptibilityCalculator(){
 	if(susceptibilityCalculator != nullptr)
 		delete susceptibilityCalculator;
+
+	if(isMaster){
+		delete rpaSusceptibilityCache;
+		delete rpaChargeSusceptibilityCache;
+		delete rpaSpinSusceptibilityCache;
+	}
 }
 
 RPASusceptibilityCalculator* RPASusceptibilityCalculator::createSlave(){
 	return new RPASusceptibilityCalculator(
-		*susceptibilityCalculator
+		*susceptibilityCalculator,
+		rpaSusceptibilityCache,
+		rpaChargeSusceptibilityCache,
+		rpaSpinSusceptibilityCache
 	);
 }
 
@@ -311,7 +334,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateRPASusceptibility(
 
 	//Try to return cashed result
 	SerializableVector<complex<double>> result;
-	if(rpaSusceptibilityTree.get(result, resultIndex))
+	if(rpaSusceptibilityCache->get(result, resultIndex))
 		return result;
 
 	//Calculate RPA-susceptibility
@@ -336,7 +359,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateRPASusceptibility(
 					(int)orbital1
 				}
 			);
-			rpaSusceptibilityTree.add(
+			rpaSusceptibilityCache->add(
 				rpaSusceptibility[orbital0][orbital1],
 				resultIndex
 			);
@@ -458,7 +481,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateChargeRPASusceptib
 
 	//Try to return cashed result
 	SerializableVector<complex<double>> result;
-	if(rpaChargeSusceptibilityTree.get(result, resultIndex))
+	if(rpaChargeSusceptibilityCache->get(result, resultIndex))
 		return result;
 
 	const MomentumSpaceContext &momentumSpaceContext
@@ -487,7 +510,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateChargeRPASusceptib
 					(int)orbital1
 				}
 			);
-			rpaChargeSusceptibilityTree.add(
+			rpaChargeSusceptibilityCache->add(
 				rpaSusceptibility[orbital0][orbital1],
 				resultIndex
 			);
@@ -522,7 +545,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateChargeRPASusceptib
 					numMeshPoints
 				);
 
-				rpaChargeSusceptibilityTree.add(
+				rpaChargeSusceptibilityCache->add(
 					conjugatedResult,
 					Index(
 						kMinusIndex,
@@ -563,7 +586,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateSpinRPASusceptibil
 
 	//Try to return cached result
 	SerializableVector<complex<double>> result;
-	if(rpaSpinSusceptibilityTree.get(result, resultIndex))
+	if(rpaSpinSusceptibilityCache->get(result, resultIndex))
 		return result;
 
 	const MomentumSpaceContext &momentumSpaceContext
@@ -592,7 +615,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateSpinRPASusceptibil
 					(int)orbital1
 				}
 			);
-			rpaSpinSusceptibilityTree.add(
+			rpaSpinSusceptibilityCache->add(
 				rpaSusceptibility[orbital0][orbital1],
 				resultIndex
 			);
@@ -627,7 +650,7 @@ vector<complex<double>> RPASusceptibilityCalculator::calculateSpinRPASusceptibil
 					numMeshPoints
 				);
 
-				rpaSpinSusceptibilityTree.add(
+				rpaSpinSusceptibilityCache->add(
 					conjugatedResult,
 					Index(
 						kMinusIndex,
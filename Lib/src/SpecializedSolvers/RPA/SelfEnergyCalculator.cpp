@@ -63,8 +63,6 @@ SelfEnergyCalculator::SelfEnergyCalculator(
 }
 
 SelfEnergyCalculator::~SelfEnergyCalculator(){
-	if(kMinusQLookupTable != nullptr)
-		delete [] kMinusQLookupTable;
 }
 
 void SelfEnergyCalculator::init(){
@@ -76,11 +74,6 @@ void SelfEnergyCalculator::init(){
 		<< " the number of summation energies."
 	);
 
-	if(kMinusQLookupTable != nullptr){
-		delete [] kMinusQLookupTable;
-		kMinusQLookupTable = nullptr;
-	}
-
 	//Calculate kT
 	double temperature = UnitHandler::convertTemperatureNtB(
 		electronFluctuationVertexCalculators[0]->getMomentumSpaceContext(
@@ -115,92 +108,8 @@ void SelfEnergyCalculator::generateKMinusQLookupTable(){
 	if(kMinusQLookupTable != nullptr)
 		return;
 
-	Timer::tick("Calculate k-q lookup table.");
-	const MomentumSpaceContext &momentumSpaceContext = electronFluctuationVertexCalculators[0]->getMomentumSpaceContext();
-	const vector<vector<double>> &mesh = momentumSpaceContext.getMesh();
-	const vector<unsigned int> &numMeshPoints = momentumSpaceContext.getNumMeshPoints();
-	const BrillouinZone &brillouinZone = momentumSpaceContext.getBrillouinZone();
-	const Model &model = momentumSpaceContext.getModel();
-	unsigned int numOrbitals = momentumSpaceContext.getNumOrbitals();
-
-	kMinusQLookupTable = new int[mesh.size()*mesh.size()];
-
-	string cacheName = "cache/kMinusQLookupTable";
-	for(
-		unsigned int n = 0;
-		n < numMeshPoints.size();
-		n++
-	){
-		cacheName += "_" + to_string(numMeshPoints.at(n));
-	}
-	ifstream fin(cacheName);
-	if(fin){
-		unsigned int counter = 0;
-		int value;
-		while(fin >> value){
-			TBTKAssert(
-				counter < mesh.size()*mesh.size(),
-				"SelfEnergyCalculator::generateKMinusQLookupTable()",
-				"Found cache file '" << cacheName << "',"
-				<< " but the cache is too large.",
-				"Clear the cache to recalculate"
-				<< " kMinusQLookupTable."
-			);
-			kMinusQLookupTable[counter] = value;
-			counter++;
-		}
-		fin.close();
-
-		TBTKAssert(
-			counter == mesh.size()*mesh.size(),
-			"SelfEnergyCalculator::generateKMinusQLookupTable()",
-			"Found cache file '" << cacheName << "',"
-			<< " but the cache is too small.",
-			"Clear the cache to recalculate kMinusQLookupTable."
-		);
-
-		Timer::tock();
-
-		return;
-	}
-
-#ifdef TBTK_USE_OPEN_MP
-	#pragma omp parallel for
-#endif
-	for(unsigned int k = 0; k < mesh.size(); k++){
-		const vector<double> &K = mesh.at(k);
-		for(unsigned int q = 0; q < mesh.size(); q++){
-			const vector<double> &Q = mesh.at(q);
-
-			vector<double> kMinusQ;
-			for(unsigned int n = 0; n < K.size(); n++)
-				kMinusQ.push_back(K.at(n) - Q.at(n));
-
-			Index qIndex = brillouinZone.getMinorCellIndex(
-				Q,
-				numMeshPoints
-			);
-			int qLinearIndex = model.getHoppingAmplitudeSet().getFirstIndexInBlock(
-				qIndex
-			);
-			Index kMinusQIndex = brillouinZone.getMinorCellIndex(
-				kMinusQ,
-				numMeshPoints
-			);
-			kMinusQLookupTable[
-				k*mesh.size() + qLinearIndex/numOrbitals
-			] = model.getHoppingAmplitudeSet().getFirstIndexInBlock(
-				kMinusQIndex
-			);
-		}
-	}
-
-	ofstream fout(cacheName);
-	if(fout)
-		for(unsigned int n = 0; n < mesh.size()*mesh.size(); n++)
-			fout << kMinusQLookupTable[n] << "\n";
-
-	Timer::tock();
+	kMinusQLookupTable = electronFluctuationVertexCalculators[0]->getMomentumSpaceContext(
+	).getKMinusQLookupTable();
 }
 
 template<>
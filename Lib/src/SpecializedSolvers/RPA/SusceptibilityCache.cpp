@@ -0,0 +1,494 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file SusceptibilityCache.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/RPA/SusceptibilityCache.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <map>
+
+#include <unistd.h>
+
+#ifdef TBTK_USE_OPEN_MP
+#	include <omp.h>
+#endif
+
+using namespace std;
+
+namespace TBTK{
+
+class SusceptibilityCache::Shard{
+public:
+	/** Entry kept in memory. */
+	class Entry{
+	public:
+		/** The Index of the entry. */
+		Index index;
+
+		/** The data. */
+		vector<complex<double>> data;
+
+		/** Get the memory used by the entry. */
+		size_t getSizeInBytes() const;
+	};
+
+	/** Entries kept in memory, ordered from the most to the least
+	 *  recently used. */
+	list<Entry> entries;
+
+	/** Map from Indices to the entries kept in memory. */
+	map<Index, list<Entry>::iterator> entryMap;
+
+	/** Entry stored in the spill file. */
+	class SpilledEntry{
+	public:
+		/** Position of the entry in the spill file. */
+		streamoff position;
+
+		/** Number of elements that the slot in the spill file has
+		 *  room for. */
+		unsigned int size;
+
+		/** Flag indicating whether the spill file contains the
+		 *  same data as the entry that is kept in memory. Always
+		 *  true for entries that are not kept in memory. */
+		bool isUpToDate;
+	};
+
+	/** Map from Indices to the entries in the spill file. An entry that
+	 *  has been read back into memory remains in the spill file, which
+	 *  allows it to be evicted again without being rewritten. */
+	map<Index, SpilledEntry> spilledEntries;
+
+	/** Slots in the spill file that no longer hold any entry, keyed by
+	 *  the number of elements they have room for. */
+	multimap<unsigned int, streamoff> freeSlots;
+
+	/** Spill file. Opened the first time an entry is spilled. */
+	fstream spillFile;
+
+	/** Name of the spill file. */
+	string spillFileName;
+
+	/** Memory used by the entries kept in memory. */
+	size_t sizeInBytes;
+
+#ifdef TBTK_USE_OPEN_MP
+	/** Lock protecting the shard. */
+	omp_lock_t lock;
+#endif
+
+	/** Add an entry as the most recently used entry. */
+	Entry& addFront(const Index &index);
+
+	/** Move an entry to the front of the list of entries. */
+	void touch(list<Entry>::iterator entry);
+};
+
+inline size_t SusceptibilityCache::Shard::Entry::getSizeInBytes() const{
+	return sizeof(Entry)
+		+ index.getSize()*sizeof(int)
+		+ data.size()*sizeof(complex<double>);
+}
+
+inline SusceptibilityCache::Shard::Entry& SusceptibilityCache::Shard::addFront(
+	const Index &index
+){
+	entries.push_front(Entry());
+	entries.front().index = index;
+	entryMap[index] = entries.begin();
+
+	return entries.front();
+}
+
+inline void SusceptibilityCache::Shard::touch(list<Entry>::iterator entry){
+	entries.splice(entries.begin(), entries, entry);
+}
+
+SusceptibilityCache::SusceptibilityCache(unsigned int numShards){
+	TBTKAssert(
+		numShards > 0,
+		"SusceptibilityCache::SusceptibilityCache()",
+		"'numShards' must be larger than zero.",
+		""
+	);
+
+	this->numShards = numShards;
+	shards = new Shard[numShards];
+	for(unsigned int n = 0; n < numShards; n++){
+		shards[n].sizeInBytes = 0;
+#ifdef TBTK_USE_OPEN_MP
+		omp_init_lock(&shards[n].lock);
+#endif
+	}
+
+	maxSizeInBytes = 0;
+
+	static unsigned int counter = 0;
+#ifdef TBTK_USE_OPEN_MP
+	#pragma omp critical (TBTK_SUSCEPTIBILITY_CACHE)
+#endif
+	id = counter++;
+}
+
+SusceptibilityCache::~SusceptibilityCache(){
+	for(unsigned int n = 0; n < numShards; n++){
+		clear(shards[n]);
+#ifdef TBTK_USE_OPEN_MP
+		omp_destroy_lock(&shards[n].lock);
+#endif
+	}
+	delete [] shards;
+}
+
+void SusceptibilityCache::add(
+	const vector<complex<double>> &data,
+	const Index &index
+){
+	Shard &shard = getShard(index);
+	lock(shard);
+
+	//Any previously spilled version of the entry is out of date, but its
+	//slot in the spill file is kept for reuse.
+	map<Index, Shard::SpilledEntry>::iterator spilledIterator
+		= shard.spilledEntries.find(index);
+	if(spilledIterator != shard.spilledEntries.end())
+		spilledIterator->second.isUpToDate = false;
+
+	map<Index, list<Shard::Entry>::iterator>::iterator iterator
+		= shard.entryMap.find(index);
+	if(iterator == shard.entryMap.end()){
+		Shard::Entry &entry = shard.addFront(index);
+		entry.data = data;
+		shard.sizeInBytes += entry.getSizeInBytes();
+	}
+	else{
+		Shard::Entry &entry = *iterator->second;
+		shard.sizeInBytes -= entry.getSizeInBytes();
+		entry.data = data;
+		shard.sizeInBytes += entry.getSizeInBytes();
+		shard.touch(iterator->second);
+	}
+
+	evict(shard);
+
+	unlock(shard);
+}
+
+void SusceptibilityCache::add(
+	const IndexedDataTree<SerializableVector<complex<double>>> &indexedDataTree
+){
+	for(
+		IndexedDataTree<
+			SerializableVector<complex<double>>
+		>::ConstIterator iterator = indexedDataTree.cbegin();
+		iterator != indexedDataTree.cend();
+		++iterator
+	){
+		add(*iterator, iterator.getCurrentIndex());
+	}
+}
+
+bool SusceptibilityCache::get(
+	vector<complex<double>> &data,
+	const Index &index
+){
+	Shard &shard = getShard(index);
+	lock(shard);
+
+	map<Index, list<Shard::Entry>::iterator>::iterator iterator
+		= shard.entryMap.find(index);
+	if(iterator != shard.entryMap.end()){
+		data = iterator->second->data;
+		shard.touch(iterator->second);
+		unlock(shard);
+
+		return true;
+	}
+
+	map<Index, Shard::SpilledEntry>::iterator spilledIterator
+		= shard.spilledEntries.find(index);
+	if(spilledIterator != shard.spilledEntries.end()){
+		Shard::Entry &entry = shard.addFront(index);
+		readSpilled(
+			shard,
+			spilledIterator->second.position,
+			entry.data
+		);
+		shard.sizeInBytes += entry.getSizeInBytes();
+		data = entry.data;
+
+		evict(shard);
+		unlock(shard);
+
+		return true;
+	}
+
+	unlock(shard);
+
+	return false;
+}
+
+void SusceptibilityCache::clear(){
+	for(unsigned int n = 0; n < numShards; n++){
+		lock(shards[n]);
+		clear(shards[n]);
+		unlock(shards[n]);
+	}
+}
+
+void SusceptibilityCache::setMaxSizeInBytes(size_t maxSizeInBytes){
+	this->maxSizeInBytes = maxSizeInBytes;
+	for(unsigned int n = 0; n < numShards; n++){
+		lock(shards[n]);
+		evict(shards[n]);
+		unlock(shards[n]);
+	}
+}
+
+size_t SusceptibilityCache::getSizeInBytes() const{
+	size_t sizeInBytes = 0;
+	for(unsigned int n = 0; n < numShards; n++){
+		lock(shards[n]);
+		sizeInBytes += shards[n].sizeInBytes;
+		unlock(shards[n]);
+	}
+
+	return sizeInBytes;
+}
+
+void SusceptibilityCache::setSpillDirectory(const string &spillDirectory){
+	for(unsigned int n = 0; n < numShards; n++){
+		lock(shards[n]);
+		bool isEmpty = shards[n].entries.empty()
+			&& shards[n].spilledEntries.empty();
+		unlock(shards[n]);
+
+		TBTKAssert(
+			isEmpty,
+			"SusceptibilityCache::setSpillDirectory()",
+			"The spill directory can only be set when the cache is"
+			<< " empty.",
+			"Set the spill directory before adding any entries, or"
+			<< " call SusceptibilityCache::clear() first."
+		);
+	}
+
+	this->spillDirectory = spillDirectory;
+}
+
+IndexedDataTree<
+	SerializableVector<complex<double>>
+> SusceptibilityCache::getIndexedDataTree(){
+	IndexedDataTree<SerializableVector<complex<double>>> indexedDataTree;
+	for(unsigned int n = 0; n < numShards; n++){
+		Shard &shard = shards[n];
+		lock(shard);
+		for(
+			map<Index, Shard::SpilledEntry>::iterator iterator
+				= shard.spilledEntries.begin();
+			iterator != shard.spilledEntries.end();
+			++iterator
+		){
+			if(shard.entryMap.count(iterator->first) != 0)
+				continue;
+
+			SerializableVector<complex<double>> data;
+			readSpilled(shard, iterator->second.position, data);
+			indexedDataTree.add(data, iterator->first);
+		}
+		for(
+			list<Shard::Entry>::iterator iterator
+				= shard.entries.begin();
+			iterator != shard.entries.end();
+			++iterator
+		){
+			SerializableVector<complex<double>> data;
+			data.assign(iterator->data.begin(), iterator->data.end());
+			indexedDataTree.add(data, iterator->index);
+		}
+		unlock(shard);
+	}
+
+	return indexedDataTree;
+}
+
+SusceptibilityCache::Shard& SusceptibilityCache::getShard(const Index &index){
+	//FNV-1a hash of the subindices.
+	unsigned int hash = 2166136261u;
+	for(unsigned int n = 0; n < index.getSize(); n++){
+		hash ^= (unsigned int)index[n];
+		hash *= 16777619u;
+	}
+
+	return shards[hash%numShards];
+}
+
+void SusceptibilityCache::lock(Shard &shard){
+#ifdef TBTK_USE_OPEN_MP
+	omp_set_lock(&shard.lock);
+#endif
+}
+
+void SusceptibilityCache::unlock(Shard &shard){
+#ifdef TBTK_USE_OPEN_MP
+	omp_unset_lock(&shard.lock);
+#endif
+}
+
+void SusceptibilityCache::evict(Shard &shard){
+	if(maxSizeInBytes == 0)
+		return;
+
+	size_t maxShardSizeInBytes = maxSizeInBytes/numShards;
+	while(
+		shard.sizeInBytes > maxShardSizeInBytes
+		&& shard.entries.size() > 1
+	){
+		Shard::Entry &entry = shard.entries.back();
+		if(spillDirectory.compare("") != 0){
+			map<Index, Shard::SpilledEntry>::iterator iterator
+				= shard.spilledEntries.find(entry.index);
+			if(
+				iterator == shard.spilledEntries.end()
+				|| !iterator->second.isUpToDate
+			){
+				spillLast(shard);
+			}
+		}
+
+		shard.sizeInBytes -= entry.getSizeInBytes();
+		shard.entryMap.erase(entry.index);
+		shard.entries.pop_back();
+	}
+}
+
+void SusceptibilityCache::spillLast(Shard &shard){
+	const Shard::Entry &entry = shard.entries.back();
+	if(!shard.spillFile.is_open()){
+		shard.spillFileName = spillDirectory + "/SusceptibilityCache_"
+			+ to_string(getpid()) + "_" + to_string(id) + "_"
+			+ to_string(&shard - shards) + ".bin";
+		shard.spillFile.open(
+			shard.spillFileName,
+			ios::in | ios::out | ios::binary | ios::trunc
+		);
+		TBTKAssert(
+			shard.spillFile.is_open(),
+			"SusceptibilityCache::spill()",
+			"Unable to open spill file '" << shard.spillFileName
+			<< "'.",
+			"Make sure that the spill directory exists and is"
+			<< " writable."
+		);
+	}
+
+	//Reuse the slot of an out of date version of the entry, or any free
+	//slot, if it has room for exactly the same number of elements.
+	//Otherwise the entry is appended to the end of the file.
+	unsigned int size = entry.data.size();
+	streamoff position = -1;
+	map<Index, Shard::SpilledEntry>::iterator iterator
+		= shard.spilledEntries.find(entry.index);
+	if(iterator != shard.spilledEntries.end()){
+		if(iterator->second.size == size){
+			position = iterator->second.position;
+		}
+		else{
+			shard.freeSlots.insert(
+				make_pair(
+					iterator->second.size,
+					iterator->second.position
+				)
+			);
+		}
+	}
+	if(position == -1){
+		multimap<unsigned int, streamoff>::iterator freeSlot
+			= shard.freeSlots.find(size);
+		if(freeSlot != shard.freeSlots.end()){
+			position = freeSlot->second;
+			shard.freeSlots.erase(freeSlot);
+		}
+		else{
+			shard.spillFile.seekp(0, ios::end);
+			position = shard.spillFile.tellp();
+		}
+	}
+
+	shard.spillFile.seekp(position);
+	shard.spillFile.write((const char*)&size, sizeof(size));
+	shard.spillFile.write(
+		(const char*)entry.data.data(),
+		size*sizeof(complex<double>)
+	);
+	//Flush to detect write errors here rather than at a later read.
+	shard.spillFile.flush();
+	TBTKAssert(
+		shard.spillFile,
+		"SusceptibilityCache::spill()",
+		"Unable to write to spill file '" << shard.spillFileName
+		<< "'.",
+		""
+	);
+
+	Shard::SpilledEntry &spilledEntry = shard.spilledEntries[entry.index];
+	spilledEntry.position = position;
+	spilledEntry.size = size;
+	spilledEntry.isUpToDate = true;
+}
+
+void SusceptibilityCache::readSpilled(
+	Shard &shard,
+	streamoff position,
+	vector<complex<double>> &data
+){
+	shard.spillFile.seekg(position);
+	unsigned int size;
+	shard.spillFile.read((char*)&size, sizeof(size));
+	data.resize(size);
+	shard.spillFile.read(
+		(char*)data.data(),
+		size*sizeof(complex<double>)
+	);
+	TBTKAssert(
+		shard.spillFile,
+		"SusceptibilityCache::readSpilled()",
+		"Unable to read from spill file '" << shard.spillFileName
+		<< "'.",
+		""
+	);
+}
+
+void SusceptibilityCache::clear(Shard &shard){
+	shard.entries.clear();
+	shard.entryMap.clear();
+	shard.spilledEntries.clear();
+	shard.freeSlots.clear();
+	shard.sizeInBytes = 0;
+	if(shard.spillFile.is_open()){
+		shard.spillFile.close();
+		remove(shard.spillFileName.c_str());
+	}
+}
+
+};	//End of namespace TBTK
@@ -61,7 +61,7 @@ void BasicState::addOverlap(
 	const Index &braIndex,
 	const Index &braRelativeUnitCell
 ){
-	storage->overlapsIsSorted = false;
+	storage->overlapsIsSorted.store(false, memory_order_relaxed);
 	storage->overlaps.push_back(make_tuple(overlap, braIndex, braRelativeUnitCell));
 }
 
@@ -70,7 +70,7 @@ void BasicState::addMatrixElement(
 	const Index &braIndex,
 	const Index &braRelativeUnitCell
 ){
-	storage->matrixElementsIsSorted = false;
+	storage->matrixElementsIsSorted.store(false, memory_order_relaxed);
 	storage->matrixElements.push_back(make_tuple(matrixElement, braIndex, braRelativeUnitCell));
 }
 
@@ -82,8 +82,18 @@ complex<double> BasicState::getOverlap(const AbstractState &bra) const{
 		"The bra state has to be a BasicState."
 	);
 
-	if(!storage->overlapsIsSorted){
-		storage->sortOverlaps();
+	//The Storage can be shared between copies of the state and the
+	//lookup can happen concurrently. Sort under a critical section and
+	//check again inside it, since another thread may have sorted it. The
+	//acquire load pairs with the release store in sortOverlaps(), which
+	//makes the sorted overlaps visible to threads that skip the critical
+	//section.
+	if(!storage->overlapsIsSorted.load(memory_order_acquire)){
+#ifdef TBTK_USE_OPEN_MP
+		#pragma omp critical (TBTK_BASIC_STATE_SORT)
+#endif
+		if(!storage->overlapsIsSorted.load(memory_order_relaxed))
+			storage->sortOverlaps();
 	}
 
 	int min = 0;
@@ -184,8 +194,13 @@ complex<double> BasicState::getMatrixElement(
 		"The bra state has to be a BasicState."
 	);
 
-	if(!storage->matrixElementsIsSorted){
-		storage->sortMatrixElements();
+	//See getOverlap().
+	if(!storage->matrixElementsIsSorted.load(memory_order_acquire)){
+#ifdef TBTK_USE_OPEN_MP
+		#pragma omp critical (TBTK_BASIC_STATE_SORT)
+#endif
+		if(!storage->matrixElementsIsSorted.load(memory_order_relaxed))
+			storage->sortMatrixElements();
 	}
 
 	int min = 0;
@@ -277,8 +292,8 @@ complex<double> BasicState::getMatrixElement(
 
 BasicState::Storage::Storage(){
 	referenceCounter = 1;
-	overlapsIsSorted = true;
-	matrixElementsIsSorted = true;
+	overlapsIsSorted.store(true, memory_order_relaxed);
+	matrixElementsIsSorted.store(true, memory_order_relaxed);
 //	overlapsIndexTree = nullptr;
 //	indexedOverlaps = nullptr;
 //	matrixElementsIndexTree = nullptr;
@@ -311,12 +326,12 @@ public:
 
 void BasicState::Storage::sortOverlaps(){
 	sort(overlaps.begin(), overlaps.end(), SortHelperClass());
-	overlapsIsSorted = true;
+	overlapsIsSorted.store(true, memory_order_release);
 }
 
 void BasicState::Storage::sortMatrixElements(){
 	sort(matrixElements.begin(), matrixElements.end(), SortHelperClass());
-	matrixElementsIsSorted = true;
+	matrixElementsIsSorted.store(true, memory_order_release);
 }
 
 };	//End of namespace TBTK
@@ -0,0 +1,138 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file LinearStateTree.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/LinearStateTree.h"
+
+using namespace std;
+
+namespace TBTK{
+
+LinearStateTree::LinearStateTree(const StateTreeNode &stateTreeNode){
+	dimensions = stateTreeNode.center.size();
+	flatten(stateTreeNode);
+}
+
+LinearStateTree::LinearStateTree(
+	const StateSet &stateSet,
+	int maxDepth,
+	double centerShiftMultiplier
+) :
+	LinearStateTree(
+		StateTreeNode(stateSet, maxDepth, centerShiftMultiplier)
+	)
+{
+}
+
+void LinearStateTree::getOverlappingStates(
+	const vector<double> &coordinates,
+	double extent,
+	vector<const AbstractState*> &overlappingStates
+) const{
+	TBTKAssert(
+		coordinates.size() == dimensions,
+		"LinearStateTree::getOverlappingStates()",
+		"Incompatible dimensions. The LinearStateTree stores states"
+		<< " with dimension '" << dimensions << "', but the argument"
+		<< " 'coordinates' has dimension '" << coordinates.size()
+		<< "'.",
+		""
+	);
+
+	overlappingStates.clear();
+	visitOverlappingStates(
+		coordinates.data(),
+		extent,
+		[&overlappingStates](const AbstractState *state){
+			overlappingStates.push_back(state);
+		}
+	);
+}
+
+vector<vector<const AbstractState*>> LinearStateTree::getOverlappingStates(
+	const vector<AbstractState*> &states
+) const{
+	for(unsigned int n = 0; n < states.size(); n++){
+		TBTKAssert(
+			states[n]->getCoordinates().size() == dimensions,
+			"LinearStateTree::getOverlappingStates()",
+			"Incompatible dimensions. The LinearStateTree stores"
+			<< " states with dimension '" << dimensions << "', but"
+			<< " state " << n << " has dimension '"
+			<< states[n]->getCoordinates().size() << "'.",
+			""
+		);
+	}
+
+	vector<vector<const AbstractState*>> overlappingStates(states.size());
+	#pragma omp parallel for schedule(dynamic, 16)
+	for(unsigned int n = 0; n < states.size(); n++){
+		vector<const AbstractState*> &result = overlappingStates[n];
+		visitOverlappingStates(
+			states[n]->getCoordinates().data(),
+			states[n]->getExtent(),
+			[&result](const AbstractState *state){
+				result.push_back(state);
+			}
+		);
+	}
+
+	return overlappingStates;
+}
+
+bool LinearStateTree::flatten(const StateTreeNode &stateTreeNode){
+	unsigned int position = nodes.size();
+	nodes.push_back(Node());
+	for(unsigned int c = 0; c < dimensions; c++)
+		nodeCenters.push_back(stateTreeNode.center[c]);
+
+	Node &node = nodes.back();
+	node.radius = sqrt(dimensions*pow(stateTreeNode.halfSize, 2));
+	node.firstState = states.size();
+	for(unsigned int n = 0; n < stateTreeNode.states.size(); n++){
+		const AbstractState *state = stateTreeNode.states[n];
+		states.push_back(state);
+		for(unsigned int c = 0; c < dimensions; c++)
+			stateCoordinates.push_back(state->getCoordinates()[c]);
+		stateExtents.push_back(state->getExtent());
+	}
+	node.endState = states.size();
+
+	//The child nodes of a StateTreeNode are ordered such that bit c of
+	//the child number determines the position along dimension c. Adding
+	//the children in order therefore results in a Morton ordering of the
+	//nodes.
+	bool isEmpty = (nodes[position].firstState == nodes[position].endState);
+	for(unsigned int n = 0; n < stateTreeNode.stateTreeNodes.size(); n++)
+		if(flatten(*stateTreeNode.stateTreeNodes[n]))
+			isEmpty = false;
+
+	if(isEmpty && position != 0){
+		nodes.pop_back();
+		nodeCenters.resize(position*dimensions);
+
+		return false;
+	}
+
+	nodes[position].next = nodes.size();
+
+	return !isEmpty;
+}
+
+};	//End of namespace TBTK
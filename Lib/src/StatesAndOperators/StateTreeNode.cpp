@@ -134,6 +134,9 @@ StateTreeNode::StateTreeNode(
 		if(halfSize < (max.at(n) - min.at(n))/2.)
 			halfSize = (max.at(n) - min.at(n))/2.;
 	}
+	//Compensate for the roundoff margin used by addRecursive() to ensure
+	//that the states at the edge of the bounding box fit in the root node.
+	halfSize /= ROUNDOFF_MARGIN_MULTIPLIER;
 
 	this->maxDepth = maxDepth;
 
@@ -19,17 +19,30 @@
  */
 
 #include "TBTK/BrillouinZone.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <cmath>
 
 using namespace std;
 
 namespace TBTK{
 
+BrillouinZone::IrreducibleMesh::IrreducibleMesh(unsigned int numMeshPoints){
+	for(unsigned int n = 0; n < numMeshPoints; n++){
+		points.push_back(n);
+		weights.push_back(1./numMeshPoints);
+		irreduciblePoints.push_back(n);
+		symmetryOperations.push_back(0);
+	}
+}
+
 BrillouinZone::BrillouinZone(
 	initializer_list<initializer_list<double>> basisVectors,
 	MeshType meshType
 ) :
 	WignerSeitzCell(basisVectors, meshType)
 {
+	setIdentity();
 }
 
 BrillouinZone::BrillouinZone(
@@ -38,9 +51,317 @@ BrillouinZone::BrillouinZone(
 ) :
 	WignerSeitzCell(basisVectors, meshType)
 {
+	setIdentity();
 }
 
 BrillouinZone::~BrillouinZone(){
 }
 
+void BrillouinZone::setSymmetryOperations(
+	const vector<Matrix<double>> &symmetryOperations
+){
+	unsigned int dimensions = getNumDimensions();
+	const vector<Vector3d> &basisVectors = getBasisVectors();
+	vector<Vector3d> dualBasisVectors = getDualBasisVectors();
+
+	vector<vector<int>> latticeSymmetryOperations;
+	int identity = -1;
+	for(unsigned int n = 0; n < symmetryOperations.size(); n++){
+		const Matrix<double> &operation = symmetryOperations[n];
+		TBTKAssert(
+			operation.getNumRows() == dimensions
+			&& operation.getNumCols() == dimensions,
+			"BrillouinZone::setSymmetryOperations()",
+			"Incompatible dimensions. The BrillouinZone has"
+			<< " dimension '" << dimensions << "', but symmetry"
+			<< " operation " << n << " is a '"
+			<< operation.getNumRows() << "x"
+			<< operation.getNumCols() << "' matrix.",
+			""
+		);
+
+		//Express the operation in the basis of the basis vectors.
+		//The coefficients have to be integers for the operation to
+		//map the lattice onto itself.
+		vector<int> latticeOperation;
+		bool isIdentity = true;
+		for(unsigned int i = 0; i < dimensions; i++){
+			double b[3] = {
+				basisVectors[i].x,
+				basisVectors[i].y,
+				basisVectors[i].z
+			};
+			double components[3] = {0., 0., 0.};
+			for(unsigned int r = 0; r < dimensions; r++)
+				for(unsigned int c = 0; c < dimensions; c++)
+					components[r] += operation.at(r, c)*b[c];
+			Vector3d image({
+				components[0],
+				components[1],
+				components[2]
+			});
+
+			for(unsigned int j = 0; j < dimensions; j++){
+				double coefficient = Vector3d::dotProduct(
+					image,
+					dualBasisVectors[j]
+				);
+				int roundedCoefficient = round(coefficient);
+				TBTKAssert(
+					abs(coefficient - roundedCoefficient) < 1e-6,
+					"BrillouinZone::setSymmetryOperations()",
+					"Symmetry operation " << n << " does not map"
+					<< " the lattice onto itself.",
+					""
+				);
+				latticeOperation.push_back(roundedCoefficient);
+				if(roundedCoefficient != (i == j ? 1 : 0))
+					isIdentity = false;
+			}
+		}
+		if(isIdentity && identity == -1)
+			identity = n;
+
+		latticeSymmetryOperations.push_back(latticeOperation);
+	}
+
+	TBTKAssert(
+		identity != -1,
+		"BrillouinZone::setSymmetryOperations()",
+		"The identity is not one of the symmetry operations.",
+		""
+	);
+
+	//Store the identity first.
+	this->symmetryOperations.clear();
+	this->latticeSymmetryOperations.clear();
+	this->symmetryOperations.push_back(symmetryOperations[identity]);
+	this->latticeSymmetryOperations.push_back(
+		latticeSymmetryOperations[identity]
+	);
+	for(unsigned int n = 0; n < symmetryOperations.size(); n++){
+		if((int)n == identity)
+			continue;
+
+		this->symmetryOperations.push_back(symmetryOperations[n]);
+		this->latticeSymmetryOperations.push_back(
+			latticeSymmetryOperations[n]
+		);
+	}
+}
+
+void BrillouinZone::detectSymmetryOperations(double tolerance){
+	unsigned int dimensions = getNumDimensions();
+	const vector<Vector3d> &basisVectors = getBasisVectors();
+	vector<Vector3d> dualBasisVectors = getDualBasisVectors();
+
+	//Metric of the lattice.
+	double metric[3][3];
+	double maxMetric = 0.;
+	for(unsigned int i = 0; i < dimensions; i++){
+		for(unsigned int j = 0; j < dimensions; j++){
+			metric[i][j] = Vector3d::dotProduct(
+				basisVectors[i],
+				basisVectors[j]
+			);
+			if(abs(metric[i][j]) > maxMetric)
+				maxMetric = abs(metric[i][j]);
+		}
+	}
+
+	//Loop over every matrix with elements -1, 0, and 1 and keep those
+	//that preserve the metric. These correspond to orthogonal
+	//transformations that map the lattice onto itself.
+	vector<Matrix<double>> symmetryOperations;
+	unsigned int numElements = dimensions*dimensions;
+	unsigned int numCandidates = pow(3, numElements);
+	for(unsigned int candidate = 0; candidate < numCandidates; candidate++){
+		int M[3][3];
+		unsigned int c = candidate;
+		for(unsigned int n = 0; n < numElements; n++){
+			M[n/dimensions][n%dimensions] = (int)(c%3) - 1;
+			c /= 3;
+		}
+
+		bool preservesMetric = true;
+		for(unsigned int i = 0; i < dimensions; i++){
+			for(unsigned int j = 0; j < dimensions; j++){
+				double transformedMetric = 0.;
+				for(unsigned int k = 0; k < dimensions; k++){
+					for(unsigned int l = 0; l < dimensions; l++){
+						transformedMetric
+							+= M[i][k]*metric[k][l]
+							*M[j][l];
+					}
+				}
+				if(
+					abs(transformedMetric - metric[i][j])
+					> tolerance*maxMetric
+				){
+					preservesMetric = false;
+				}
+			}
+		}
+		if(!preservesMetric)
+			continue;
+
+		//The operation maps b_i to sum_j M_{ij}b_j, which in
+		//Cartesian coordinates is R_{ab} = sum_{ij}b_j[a]M_{ij}n_i[b].
+		Matrix<double> operation(dimensions, dimensions);
+		for(unsigned int a = 0; a < dimensions; a++){
+			for(unsigned int b = 0; b < dimensions; b++){
+				double bj[3];
+				double ni[3];
+				operation.at(a, b) = 0.;
+				for(unsigned int i = 0; i < dimensions; i++){
+					ni[0] = dualBasisVectors[i].x;
+					ni[1] = dualBasisVectors[i].y;
+					ni[2] = dualBasisVectors[i].z;
+					for(unsigned int j = 0; j < dimensions; j++){
+						bj[0] = basisVectors[j].x;
+						bj[1] = basisVectors[j].y;
+						bj[2] = basisVectors[j].z;
+						operation.at(a, b)
+							+= bj[a]*M[i][j]*ni[b];
+					}
+				}
+			}
+		}
+		symmetryOperations.push_back(operation);
+	}
+
+	setSymmetryOperations(symmetryOperations);
+}
+
+BrillouinZone::IrreducibleMesh BrillouinZone::getIrreducibleMesh(
+	const vector<unsigned int> &numMeshPoints
+) const{
+	unsigned int dimensions = getNumDimensions();
+	TBTKAssert(
+		numMeshPoints.size() == dimensions,
+		"BrillouinZone::getIrreducibleMesh()",
+		"Incompatible dimensions. The BrillouinZone has dimension '"
+		<< dimensions << "', but 'numMeshPoints' has '"
+		<< numMeshPoints.size() << "' components.",
+		""
+	);
+
+	//A mesh point with grid coordinates x_i corresponds to the
+	//coordinate sum_i (x_i/N_i)b_i. The image under an operation has
+	//grid coordinates x'_j = sum_i x_i M_{ij}N_j/N_i, which only are
+	//integers for every mesh point if every M_{ij}N_j/N_i is an integer.
+	//Operations that do not map the mesh onto itself are ignored.
+	vector<unsigned int> operations;
+	vector<vector<int>> gridOperations;
+	for(unsigned int n = 0; n < latticeSymmetryOperations.size(); n++){
+		const vector<int> &M = latticeSymmetryOperations[n];
+		vector<int> gridOperation;
+		bool mapsMeshOntoItself = true;
+		for(unsigned int i = 0; i < dimensions; i++){
+			for(unsigned int j = 0; j < dimensions; j++){
+				int numerator = M[i*dimensions + j]*numMeshPoints[j];
+				if(numerator%(int)numMeshPoints[i] != 0)
+					mapsMeshOntoItself = false;
+				gridOperation.push_back(
+					numerator/(int)numMeshPoints[i]
+				);
+			}
+		}
+		if(mapsMeshOntoItself){
+			operations.push_back(n);
+			gridOperations.push_back(gridOperation);
+		}
+	}
+
+	unsigned int numPoints = 1;
+	for(unsigned int n = 0; n < dimensions; n++)
+		numPoints *= numMeshPoints[n];
+
+	IrreducibleMesh irreducibleMesh;
+	irreducibleMesh.irreduciblePoints.assign(numPoints, numPoints);
+	irreducibleMesh.symmetryOperations.assign(numPoints, 0);
+
+	//Every mesh point that has not been reached from an earlier
+	//irreducible point becomes a new irreducible point. Since the mesh
+	//points are visited in order, an irreducible point is always the
+	//first point in its orbit.
+	vector<int> x(dimensions);
+	for(unsigned int point = 0; point < numPoints; point++){
+		if(irreducibleMesh.irreduciblePoints[point] != numPoints)
+			continue;
+
+		unsigned int irreduciblePoint = irreducibleMesh.points.size();
+		irreducibleMesh.points.push_back(point);
+
+		unsigned int p = point;
+		for(int n = dimensions-1; n >= 0; n--){
+			x[n] = p%numMeshPoints[n];
+			p /= numMeshPoints[n];
+		}
+
+		unsigned int multiplicity = 0;
+		for(unsigned int n = 0; n < operations.size(); n++){
+			const vector<int> &gridOperation = gridOperations[n];
+			unsigned int image = 0;
+			for(unsigned int j = 0; j < dimensions; j++){
+				int N = numMeshPoints[j];
+				int xj = 0;
+				for(unsigned int i = 0; i < dimensions; i++)
+					xj += x[i]*gridOperation[i*dimensions + j];
+				xj = ((xj%N) + N)%N;
+				image = image*N + xj;
+			}
+
+			if(irreducibleMesh.irreduciblePoints[image] == numPoints){
+				irreducibleMesh.irreduciblePoints[image]
+					= irreduciblePoint;
+				irreducibleMesh.symmetryOperations[image]
+					= operations[n];
+				multiplicity++;
+			}
+		}
+		irreducibleMesh.weights.push_back(
+			multiplicity/(double)numPoints
+		);
+	}
+
+	return irreducibleMesh;
+}
+
+void BrillouinZone::setIdentity(){
+	unsigned int dimensions = getNumDimensions();
+
+	Matrix<double> identity(dimensions, dimensions);
+	vector<int> latticeIdentity;
+	for(unsigned int i = 0; i < dimensions; i++){
+		for(unsigned int j = 0; j < dimensions; j++){
+			identity.at(i, j) = (i == j ? 1. : 0.);
+			latticeIdentity.push_back(i == j ? 1 : 0);
+		}
+	}
+
+	symmetryOperations.clear();
+	latticeSymmetryOperations.clear();
+	symmetryOperations.push_back(identity);
+	latticeSymmetryOperations.push_back(latticeIdentity);
+}
+
+vector<Vector3d> BrillouinZone::getDualBasisVectors() const{
+	const vector<Vector3d> &basisVectors = getBasisVectors();
+
+	vector<Vector3d> dualBasisVectors;
+	for(unsigned int n = 0; n < 3; n++){
+		const Vector3d &v0 = basisVectors[n];
+		const Vector3d &v1 = basisVectors[(n+1)%3];
+		const Vector3d &v2 = basisVectors[(n+2)%3];
+
+		Vector3d normal = v1*v2;
+		dualBasisVectors.push_back(
+			normal/Vector3d::dotProduct(normal, v0)
+		);
+	}
+
+	return dualBasisVectors;
+}
+
 };	//End of namespace TBTK
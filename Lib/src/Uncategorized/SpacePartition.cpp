@@ -80,6 +80,7 @@ SpacePartition::SpacePartition(
 	MeshType meshType
 ){
 	this->dimensions = basisVectors.size();
+	this->meshType = meshType;
 
 	TBTKAssert(
 		dimensions == 1
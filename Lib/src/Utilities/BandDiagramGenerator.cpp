@@ -19,17 +19,46 @@
  */
 
 #include "TBTK/BandDiagramGenerator.h"
-#include "TBTK/Solver/Diagonalizer.h"
 #include "TBTK/ParametrizedLine.h"
-#include "TBTK/Timer.h"
 #include "TBTK/VectorNd.h"
 
+#include <fstream>
+#include <limits>
+
+#ifdef TBTK_USE_OPEN_MP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace TBTK{
 
+//Lapack function for matrix diagonalization of triangular matrix.
+extern "C" void zhpev_(
+	char *jobz,
+	char *uplo,
+	int *n,
+	complex<double> *ap,
+	double *w,
+	complex<double> *z,
+	int *ldz,
+	complex<double> *work,
+	double *rwork,
+	int *info
+);
+
 BandDiagramGenerator::BandDiagramGenerator(){
 	reciprocalLattice = nullptr;
+	lowerBound = -numeric_limits<double>::infinity();
+	upperBound = numeric_limits<double>::infinity();
+}
+
+BandDiagramGenerator::Workspace::Workspace(unsigned int numBands) :
+	hamiltonian((numBands*(numBands+1))/2),
+	eigenValues(numBands),
+	work(max(1, 2*(int)numBands-1)),
+	rwork(max(1, 3*(int)numBands-2))
+{
 }
 
 vector<vector<double>> BandDiagramGenerator::generateBandDiagram(
@@ -81,9 +110,8 @@ vector<vector<double>> BandDiagramGenerator::generateBandDiagram(
 
 	unsigned int numBands = reciprocalLattice->getNumBands();
 
-	vector<vector<double>> bandDiagram;
-	for(unsigned int n = 0; n < numBands*nesting.size(); n++)
-		bandDiagram.push_back(vector<double>());
+	//Setup the k-points along the path.
+	vector<vector<double>> momentums;
 	for(unsigned int n = 1; n < kPoints.size(); n++){
 		const initializer_list<double> kPointStart = *(kPoints.begin() + n - 1);
 		const initializer_list<double> kPointEnd = *(kPoints.begin() + n);
@@ -109,25 +137,147 @@ vector<vector<double>> BandDiagramGenerator::generateBandDiagram(
 						latticePoint.at(i) + nesting.at(m).at(i)
 					);
 				}
-				Timer::tick("Diagonalizing");
-				Model *model = reciprocalLattice->generateModel(
-					nestedPoint
-				);
-				model->construct();
+				momentums.push_back(nestedPoint);
+			}
+		}
+	}
 
-				Solver::Diagonalizer solver;
-				solver.setModel(*model);
-				solver.run();
+	ofstream fout;
+	if(outputFile.compare("") != 0){
+		fout.open(outputFile);
+		TBTKAssert(
+			fout.is_open(),
+			"BandDiagramGenerator::generateBandDiagram()",
+			"Unable to open file '" << outputFile << "'.",
+			""
+		);
+		fout.precision(numeric_limits<double>::max_digits10);
+	}
 
-				for(unsigned int i = 0; i < numBands; i++)
-					bandDiagram[i + numBands*m].push_back(solver.getEigenValue(i));
+	vector<vector<double>> bandDiagram;
+	if(!fout.is_open()){
+		for(unsigned int n = 0; n < numBands*nesting.size(); n++){
+			bandDiagram.push_back(vector<double>());
+			bandDiagram.back().reserve(momentums.size()/nesting.size());
+		}
+	}
+
+	//Setup one workspace per thread.
+#ifdef TBTK_USE_OPEN_MP
+	unsigned int numThreads = omp_get_max_threads();
+#else
+	unsigned int numThreads = 1;
+#endif
+	vector<Workspace> workspaces(numThreads, Workspace(numBands));
+
+	//Diagonalize the k-points in chunks to keep the memory usage bounded.
+	unsigned int chunkSize = CHUNK_SIZE*nesting.size();
+	vector<double> eigenValues(chunkSize*numBands);
+	for(
+		unsigned int chunkStart = 0;
+		chunkStart < momentums.size();
+		chunkStart += chunkSize
+	){
+		unsigned int chunkEnd = min(
+			chunkStart + chunkSize,
+			(unsigned int)momentums.size()
+		);
+		unsigned int numMomentums = chunkEnd - chunkStart;
+		vector<complex<double>> amplitudes
+			= reciprocalLattice->calculateAmplitudes(
+				vector<vector<double>>(
+					momentums.begin() + chunkStart,
+					momentums.begin() + chunkEnd
+				)
+			);
+
+		#pragma omp parallel for
+		for(unsigned int m = 0; m < numMomentums; m++){
+#ifdef TBTK_USE_OPEN_MP
+			Workspace &workspace = workspaces[omp_get_thread_num()];
+#else
+			Workspace &workspace = workspaces[0];
+#endif
+
+			//Setup the Hamiltonian on packed upper triangular
+			//format.
+			for(unsigned int from = 0; from < numBands; from++){
+				for(unsigned int to = 0; to <= from; to++){
+					workspace.hamiltonian[
+						to + (from*(from+1))/2
+					] = amplitudes[
+						(from*numBands + to)*numMomentums + m
+					];
+				}
+			}
+
+			//Calculate the eigenvalues.
+			char jobz = 'N';
+			char uplo = 'U';
+			int n = numBands;
+			int ldz = 1;
+			int info;
+			zhpev_(
+				&jobz,
+				&uplo,
+				&n,
+				workspace.hamiltonian.data(),
+				workspace.eigenValues.data(),
+				nullptr,
+				&ldz,
+				workspace.work.data(),
+				workspace.rwork.data(),
+				&info
+			);
+			TBTKAssert(
+				info == 0,
+				"BandDiagramGenerator::generateBandDiagram()",
+				"Diagonalization routine zhpev exited with INFO="
+				<< info << ".",
+				"See LAPACK documentation for zhpev for further"
+				<< " information."
+			);
 
-				delete model;
-				Timer::tock();
+			for(unsigned int i = 0; i < numBands; i++){
+				double eigenValue = workspace.eigenValues[i];
+				if(eigenValue < lowerBound || eigenValue > upperBound)
+					eigenValue = numeric_limits<double>::quiet_NaN();
+				eigenValues[m*numBands + i] = eigenValue;
 			}
 		}
+
+		//Store the result. Momentums are ordered such that the nested
+		//points for the same point on the path are consecutive.
+		for(
+			unsigned int m = 0;
+			m < numMomentums;
+			m += nesting.size()
+		){
+			for(unsigned int n = 0; n < nesting.size(); n++){
+				for(unsigned int i = 0; i < numBands; i++){
+					double eigenValue = eigenValues[
+						(m + n)*numBands + i
+					];
+					if(fout.is_open()){
+						if(n != 0 || i != 0)
+							fout << "\t";
+						fout << eigenValue;
+					}
+					else{
+						bandDiagram[
+							i + numBands*n
+						].push_back(eigenValue);
+					}
+				}
+			}
+			if(fout.is_open())
+				fout << "\n";
+		}
 	}
 
+	if(fout.is_open())
+		fout.close();
+
 	return bandDiagram;
 }
 
@@ -0,0 +1,283 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file EnergyMesh.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/EnergyMesh.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+
+namespace TBTK{
+
+vector<double> EnergyMesh::generateLogarithmicMesh(
+	double lowerBound,
+	double upperBound,
+	double center,
+	double minimumSpacing,
+	unsigned int numPointsPerSide
+){
+	TBTKAssert(
+		lowerBound <= center && center <= upperBound,
+		"EnergyMesh::generateLogarithmicMesh()",
+		"The 'center=" << center << "' must lie between the"
+		<< " 'lowerBound=" << lowerBound << "' and the 'upperBound="
+		<< upperBound << "'.",
+		""
+	);
+	TBTKAssert(
+		minimumSpacing > 0,
+		"EnergyMesh::generateLogarithmicMesh()",
+		"The 'minimumSpacing' must be larger than 0.",
+		""
+	);
+	TBTKAssert(
+		numPointsPerSide > 0,
+		"EnergyMesh::generateLogarithmicMesh()",
+		"The 'numPointsPerSide' must be larger than 0.",
+		""
+	);
+
+	vector<double> distances[2];
+	double maxDistances[2] = {center - lowerBound, upperBound - center};
+	for(unsigned int side = 0; side < 2; side++){
+		double maxDistance = maxDistances[side];
+		if(maxDistance == 0)
+			continue;
+
+		if(maxDistance <= minimumSpacing || numPointsPerSide == 1){
+			distances[side].push_back(maxDistance);
+			continue;
+		}
+
+		double ratio = maxDistance/minimumSpacing;
+		for(unsigned int n = 0; n < numPointsPerSide; n++){
+			distances[side].push_back(
+				minimumSpacing*pow(
+					ratio,
+					n/(double)(numPointsPerSide - 1)
+				)
+			);
+		}
+		//Avoid rounding errors at the bound.
+		distances[side].back() = maxDistance;
+	}
+
+	vector<double> mesh;
+	for(int n = distances[0].size() - 1; n >= 0; n--)
+		mesh.push_back(center - distances[0][n]);
+	mesh.push_back(center);
+	for(unsigned int n = 0; n < distances[1].size(); n++)
+		mesh.push_back(center + distances[1][n]);
+
+	return mesh;
+}
+
+vector<double> EnergyMesh::generateAdaptiveMesh(
+	double lowerBound,
+	double upperBound,
+	const vector<double> &features,
+	double minimumSpacing,
+	double maximumSpacing,
+	double growthRate
+){
+	TBTKAssert(
+		lowerBound < upperBound,
+		"EnergyMesh::generateAdaptiveMesh()",
+		"The 'lowerBound=" << lowerBound << "' must be smaller than"
+		<< " the 'upperBound=" << upperBound << "'.",
+		""
+	);
+	TBTKAssert(
+		minimumSpacing > 0 && minimumSpacing <= maximumSpacing,
+		"EnergyMesh::generateAdaptiveMesh()",
+		"The 'minimumSpacing' must be larger than 0 and smaller than"
+		<< " or equal to the 'maximumSpacing'.",
+		""
+	);
+	TBTKAssert(
+		growthRate > 0,
+		"EnergyMesh::generateAdaptiveMesh()",
+		"The 'growthRate' must be larger than 0.",
+		""
+	);
+
+	vector<double> sortedFeatures = features;
+	sort(sortedFeatures.begin(), sortedFeatures.end());
+
+	vector<double> mesh;
+	mesh.push_back(lowerBound);
+	unsigned int nextFeature = 0;
+	while(true){
+		double energy = mesh.back();
+		while(
+			nextFeature < sortedFeatures.size()
+			&& sortedFeatures[nextFeature] <= energy
+		){
+			nextFeature++;
+		}
+
+		double distance = maximumSpacing/growthRate;
+		if(nextFeature > 0){
+			distance = min(
+				distance,
+				energy - sortedFeatures[nextFeature-1]
+			);
+		}
+		if(nextFeature < sortedFeatures.size()){
+			distance = min(
+				distance,
+				sortedFeatures[nextFeature] - energy
+			);
+		}
+		double spacing = max(
+			minimumSpacing,
+			min(maximumSpacing, growthRate*distance)
+		);
+
+		//Step onto the next feature rather than past it or to a point
+		//just before it.
+		double nextEnergy = energy + spacing;
+		if(
+			nextFeature < sortedFeatures.size()
+			&& sortedFeatures[nextFeature]
+				< nextEnergy + minimumSpacing/2
+		){
+			nextEnergy = sortedFeatures[nextFeature];
+		}
+
+		if(nextEnergy >= upperBound)
+			break;
+
+		mesh.push_back(nextEnergy);
+	}
+
+	//Move the last energy to the upper bound rather than adding a point
+	//that is much closer than the minimum spacing.
+	if(
+		mesh.size() > 1
+		&& upperBound - mesh.back() < minimumSpacing/2
+		&& !binary_search(
+			sortedFeatures.begin(),
+			sortedFeatures.end(),
+			mesh.back()
+		)
+	){
+		mesh.back() = upperBound;
+	}
+	else{
+		mesh.push_back(upperBound);
+	}
+
+	return mesh;
+}
+
+vector<int> EnergyMesh::generateSparseMatsubaraEnergyIndices(
+	int lowerMatsubaraEnergyIndex,
+	int upperMatsubaraEnergyIndex,
+	unsigned int numContiguousMatsubaraEnergies,
+	unsigned int numMatsubaraEnergiesPerDecade
+){
+	TBTKAssert(
+		lowerMatsubaraEnergyIndex <= upperMatsubaraEnergyIndex,
+		"EnergyMesh::generateSparseMatsubaraEnergyIndices()",
+		"The 'lowerMatsubaraEnergyIndex=" << lowerMatsubaraEnergyIndex
+		<< "' must be less or equal to the"
+		<< " 'upperMatsubaraEnergyIndex=" << upperMatsubaraEnergyIndex
+		<< "'.",
+		""
+	);
+	int parity = abs(lowerMatsubaraEnergyIndex%2);
+	TBTKAssert(
+		abs(upperMatsubaraEnergyIndex%2) == parity,
+		"EnergyMesh::generateSparseMatsubaraEnergyIndices()",
+		"The 'lowerMatsubaraEnergyIndex=" << lowerMatsubaraEnergyIndex
+		<< "' and the 'upperMatsubaraEnergyIndex="
+		<< upperMatsubaraEnergyIndex << "' must either both be odd or"
+		<< " both be even.",
+		""
+	);
+	TBTKAssert(
+		numMatsubaraEnergiesPerDecade > 0,
+		"EnergyMesh::generateSparseMatsubaraEnergyIndices()",
+		"The 'numMatsubaraEnergiesPerDecade' must be larger than 0.",
+		""
+	);
+
+	int maxMagnitude = max(
+		abs(lowerMatsubaraEnergyIndex),
+		abs(upperMatsubaraEnergyIndex)
+	);
+
+	//Non-negative Matsubara energy indices, which are mirrored below.
+	vector<int> magnitudes;
+	int magnitude = parity;
+	for(unsigned int n = 0; n < numContiguousMatsubaraEnergies; n++){
+		if(magnitude > maxMagnitude)
+			break;
+
+		magnitudes.push_back(magnitude);
+		magnitude += 2;
+	}
+	//The Matsubara energies closest to zero are always included.
+	if(magnitudes.size() == 0)
+		magnitudes.push_back(parity);
+	double factor = pow(10., 1./numMatsubaraEnergiesPerDecade);
+	magnitude = magnitudes.back();
+	while(true){
+		int nextMagnitude = (int)round(magnitude*factor);
+		if(abs(nextMagnitude%2) != parity)
+			nextMagnitude++;
+		magnitude = max(nextMagnitude, magnitude + 2);
+		if(magnitude > maxMagnitude)
+			break;
+
+		magnitudes.push_back(magnitude);
+	}
+
+	vector<int> matsubaraEnergyIndices;
+	matsubaraEnergyIndices.push_back(lowerMatsubaraEnergyIndex);
+	matsubaraEnergyIndices.push_back(upperMatsubaraEnergyIndex);
+	for(unsigned int n = 0; n < magnitudes.size(); n++){
+		for(int sign = -1; sign <= 1; sign += 2){
+			int index = sign*magnitudes[n];
+			if(
+				index >= lowerMatsubaraEnergyIndex
+				&& index <= upperMatsubaraEnergyIndex
+			){
+				matsubaraEnergyIndices.push_back(index);
+			}
+		}
+	}
+	sort(matsubaraEnergyIndices.begin(), matsubaraEnergyIndices.end());
+	matsubaraEnergyIndices.erase(
+		unique(
+			matsubaraEnergyIndices.begin(),
+			matsubaraEnergyIndices.end()
+		),
+		matsubaraEnergyIndices.end()
+	);
+
+	return matsubaraEnergyIndices;
+}
+
+};	//End of namespace TBTK
@@ -23,9 +23,11 @@
 
 #include <H5Cpp.h>
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #ifndef H5_NO_NAMESPACE
 	using namespace H5;
@@ -37,6 +39,12 @@ namespace TBTK{
 
 bool FileWriter::isInitialized = false;
 string FileWriter::filename = "TBTKResults.h5";
+H5File *FileWriter::sessionFile = nullptr;
+FileWriter::Compression FileWriter::compression
+	= FileWriter::Compression::None;
+unsigned int FileWriter::compressionLevel = 6;
+bool FileWriter::shuffle = false;
+unsigned int FileWriter::chunkSize = 1 << 16;
 
 void FileWriter::init(){
 	if(isInitialized)
@@ -55,6 +63,262 @@ void FileWriter::init(){
 	isInitialized = true;
 }
 
+void FileWriter::beginSession(){
+	TBTKAssert(
+		sessionFile == nullptr,
+		"FileWriter::beginSession()",
+		"A session has already begun.",
+		""
+	);
+
+	init();
+
+	//As long as the session file is open, the calls to
+	//H5File(filename, H5F_ACC_RDWR) in the write functions reuse the
+	//already open file rather than opening and closing it.
+	try{
+		H5::Exception::dontPrint();
+		sessionFile = new H5File(filename, H5F_ACC_RDWR);
+	}
+	catch(FileIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::beginSession()",
+			"Unable to open " << filename << ".",
+			""
+		);
+	}
+}
+
+void FileWriter::endSession(){
+	TBTKAssert(
+		sessionFile != nullptr,
+		"FileWriter::endSession()",
+		"No session has begun.",
+		"Call FileWriter::beginSession() first."
+	);
+
+	sessionFile->close();
+	delete sessionFile;
+	sessionFile = nullptr;
+}
+
+DataSet FileWriter::createDataSet(
+	H5File &file,
+	const string &name,
+	const PredType &fileType,
+	const DataSpace &dataspace
+){
+	if(sessionFile == nullptr)
+		return file.createDataSet(name, fileType, dataspace);
+
+	//Use the native type corresponding to the file type.
+	const PredType *nativeType;
+	if(fileType == PredType::STD_I32BE)
+		nativeType = &PredType::NATIVE_INT;
+	else if(fileType == PredType::IEEE_F64BE)
+		nativeType = &PredType::NATIVE_DOUBLE;
+	else
+		nativeType = &fileType;
+
+	//Chunked storage is not possible for scalar or empty datasets.
+	int rank = dataspace.getSimpleExtentNdims();
+	vector<hsize_t> dims(rank);
+	if(rank > 0)
+		dataspace.getSimpleExtentDims(dims.data());
+	bool isChunkable = (rank > 0);
+	for(int n = 0; n < rank; n++)
+		if(dims[n] == 0)
+			isChunkable = false;
+	if(!isChunkable)
+		return file.createDataSet(name, *nativeType, dataspace);
+
+	//Shrink the leading dimensions until the chunk contains at most
+	//chunkSize elements.
+	vector<hsize_t> chunkDims = dims;
+	hsize_t numElements = 1;
+	for(int n = 0; n < rank; n++)
+		numElements *= chunkDims[n];
+	for(int n = 0; n < rank && numElements > chunkSize; n++){
+		hsize_t numElementsPerSlice = numElements/chunkDims[n];
+		chunkDims[n] = max((hsize_t)1, chunkSize/numElementsPerSlice);
+		numElements = numElementsPerSlice*chunkDims[n];
+	}
+
+	DSetCreatPropList propertyList;
+	propertyList.setChunk(rank, chunkDims.data());
+	if(shuffle)
+		propertyList.setShuffle();
+	switch(compression){
+	case Compression::None:
+		break;
+	case Compression::GZip:
+		TBTKAssert(
+			H5Zfilter_avail(H5Z_FILTER_DEFLATE),
+			"FileWriter::createDataSet()",
+			"GZip compression is not available.",
+			"The HDF5 library has been built without GZip support."
+		);
+		propertyList.setDeflate(compressionLevel);
+		break;
+	case Compression::SZip:
+		TBTKAssert(
+			H5Zfilter_avail(H5Z_FILTER_SZIP),
+			"FileWriter::createDataSet()",
+			"SZip compression is not available.",
+			"The HDF5 library has been built without SZip support."
+		);
+		propertyList.setSzip(H5_SZIP_NN_OPTION_MASK, compressionLevel);
+		break;
+	default:
+		TBTKExit(
+			"FileWriter::createDataSet()",
+			"Unknown compression.",
+			"This should never happen, contact the developer."
+		);
+	}
+
+	return file.createDataSet(name, *nativeType, dataspace, propertyList);
+}
+
+void FileWriter::createDataSet(
+	int rank,
+	const int *dims,
+	string name,
+	string path
+){
+	TBTKAssert(
+		path.compare("/") == 0,
+		"FileWriter::createDataSet()",
+		"'path' not yet supported.",
+		"Only use the default path value \"/\"."
+	);
+
+	init();
+
+	hsize_t data_dims[rank];
+	for(int n = 0; n < rank; n++)
+		data_dims[n] = dims[n];
+
+	try{
+		H5::Exception::dontPrint();
+		H5File file(filename, H5F_ACC_RDWR);
+
+		DataSpace dataspace = DataSpace(rank, data_dims);
+		DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
+		dataspace.close();
+
+		dataset.close();
+		file.close();
+	}
+	catch(FileIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::createDataSet()",
+			"While creating " << name << ".",
+			""
+		);
+	}
+	catch(DataSetIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::createDataSet()",
+			"While creating " << name << ".",
+			""
+		);
+	}
+	catch(DataSpaceIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::createDataSet()",
+			"While creating " << name << ".",
+			""
+		);
+	}
+}
+
+void FileWriter::writeHyperslab(
+	const double *data,
+	int rank,
+	const int *offset,
+	const int *count,
+	string name,
+	string path
+){
+	TBTKAssert(
+		path.compare("/") == 0,
+		"FileWriter::writeHyperslab()",
+		"'path' not yet supported.",
+		"Only use the default path value \"/\"."
+	);
+
+	init();
+
+	hsize_t slabOffset[rank];
+	hsize_t slabCount[rank];
+	for(int n = 0; n < rank; n++){
+		slabOffset[n] = offset[n];
+		slabCount[n] = count[n];
+	}
+
+	try{
+		H5::Exception::dontPrint();
+		H5File file(filename, H5F_ACC_RDWR);
+
+		DataSet dataset = file.openDataSet(name);
+		DataSpace fileDataspace = dataset.getSpace();
+		TBTKAssert(
+			fileDataspace.getSimpleExtentNdims() == rank,
+			"FileWriter::writeHyperslab()",
+			"Incompatible rank. The dataset '" << name << "' has"
+			<< " rank " << fileDataspace.getSimpleExtentNdims()
+			<< ", but the rank " << rank << " was supplied.",
+			""
+		);
+		fileDataspace.selectHyperslab(
+			H5S_SELECT_SET,
+			slabCount,
+			slabOffset
+		);
+		DataSpace memoryDataspace = DataSpace(rank, slabCount);
+		dataset.write(
+			data,
+			PredType::NATIVE_DOUBLE,
+			memoryDataspace,
+			fileDataspace
+		);
+		memoryDataspace.close();
+		fileDataspace.close();
+
+		dataset.close();
+		file.close();
+	}
+	catch(FileIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::writeHyperslab()",
+			"While writing to " << name << ".",
+			""
+		);
+	}
+	catch(DataSetIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::writeHyperslab()",
+			"While writing to " << name << ".",
+			""
+		);
+	}
+	catch(DataSpaceIException error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"FileWriter::writeHyperslab()",
+			"While writing to " << name << ".",
+			""
+		);
+	}
+}
+
 void FileWriter::writeModel(const Model &model, string name, string path){
 	TBTKAssert(
 		path.compare("/") == 0,
@@ -131,7 +395,7 @@ void FileWriter::writeHoppingAmplitudeSet(
 		ss << name << "Indices";
 
 		DataSpace dataspace = DataSpace(INDEX_RANK, indexDims);
-		DataSet dataset = DataSet(file.createDataSet(ss.str(), PredType::STD_I32BE, dataspace));
+		DataSet dataset = createDataSet(file, ss.str(), PredType::STD_I32BE, dataspace);
 		dataset.write(indices, PredType::NATIVE_INT);
 		dataspace.close();
 		dataset.close();
@@ -143,7 +407,7 @@ void FileWriter::writeHoppingAmplitudeSet(
 		ss << name << "Amplitudes";
 
 		dataspace = DataSpace(AMPLITUDE_RANK, amplitudeDims);
-		dataset = DataSet(file.createDataSet(ss.str(), PredType::IEEE_F64BE, dataspace));
+		dataset = createDataSet(file, ss.str(), PredType::IEEE_F64BE, dataspace);
 		dataset.write(amplitudes, PredType::NATIVE_DOUBLE);
 		dataspace.close();
 		dataset.close();
@@ -218,7 +482,7 @@ void FileWriter::writeGeometry(
 		ss << name << "Coordinates";
 
 		DataSpace dataspace = DataSpace(RANK, dDims);
-		DataSet dataset = DataSet(file.createDataSet(ss.str(), PredType::IEEE_F64BE, dataspace));
+		DataSet dataset = createDataSet(file, ss.str(), PredType::IEEE_F64BE, dataspace);
 		dataset.write(coordinates, PredType::NATIVE_DOUBLE);
 		dataset.close();
 		dataspace.close();
@@ -230,7 +494,7 @@ void FileWriter::writeGeometry(
 		ss << name << "Specifiers";
 
 		dataspace = DataSpace(RANK, sDims);
-		dataset = DataSet(file.createDataSet(ss.str(), PredType::STD_I32BE, dataspace));
+		dataset = createDataSet(file, ss.str(), PredType::STD_I32BE, dataspace);
 		if(numSpecifiers != 0){
 			dataset.write(specifiers, PredType::NATIVE_INT);
 		}
@@ -317,7 +581,7 @@ void FileWriter::writeIndexTree(
 		ss << name;
 
 		DataSpace dataspace = DataSpace(RANK, dims);
-		DataSet dataset = DataSet(file.createDataSet(ss.str(), PredType::STD_I32BE, dataspace));
+		DataSet dataset = createDataSet(file, ss.str(), PredType::STD_I32BE, dataspace);
 		dataset.write(serializedIndices.data(), PredType::NATIVE_INT);
 		dataspace.close();
 		dataset.close();
@@ -379,7 +643,7 @@ void FileWriter::writeEigenValues(
 		H5File file(filename, H5F_ACC_RDWR);
 
 		DataSpace dataspace = DataSpace(RANK, dims);
-		DataSet dataset = DataSet(file.createDataSet(name, PredType::IEEE_F64BE, dataspace));
+		DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
 		dataset.write(
 			ev.getData().data(),
 			PredType::NATIVE_DOUBLE
@@ -510,12 +774,11 @@ void FileWriter::writeDOS(const Property::DOS &dos, string name, string path){
 		H5File file(filename, H5F_ACC_RDWR);
 
 		DataSpace dataspace = DataSpace(DOS_RANK, dos_dims);
-		DataSet dataset = DataSet(
-			file.createDataSet(
-				name,
-				PredType::IEEE_F64BE,
-				dataspace
-			)
+		DataSet dataset = createDataSet(
+			file,
+			name,
+			PredType::IEEE_F64BE,
+			dataspace
 		);
 		dataset.write(dos.getData().data(), PredType::NATIVE_DOUBLE);
 		dataspace.close();
@@ -606,7 +869,7 @@ void FileWriter::writeDensity(
 			H5File file(filename, H5F_ACC_RDWR);
 
 			DataSpace dataspace = DataSpace(rank, density_dims);
-			DataSet dataset = DataSet(file.createDataSet(name, PredType::IEEE_F64BE, dataspace));
+			DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
 			dataset.write(density.getData().data(), PredType::NATIVE_DOUBLE);
 			dataspace.close();
 			dataset.close();
@@ -733,7 +996,7 @@ void FileWriter::writeMagnetization(
 			H5File file(filename, H5F_ACC_RDWR);
 
 			DataSpace dataspace = DataSpace(rank+2, mag_dims);
-			DataSet dataset = DataSet(file.createDataSet(name, PredType::IEEE_F64BE, dataspace));
+			DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
 			dataset.write(mag_decomposed, PredType::NATIVE_DOUBLE);
 			dataspace.close();
 			dataset.close();
@@ -878,12 +1141,11 @@ void FileWriter::writeLDOS(
 			H5File file(filename, H5F_ACC_RDWR);
 
 			DataSpace dataspace = DataSpace(rank+1, ldos_dims);
-			DataSet dataset = DataSet(
-				file.createDataSet(
-					name,
-					PredType::IEEE_F64BE,
-					dataspace
-				)
+			DataSet dataset = createDataSet(
+				file,
+				name,
+				PredType::IEEE_F64BE,
+				dataspace
 			);
 			dataset.write(
 				ldos.getData().data(),
@@ -1049,7 +1311,7 @@ void FileWriter::writeSpinPolarizedLDOS(
 			H5File file(filename, H5F_ACC_RDWR);
 
 			DataSpace dataspace = DataSpace(rank+3, sp_ldos_dims);
-			DataSet dataset = DataSet(file.createDataSet(name, PredType::IEEE_F64BE, dataspace));
+			DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
 			dataset.write(sp_ldos_decomposed, PredType::NATIVE_DOUBLE);
 			dataspace.close();
 
@@ -1157,7 +1419,7 @@ void FileWriter::write(
 		H5File file(filename, H5F_ACC_RDWR);
 
 		DataSpace dataspace = DataSpace(rank, data_dims);
-		DataSet dataset = DataSet(file.createDataSet(name, PredType::STD_I32BE, dataspace));
+		DataSet dataset = createDataSet(file, name, PredType::STD_I32BE, dataspace);
 		dataset.write(data, PredType::NATIVE_INT);
 		dataspace.close();
 
@@ -1221,7 +1483,7 @@ void FileWriter::write(
 		H5File file(filename, H5F_ACC_RDWR);
 
 		DataSpace dataspace = DataSpace(rank, data_dims);
-		DataSet dataset = DataSet(file.createDataSet(name, PredType::IEEE_F64BE, dataspace));
+		DataSet dataset = createDataSet(file, name, PredType::IEEE_F64BE, dataspace);
 		dataset.write(data, PredType::NATIVE_DOUBLE);
 		dataspace.close();
 
@@ -0,0 +1,388 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file LazyLDOS.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/FileReader.h"
+#include "TBTK/LazyLDOS.h"
+#include "TBTK/Streams.h"
+
+#include <H5Cpp.h>
+
+#include <algorithm>
+#include <sstream>
+
+#ifndef H5_NO_NAMESPACE
+	using namespace H5;
+#endif
+
+using namespace std;
+
+namespace TBTK{
+
+LazyLDOS::LazyLDOS(
+	string name,
+	string path,
+	unsigned int blockSize,
+	unsigned int cacheSize
+){
+	TBTKAssert(
+		cacheSize > 0,
+		"LazyLDOS::LazyLDOS()",
+		"The cache size must be larger than zero.",
+		""
+	);
+	this->cacheSize = cacheSize;
+
+	int intAttributes[2];
+	string intAttributeNames[2];
+	intAttributeNames[0] = "Format";
+	intAttributeNames[1] = "Resolution";
+	stringstream ss;
+	ss << name << "IntAttributes";
+	FileReader::readAttributes(
+		intAttributes,
+		intAttributeNames,
+		2,
+		ss.str(),
+		path
+	);
+
+	double doubleAttributes[2];
+	string doubleAttributeNames[2];
+	doubleAttributeNames[0] = "LowerBound";
+	doubleAttributeNames[1] = "UpperBound";
+	ss.str("");
+	ss << name << "DoubleAttributes";
+	FileReader::readAttributes(
+		doubleAttributes,
+		doubleAttributeNames,
+		2,
+		ss.str(),
+		path
+	);
+
+	format = static_cast<IndexDescriptor::Format>(intAttributes[0]);
+	resolution = intAttributes[1];
+	lowerBound = doubleAttributes[0];
+	upperBound = doubleAttributes[1];
+	indexTree = nullptr;
+
+	file = nullptr;
+	dataset = nullptr;
+	try{
+		H5::Exception::dontPrint();
+		file = new H5File(FileReader::getFileName(), H5F_ACC_RDONLY);
+		dataset = new DataSet(file->openDataSet(name));
+		TBTKAssert(
+			dataset->getTypeClass() == H5T_FLOAT,
+			"LazyLDOS::LazyLDOS()",
+			"Data type is not double.",
+			""
+		);
+
+		DataSpace dataspace = dataset->getSpace();
+		int rank = dataspace.getSimpleExtentNdims();
+		vector<hsize_t> dims(rank);
+		dataspace.getSimpleExtentDims(dims.data(), NULL);
+		dataspace.close();
+
+		switch(format){
+		case IndexDescriptor::Format::Ranges:
+			//Last dimension is for energy.
+			for(int n = 0; n < rank-1; n++)
+				ranges.push_back(dims[n]);
+			numSites = 1;
+			for(unsigned int n = 0; n < ranges.size(); n++)
+				numSites *= ranges[n];
+			if(ranges.size() == 0){
+				sitesPerRow = 1;
+				numRows = 1;
+			}
+			else{
+				numRows = ranges[0];
+				sitesPerRow = numSites/max(numRows, 1u);
+			}
+			break;
+		case IndexDescriptor::Format::Custom:
+			ss.str("");
+			ss << name << "IndexTree";
+			indexTree = FileReader::readIndexTree(ss.str(), path);
+			numSites = dims[0]/resolution;
+			sitesPerRow = 1;
+			numRows = numSites;
+			break;
+		default:
+			TBTKExit(
+				"LazyLDOS::LazyLDOS()",
+				"Storage format not supported.",
+				"Only the Ranges and Custom formats are supported."
+			);
+		}
+	}
+	catch(const FileIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::LazyLDOS()",
+			"While opening " << name << ".",
+			""
+		);
+	}
+	catch(const DataSetIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::LazyLDOS()",
+			"While opening " << name << ".",
+			""
+		);
+	}
+	catch(const DataSpaceIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::LazyLDOS()",
+			"While opening " << name << ".",
+			""
+		);
+	}
+
+	unsigned int rowSize = max(sitesPerRow*resolution, 1u);
+	rowsPerBlock = max(blockSize/rowSize, 1u);
+}
+
+LazyLDOS::~LazyLDOS(){
+	if(dataset != nullptr){
+		dataset->close();
+		delete dataset;
+	}
+	if(file != nullptr){
+		file->close();
+		delete file;
+	}
+	if(indexTree != nullptr)
+		delete indexTree;
+}
+
+unsigned int LazyLDOS::getSite(const Index &index) const{
+	switch(format){
+	case IndexDescriptor::Format::Ranges:
+	{
+		TBTKAssert(
+			index.getSize() == ranges.size(),
+			"LazyLDOS::getSite()",
+			"Incompatible Index. The Index '" << index.toString()
+			<< "' has " << index.getSize() << " subindices, but the"
+			<< " LDOS has " << ranges.size() << " ranges.",
+			""
+		);
+
+		unsigned int site = 0;
+		for(unsigned int n = 0; n < ranges.size(); n++){
+			TBTKAssert(
+				index[n] >= 0 && index[n] < ranges[n],
+				"LazyLDOS::getSite()",
+				"Index out of range. The Index '"
+				<< index.toString() << "' is outside of the"
+				<< " ranges of the LDOS.",
+				""
+			);
+			site = site*ranges[n] + index[n];
+		}
+
+		return site;
+	}
+	case IndexDescriptor::Format::Custom:
+		return indexTree->getLinearIndex(
+			index,
+			IndexTree::SearchMode::MatchWildcards
+		);
+	default:
+		TBTKExit(
+			"LazyLDOS::getSite()",
+			"Storage format not supported.",
+			"This should never happen, contact the developer."
+		);
+	}
+}
+
+vector<double> LazyLDOS::getData(const Index &index) const{
+	unsigned int site = getSite(index);
+	unsigned int rowsPerBlockSites = rowsPerBlock*sitesPerRow;
+	const vector<double> &block = getBlock(site/rowsPerBlockSites);
+	unsigned int offset = (site%rowsPerBlockSites)*resolution;
+
+	return vector<double>(
+		block.begin() + offset,
+		block.begin() + offset + resolution
+	);
+}
+
+vector<double> LazyLDOS::getDataAtEnergy(unsigned int n) const{
+	TBTKAssert(
+		n < resolution,
+		"LazyLDOS::getDataAtEnergy()",
+		"Energy index out of range. The energy index is '" << n << "',"
+		<< " but the resolution is '" << resolution << "'.",
+		""
+	);
+
+	vector<double> result(numSites);
+	try{
+		DataSpace fileDataspace = dataset->getSpace();
+		int rank = fileDataspace.getSimpleExtentNdims();
+		vector<hsize_t> offset(rank, 0);
+		vector<hsize_t> count(rank);
+		vector<hsize_t> stride(rank, 1);
+		if(format == IndexDescriptor::Format::Ranges){
+			for(unsigned int c = 0; c < ranges.size(); c++)
+				count[c] = ranges[c];
+			offset[rank-1] = n;
+			count[rank-1] = 1;
+		}
+		else{
+			offset[0] = n;
+			count[0] = numSites;
+			stride[0] = resolution;
+		}
+		fileDataspace.selectHyperslab(
+			H5S_SELECT_SET,
+			count.data(),
+			offset.data(),
+			stride.data()
+		);
+		hsize_t memoryDims[1] = {numSites};
+		DataSpace memoryDataspace(1, memoryDims);
+		dataset->read(
+			result.data(),
+			PredType::NATIVE_DOUBLE,
+			memoryDataspace,
+			fileDataspace
+		);
+		memoryDataspace.close();
+		fileDataspace.close();
+	}
+	catch(const DataSetIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::getDataAtEnergy()",
+			"While reading energy index " << n << ".",
+			""
+		);
+	}
+	catch(const DataSpaceIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::getDataAtEnergy()",
+			"While reading energy index " << n << ".",
+			""
+		);
+	}
+
+	return result;
+}
+
+const vector<double>& LazyLDOS::getBlock(unsigned int block) const{
+	map<
+		unsigned int,
+		pair<vector<double>, list<unsigned int>::iterator>
+	>::iterator iterator = cache.find(block);
+	if(iterator != cache.end()){
+		//Move the block to the front of the LRU list.
+		leastRecentlyUsed.splice(
+			leastRecentlyUsed.begin(),
+			leastRecentlyUsed,
+			iterator->second.second
+		);
+
+		return iterator->second.first;
+	}
+
+	//Evict the least recently used block if the cache is full.
+	if(cache.size() == cacheSize){
+		cache.erase(leastRecentlyUsed.back());
+		leastRecentlyUsed.pop_back();
+	}
+
+	unsigned int firstRow = block*rowsPerBlock;
+	unsigned int numRowsToRead = min(rowsPerBlock, numRows - firstRow);
+	leastRecentlyUsed.push_front(block);
+	pair<vector<double>, list<unsigned int>::iterator> &entry
+		= cache[block];
+	entry.first = readRows(firstRow, numRowsToRead);
+	entry.second = leastRecentlyUsed.begin();
+
+	return entry.first;
+}
+
+vector<double> LazyLDOS::readRows(
+	unsigned int firstRow,
+	unsigned int numRowsToRead
+) const{
+	vector<double> result(numRowsToRead*sitesPerRow*resolution);
+	try{
+		DataSpace fileDataspace = dataset->getSpace();
+		int rank = fileDataspace.getSimpleExtentNdims();
+		vector<hsize_t> offset(rank, 0);
+		vector<hsize_t> count(rank);
+		fileDataspace.getSimpleExtentDims(count.data(), NULL);
+		if(format == IndexDescriptor::Format::Ranges && rank > 1){
+			offset[0] = firstRow;
+			count[0] = numRowsToRead;
+		}
+		else{
+			offset[0] = firstRow*sitesPerRow*resolution;
+			count[0] = numRowsToRead*sitesPerRow*resolution;
+		}
+		fileDataspace.selectHyperslab(
+			H5S_SELECT_SET,
+			count.data(),
+			offset.data()
+		);
+		hsize_t memoryDims[1] = {result.size()};
+		DataSpace memoryDataspace(1, memoryDims);
+		dataset->read(
+			result.data(),
+			PredType::NATIVE_DOUBLE,
+			memoryDataspace,
+			fileDataspace
+		);
+		memoryDataspace.close();
+		fileDataspace.close();
+	}
+	catch(const DataSetIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::readRows()",
+			"While reading rows " << firstRow << " to "
+			<< firstRow + numRowsToRead << ".",
+			""
+		);
+	}
+	catch(const DataSpaceIException &error){
+		Streams::log << error.getCDetailMsg() << "\n";
+		TBTKExit(
+			"LazyLDOS::readRows()",
+			"While reading rows " << firstRow << " to "
+			<< firstRow + numRowsToRead << ".",
+			""
+		);
+	}
+
+	return result;
+}
+
+};	//End of namespace TBTK
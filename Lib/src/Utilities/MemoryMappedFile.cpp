@@ -0,0 +1,161 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file MemoryMappedFile.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/MemoryMappedFile.h"
+#include "TBTK/TBTKMacros.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace TBTK{
+
+MemoryMappedFile::MemoryMappedFile(
+	const string &filename,
+	size_t size
+) :
+	filename(filename),
+	mode(Mode::ReadWrite),
+	size(size),
+	data(nullptr)
+{
+	fileDescriptor = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	TBTKAssert(
+		fileDescriptor != -1,
+		"MemoryMappedFile::MemoryMappedFile()",
+		"Unable to create the file '" << filename << "'. "
+		<< strerror(errno),
+		""
+	);
+
+	if(ftruncate(fileDescriptor, size) == -1){
+		int error = errno;
+		close(fileDescriptor);
+		TBTKExit(
+			"MemoryMappedFile::MemoryMappedFile()",
+			"Unable to resize the file '" << filename << "' to "
+			<< size << " bytes. " << strerror(error),
+			""
+		);
+	}
+
+	map();
+}
+
+MemoryMappedFile::MemoryMappedFile(
+	const string &filename,
+	Mode mode
+) :
+	filename(filename),
+	mode(mode),
+	data(nullptr)
+{
+	fileDescriptor = open(
+		filename.c_str(),
+		mode == Mode::ReadOnly ? O_RDONLY : O_RDWR
+	);
+	TBTKAssert(
+		fileDescriptor != -1,
+		"MemoryMappedFile::MemoryMappedFile()",
+		"Unable to open the file '" << filename << "'. "
+		<< strerror(errno),
+		""
+	);
+
+	struct stat fileStatus;
+	if(fstat(fileDescriptor, &fileStatus) == -1){
+		int error = errno;
+		close(fileDescriptor);
+		TBTKExit(
+			"MemoryMappedFile::MemoryMappedFile()",
+			"Unable to get the size of the file '" << filename
+			<< "'. " << strerror(error),
+			""
+		);
+	}
+	size = fileStatus.st_size;
+
+	map();
+}
+
+MemoryMappedFile::~MemoryMappedFile(){
+	if(data != nullptr)
+		munmap(data, size);
+	close(fileDescriptor);
+}
+
+char* MemoryMappedFile::getDataRW(){
+	TBTKAssert(
+		mode == Mode::ReadWrite,
+		"MemoryMappedFile::getDataRW()",
+		"The file '" << filename << "' is mapped in read only mode.",
+		""
+	);
+
+	return data;
+}
+
+void MemoryMappedFile::sync(){
+	if(data == nullptr || mode == Mode::ReadOnly)
+		return;
+
+	int result = msync(data, size, MS_SYNC);
+	TBTKAssert(
+		result == 0,
+		"MemoryMappedFile::sync()",
+		"Unable to write the mapped memory to the file '" << filename
+		<< "'. " << strerror(errno),
+		""
+	);
+}
+
+void MemoryMappedFile::map(){
+	//mmap() does not accept zero sized mappings.
+	if(size == 0)
+		return;
+
+	void *address = mmap(
+		nullptr,
+		size,
+		mode == Mode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE,
+		MAP_SHARED,
+		fileDescriptor,
+		0
+	);
+	if(address == MAP_FAILED){
+		int error = errno;
+		close(fileDescriptor);
+		TBTKExit(
+			"MemoryMappedFile::map()",
+			"Unable to map the file '" << filename << "' into"
+			<< " memory. " << strerror(error),
+			""
+		);
+	}
+	data = static_cast<char*>(address);
+}
+
+};	//End of namespace TBTK
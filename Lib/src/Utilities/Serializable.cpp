@@ -23,6 +23,9 @@
 
 #include "TBTK/json.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace std;
 //using namespace nlohmann;
 
@@ -69,6 +72,15 @@ bool Serializable::validate(
 			return false;
 		}
 	}
+	case Mode::Binary:
+	{
+		string serializationID;
+		uint64_t offset;
+		if(!parseBinaryHeader(serialization, serializationID, offset))
+			return false;
+
+		return serializationID.compare(id) == 0;
+	}
 	default:
 		TBTKExit(
 			"Serializable::validate()",
@@ -97,6 +109,13 @@ bool Serializable::hasID(const string &serialization, Mode mode){
 		catch(nlohmann::json::exception e){
 			return false;
 		}
+	case Mode::Binary:
+	{
+		string id;
+		uint64_t offset;
+
+		return parseBinaryHeader(serialization, id, offset);
+	}
 	default:
 		TBTKExit(
 			"Serializable::hasID()",
@@ -134,6 +153,19 @@ string Serializable::getID(const string &serialization, Mode mode){
 				""
 			);
 		}
+	case Mode::Binary:
+	{
+		string id;
+		uint64_t offset;
+		TBTKAssert(
+			parseBinaryHeader(serialization, id, offset),
+			"Serializable::getID()",
+			"Unable to parse binary serialization string.",
+			""
+		);
+
+		return id;
+	}
 	default:
 		TBTKExit(
 			"Serializable::getID()",
@@ -172,10 +204,24 @@ string Serializable::extractComponent(
 				""
 			);
 		}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		TBTKAssert(
+			reader.hasField(componentName),
+			"Serializable::extractComponent()",
+			"Unable to extract component with ID '" << componentID
+			<< "' from the binary serialization string.",
+			""
+		);
+
+		return reader.readString(componentName);
+	}
 	default:
 		TBTKExit(
 			"Serializable::extractComponent()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
@@ -284,13 +330,150 @@ string Serializable::extract(
 				""
 			);
 		}
+	case Mode::Binary:
+	{
+		BinaryReader reader(serialization);
+		TBTKAssert(
+			reader.hasField(component),
+			"Serializable::extract()",
+			"Unable to extract '" << component << "' from binary"
+			<< " serialization string.",
+			""
+		);
+
+		return reader.readString(component);
+	}
 	default:
 		TBTKExit(
 			"Serializable::extract()",
-			"Only Serializable::Mode::JSON is supported yet.",
+			"Only Serializable::Mode::JSON and"
+			<< " Serializable::Mode::Binary are supported yet.",
 			""
 		);
 	}
 }
 
+bool Serializable::parseBinaryHeader(
+	const string &serialization,
+	string &id,
+	uint64_t &offset
+){
+	if(
+		serialization.size() < 12
+		|| serialization.compare(0, 4, "TBTK") != 0
+	){
+		return false;
+	}
+
+	uint32_t byteOrderMark;
+	memcpy(&byteOrderMark, serialization.data() + 4, sizeof(byteOrderMark));
+	if(!isLittleEndian())
+		swapBytes(reinterpret_cast<char*>(&byteOrderMark), 4, 4);
+	if(byteOrderMark != binaryByteOrderMark)
+		return false;
+
+	uint32_t idLength;
+	memcpy(&idLength, serialization.data() + 8, sizeof(idLength));
+	if(!isLittleEndian())
+		swapBytes(reinterpret_cast<char*>(&idLength), 4, 4);
+	if(serialization.size() - 12 < idLength)
+		return false;
+
+	id = serialization.substr(12, idLength);
+	offset = 12 + idLength;
+
+	return true;
+}
+
+void Serializable::swapBytes(char *data, uint64_t size, uint64_t unitSize){
+	for(uint64_t n = 0; n + unitSize <= size; n += unitSize)
+		reverse(data + n, data + n + unitSize);
+}
+
+Serializable::BinaryReader::BinaryReader(
+	const string &serialization
+) :
+	serialization(serialization)
+{
+	uint64_t position;
+	TBTKAssert(
+		parseBinaryHeader(serialization, id, position),
+		"Serializable::BinaryReader::BinaryReader()",
+		"Unable to parse binary serialization string.",
+		""
+	);
+
+	while(position < serialization.size()){
+		uint32_t nameLength;
+		TBTKAssert(
+			serialization.size() - position >= sizeof(nameLength),
+			"Serializable::BinaryReader::BinaryReader()",
+			"Unable to parse binary serialization string with ID '"
+			<< id << "'.",
+			"The serialization string is truncated."
+		);
+		memcpy(
+			&nameLength,
+			serialization.data() + position,
+			sizeof(nameLength)
+		);
+		if(!isLittleEndian())
+			swapBytes(reinterpret_cast<char*>(&nameLength), 4, 4);
+		position += sizeof(nameLength);
+
+		uint64_t size;
+		TBTKAssert(
+			serialization.size() - position
+				>= nameLength + sizeof(size),
+			"Serializable::BinaryReader::BinaryReader()",
+			"Unable to parse binary serialization string with ID '"
+			<< id << "'.",
+			"The serialization string is truncated."
+		);
+		string name = serialization.substr(position, nameLength);
+		position += nameLength;
+		memcpy(&size, serialization.data() + position, sizeof(size));
+		if(!isLittleEndian())
+			swapBytes(reinterpret_cast<char*>(&size), 8, 8);
+		position += sizeof(size);
+		position += (8 - position%8)%8;
+
+		TBTKAssert(
+			position <= serialization.size()
+			&& serialization.size() - position >= size,
+			"Serializable::BinaryReader::BinaryReader()",
+			"Unable to parse binary serialization string with ID '"
+			<< id << "'.",
+			"The serialization string is truncated."
+		);
+		fields[name] = make_pair(position, size);
+		position += size;
+	}
+}
+
+const pair<uint64_t, uint64_t>& Serializable::BinaryReader::getField(
+	const string &name,
+	uint64_t elementSize
+) const{
+	map<string, pair<uint64_t, uint64_t>>::const_iterator iterator
+		= fields.find(name);
+	TBTKAssert(
+		iterator != fields.end(),
+		"Serializable::BinaryReader::getField()",
+		"The binary serialization string with ID '" << id << "' has no"
+		<< " field '" << name << "'.",
+		""
+	);
+	TBTKAssert(
+		iterator->second.second%elementSize == 0,
+		"Serializable::BinaryReader::getField()",
+		"The size of the field '" << name << "' in the binary"
+		<< " serialization string with ID '" << id << "' is"
+		<< " incompatible with the requested type.",
+		""
+	);
+
+	return iterator->second;
+}
+
 };	//End of namespace TBTK
@@ -0,0 +1,447 @@
+/* Copyright 2018 Kristofer Björnson
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file Smooth.cpp
+ *
+ *  @author Kristofer Björnson
+ */
+
+#include "TBTK/Smooth.h"
+
+#ifdef TBTK_FFTW3_ENABLED
+#	include "TBTK/FourierTransform.h"
+#endif
+
+#include <algorithm>
+
+using namespace std;
+
+namespace TBTK{
+
+Array<double> Smooth::gaussian(
+	const Array<double> &data,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+	const vector<unsigned int> &ranges = data.getRanges();
+	TBTKAssert(
+		ranges.size() > 0,
+		"Smooth::gaussian()",
+		"Array must have rank 1 or larger, but the rank is 0.",
+		""
+	);
+
+	Array<double> result(ranges);
+	unsigned int blockSize = ranges.back();
+	convolveGaussian(
+		data.getData(),
+		result.getData(),
+		data.getSize()/blockSize,
+		blockSize,
+		sigma,
+		windowSize
+	);
+
+	return result;
+}
+
+vector<double> Smooth::gaussian(
+	const vector<double> &data,
+	double sigma,
+	int windowSize
+){
+	return gaussian(data.data(), data.size(), sigma, windowSize);
+}
+
+vector<double> Smooth::gaussian(
+	const double *data,
+	unsigned int size,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+
+	vector<double> result(size);
+	if(size != 0)
+		convolveGaussian(data, result.data(), 1, size, sigma, windowSize);
+
+	return result;
+}
+
+Property::DOS Smooth::gaussian(
+	const Property::DOS &dos,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+
+	double lowerBound = dos.getLowerBound();
+	double upperBound = dos.getUpperBound();
+	int resolution = dos.getResolution();
+	double scaledSigma = sigma/(upperBound - lowerBound)*resolution;
+
+	Property::DOS result = dos;
+	convolveGaussian(
+		dos.getDataPointer(),
+		result.getDataRW().data(),
+		1,
+		resolution,
+		scaledSigma,
+		windowSize
+	);
+
+	return result;
+}
+
+Property::LDOS Smooth::gaussian(
+	const Property::LDOS &ldos,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+
+	double lowerBound = ldos.getLowerBound();
+	double upperBound = ldos.getUpperBound();
+	int resolution = ldos.getResolution();
+	double scaledSigma = sigma/(upperBound - lowerBound)*resolution;
+
+	Property::LDOS result = ldos;
+	convolveGaussian(
+		ldos.getDataPointer(),
+		result.getDataRW().data(),
+		ldos.getSize()/resolution,
+		resolution,
+		scaledSigma,
+		windowSize
+	);
+
+	return result;
+}
+
+Property::SpinPolarizedLDOS Smooth::gaussian(
+	const Property::SpinPolarizedLDOS &spinPolarizedLDOS,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+
+	double lowerBound = spinPolarizedLDOS.getLowerBound();
+	double upperBound = spinPolarizedLDOS.getUpperBound();
+	int resolution = spinPolarizedLDOS.getResolution();
+	double scaledSigma = sigma/(upperBound - lowerBound)*resolution;
+
+	Property::SpinPolarizedLDOS result = spinPolarizedLDOS;
+	convolveGaussian(
+		spinPolarizedLDOS.getDataPointer(),
+		result.getDataRW().data(),
+		spinPolarizedLDOS.getSize()/resolution,
+		resolution,
+		scaledSigma,
+		windowSize
+	);
+
+	return result;
+}
+
+Property::SpectralFunction Smooth::gaussian(
+	const Property::SpectralFunction &spectralFunction,
+	double sigma,
+	int windowSize
+){
+	assertValidWindowSize(windowSize);
+
+	double lowerBound = spectralFunction.getLowerBound();
+	double upperBound = spectralFunction.getUpperBound();
+	int resolution = spectralFunction.getResolution();
+	double scaledSigma = sigma/(upperBound - lowerBound)*resolution;
+
+	Property::SpectralFunction result = spectralFunction;
+	convolveGaussian(
+		spectralFunction.getDataPointer(),
+		result.getDataRW().data(),
+		spectralFunction.getSize()/resolution,
+		resolution,
+		scaledSigma,
+		windowSize
+	);
+
+	return result;
+}
+
+Smooth::GaussianKernel::GaussianKernel(
+	double sigma,
+	int windowSize,
+	unsigned int blockSize
+) :
+	weights(windowSize),
+	blockSize(blockSize),
+	useFFT(false),
+	fftSize(0),
+	forwardPlan(nullptr),
+	inversePlan(nullptr)
+{
+	int halfWindow = windowSize/2;
+	double normalization = 0;
+	for(int n = -halfWindow; n <= halfWindow; n++){
+		weights[n + halfWindow] = exp(-n*n/(2*sigma*sigma));
+		normalization += weights[n + halfWindow];
+	}
+	for(unsigned int n = 0; n < weights.size(); n++)
+		weights[n] /= normalization;
+
+#ifdef TBTK_FFTW3_ENABLED
+	//Weights further than blockSize - 1 from the center never multiply
+	//an element in the same block and are dropped, just like in the
+	//direct convolution. Zero padding by at least the remaining half
+	//window ensures that the circular convolution does not wrap around
+	//and that the weights are stored at distinct positions in the buffer.
+	int kernelHalfWindow = min(halfWindow, (int)blockSize - 1);
+	fftSize = 1;
+	unsigned int log2FFTSize = 0;
+	while(fftSize < blockSize + kernelHalfWindow){
+		fftSize *= 2;
+		log2FFTSize++;
+	}
+
+	//The direct convolution requires blockSize*windowSize operations per
+	//block, while the FFT convolution requires of the order
+	//fftSize*log2(fftSize) operations per pair of blocks.
+	useFFT = (unsigned int)windowSize > 8*log2FFTSize;
+	if(!useFFT)
+		return;
+
+	buffer0.resize(fftSize);
+	buffer1.resize(fftSize);
+	FourierTransform::ForwardPlan<complex<double>> *forward
+		= new FourierTransform::ForwardPlan<complex<double>>(
+			buffer0.data(),
+			buffer1.data(),
+			fftSize
+		);
+	FourierTransform::InversePlan<complex<double>> *inverse
+		= new FourierTransform::InversePlan<complex<double>>(
+			buffer1.data(),
+			buffer0.data(),
+			fftSize
+		);
+	forward->setNormalizationFactor(1.);
+	inverse->setNormalizationFactor(1.);
+	forwardPlan = forward;
+	inversePlan = inverse;
+
+	for(unsigned int n = 0; n < fftSize; n++)
+		buffer0[n] = 0.;
+	for(int n = -kernelHalfWindow; n <= kernelHalfWindow; n++)
+		buffer0[(n + fftSize)%fftSize] += weights[n + halfWindow];
+	FourierTransform::transform(*forward);
+
+	//The normalization of the inverse transform is included in the
+	//kernel.
+	kernelTransform.resize(fftSize);
+	for(unsigned int n = 0; n < fftSize; n++)
+		kernelTransform[n] = real(buffer1[n])/fftSize;
+#endif
+}
+
+Smooth::GaussianKernel::~GaussianKernel(){
+#ifdef TBTK_FFTW3_ENABLED
+	if(forwardPlan != nullptr){
+		delete static_cast<
+			FourierTransform::ForwardPlan<complex<double>>*
+		>(forwardPlan);
+	}
+	if(inversePlan != nullptr){
+		delete static_cast<
+			FourierTransform::InversePlan<complex<double>>*
+		>(inversePlan);
+	}
+#endif
+}
+
+void Smooth::GaussianKernel::apply(
+	const double *input0,
+	double *output0,
+	const double *input1,
+	double *output1
+){
+	if(!useFFT){
+		applyDirect(input0, output0);
+		if(input1 != nullptr)
+			applyDirect(input1, output1);
+
+		return;
+	}
+
+#ifdef TBTK_FFTW3_ENABLED
+	//The kernel is real, so two real blocks can be convolved at once by
+	//storing them as the real and imaginary parts of a complex block.
+	for(unsigned int n = 0; n < blockSize; n++){
+		buffer0[n] = complex<double>(
+			input0[n],
+			input1 == nullptr ? 0. : input1[n]
+		);
+	}
+	for(unsigned int n = blockSize; n < fftSize; n++)
+		buffer0[n] = 0.;
+
+	FourierTransform::transform(
+		*static_cast<FourierTransform::ForwardPlan<complex<double>>*>(
+			forwardPlan
+		)
+	);
+	for(unsigned int n = 0; n < fftSize; n++)
+		buffer1[n] *= kernelTransform[n];
+	FourierTransform::transform(
+		*static_cast<FourierTransform::InversePlan<complex<double>>*>(
+			inversePlan
+		)
+	);
+
+	for(unsigned int n = 0; n < blockSize; n++)
+		output0[n] = real(buffer0[n]);
+	if(input1 != nullptr)
+		for(unsigned int n = 0; n < blockSize; n++)
+			output1[n] = imag(buffer0[n]);
+#endif
+}
+
+void Smooth::GaussianKernel::applyDirect(
+	const double *input,
+	double *output
+) const{
+	int halfWindow = weights.size()/2;
+	int size = blockSize;
+	const double *centeredWeights = weights.data() + halfWindow;
+	for(int n = 0; n < size; n++){
+		int begin = max(-halfWindow, -n);
+		int end = min(halfWindow, size - 1 - n);
+		double sum = 0;
+		for(int c = begin; c <= end; c++)
+			sum += centeredWeights[c]*input[n + c];
+		output[n] = sum;
+	}
+}
+
+void Smooth::convolveGaussian(
+	const double *input,
+	double *output,
+	unsigned int numBlocks,
+	unsigned int blockSize,
+	double sigma,
+	int windowSize
+){
+	#pragma omp parallel
+	{
+		GaussianKernel kernel(sigma, windowSize, blockSize);
+
+		#pragma omp for
+		for(int n = 0; n < (int)(numBlocks + 1)/2; n++){
+			size_t offset0 = (size_t)2*n*blockSize;
+			size_t offset1 = offset0 + blockSize;
+			if(2*n + 1 < (int)numBlocks){
+				kernel.apply(
+					input + offset0,
+					output + offset0,
+					input + offset1,
+					output + offset1
+				);
+			}
+			else{
+				kernel.apply(input + offset0, output + offset0);
+			}
+		}
+	}
+}
+
+void Smooth::convolveGaussian(
+	const SpinMatrix *input,
+	SpinMatrix *output,
+	unsigned int numBlocks,
+	unsigned int blockSize,
+	double sigma,
+	int windowSize
+){
+	#pragma omp parallel
+	{
+		GaussianKernel kernel(sigma, windowSize, blockSize);
+
+		//The real and imaginary parts of the four matrix elements are
+		//stored as eight consecutive channels.
+		vector<double> inputChannels(8*blockSize);
+		vector<double> outputChannels(8*blockSize);
+
+		#pragma omp for
+		for(int block = 0; block < (int)numBlocks; block++){
+			const SpinMatrix *blockInput
+				= input + (size_t)block*blockSize;
+			SpinMatrix *blockOutput
+				= output + (size_t)block*blockSize;
+
+			for(unsigned int n = 0; n < blockSize; n++){
+				for(unsigned int c = 0; c < 4; c++){
+					const complex<double> &element
+						= blockInput[n].at(c/2, c%2);
+					inputChannels[2*c*blockSize + n]
+						= real(element);
+					inputChannels[(2*c + 1)*blockSize + n]
+						= imag(element);
+				}
+			}
+
+			for(unsigned int c = 0; c < 4; c++){
+				kernel.apply(
+					&inputChannels[2*c*blockSize],
+					&outputChannels[2*c*blockSize],
+					&inputChannels[(2*c + 1)*blockSize],
+					&outputChannels[(2*c + 1)*blockSize]
+				);
+			}
+
+			for(unsigned int n = 0; n < blockSize; n++){
+				for(unsigned int c = 0; c < 4; c++){
+					blockOutput[n].at(c/2, c%2)
+						= complex<double>(
+							outputChannels[
+								2*c*blockSize
+								+ n
+							],
+							outputChannels[
+								(2*c + 1)
+								*blockSize + n
+							]
+						);
+				}
+			}
+		}
+	}
+}
+
+void Smooth::assertValidWindowSize(int windowSize){
+	TBTKAssert(
+		windowSize > 0,
+		"Smooth::gaussian()",
+		"'windowSize' must be larger than zero.",
+		""
+	);
+	TBTKAssert(
+		windowSize%2 == 1,
+		"Smooth::gaussian()",
+		"'windowSize' must be odd.",
+		""
+	);
+}
+
+};	//End of namespace TBTK
@@ -0,0 +1,185 @@
+#include "TBTK/Model.h"
+#include "TBTK/ModelFactory.h"
+#include "TBTK/NeighborIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace TBTK{
+
+//Sites on a strongly skewed lattice with two sites per unit cell. The
+//periodic vectors are {3*a0, 3*a1}, where a1 is nearly parallel to a0. Sites
+//that are separated by large multiples of the periodic vectors are
+//therefore close to each other, which requires translations that are
+//larger than the bounding box divided by the length of the periodic vectors.
+class NeighborIndexSkewedLattice{
+public:
+	NeighborIndexSkewedLattice(){
+		for(int x = 0; x < 3; x++){
+			for(int y = 0; y < 3; y++){
+				for(int s = 0; s < 2; s++){
+					model << HoppingAmplitude(
+						100,
+						{x, y, s},
+						{x, y, s}
+					);
+				}
+			}
+		}
+		model.construct();
+		model.createGeometry(2);
+		Geometry *geometry = model.getGeometry();
+		for(int x = 0; x < 3; x++){
+			for(int y = 0; y < 3; y++){
+				for(int s = 0; s < 2; s++){
+					geometry->setCoordinates(
+						{x, y, s},
+						{
+							x + 10.*y + 0.37*s,
+							0.5*y + 0.21*s
+						}
+					);
+				}
+			}
+		}
+		periodicVectors = {
+			Vector3d({3., 0., 0.}),
+			Vector3d({30., 1.5, 0.})
+		};
+		cutoff = 1.63;
+	}
+
+	//Brute force O(N^2) search that returns all tuples (to, from, dx, dy)
+	//for which the periodic image of 'to' is within the cutoff from
+	//'from', with the displacements rounded to avoid rounding errors.
+	std::vector<std::tuple<int, int, long, long>> bruteForce(){
+		const Geometry *geometry = model.getGeometry();
+		std::vector<std::tuple<int, int, long, long>> result;
+		for(int from = 0; from < model.getBasisSize(); from++){
+			for(int to = 0; to < model.getBasisSize(); to++){
+				const double *r0 = geometry->getCoordinates(from);
+				const double *r1 = geometry->getCoordinates(to);
+				for(int m0 = -300; m0 <= 300; m0++){
+					for(int m1 = -30; m1 <= 30; m1++){
+						if(to == from && m0 == 0 && m1 == 0)
+							continue;
+
+						Vector3d t = m0*periodicVectors[0]
+							+ m1*periodicVectors[1];
+						double dx = r1[0] + t.x - r0[0];
+						double dy = r1[1] + t.y - r0[1];
+						if(dx*dx + dy*dy > cutoff*cutoff)
+							continue;
+
+						result.push_back(
+							std::make_tuple(
+								to,
+								from,
+								std::lround(1e6*dx),
+								std::lround(1e6*dy)
+							)
+						);
+					}
+				}
+			}
+		}
+		std::sort(result.begin(), result.end());
+
+		return result;
+	}
+
+	Model model;
+	std::vector<Vector3d> periodicVectors;
+	double cutoff;
+};
+
+TEST(NeighborIndex, getNeighborsSkewedPeriodicVectors){
+	NeighborIndexSkewedLattice lattice;
+	std::vector<std::tuple<int, int, long, long>> expected
+		= lattice.bruteForce();
+	ASSERT_GT(expected.size(), 0);
+
+	NeighborIndex neighborIndex(
+		*lattice.model.getGeometry(),
+		lattice.cutoff,
+		lattice.periodicVectors
+	);
+	std::vector<std::tuple<int, int, long, long>> result;
+	for(int from = 0; from < lattice.model.getBasisSize(); from++){
+		std::vector<NeighborIndex::Neighbor> neighbors
+			= neighborIndex.getNeighbors(from);
+		for(unsigned int n = 0; n < neighbors.size(); n++){
+			result.push_back(
+				std::make_tuple(
+					neighbors[n].basisIndex,
+					from,
+					std::lround(1e6*neighbors[n].displacement.x),
+					std::lround(1e6*neighbors[n].displacement.y)
+				)
+			);
+		}
+	}
+	std::sort(result.begin(), result.end());
+
+	EXPECT_EQ(result, expected);
+}
+
+TEST(NeighborIndex, ModelFactoryAddHoppingAmplitudesWithinCutoff){
+	NeighborIndexSkewedLattice lattice;
+	std::vector<std::tuple<int, int, long, long>> expected
+		= lattice.bruteForce();
+
+	//Encode the displacement in the amplitude.
+	ModelFactory::addHoppingAmplitudesWithinCutoff(
+		&lattice.model,
+		lattice.cutoff,
+		[](
+			const Index &toIndex,
+			const Index &fromIndex,
+			const Vector3d &displacement
+		){
+			return std::complex<double>(
+				displacement.x,
+				displacement.y
+			);
+		},
+		lattice.periodicVectors
+	);
+
+	std::vector<std::tuple<int, int, long, long>> result;
+	const HoppingAmplitudeSet &hoppingAmplitudeSet
+		= lattice.model.getHoppingAmplitudeSet();
+	for(
+		HoppingAmplitudeSet::ConstIterator iterator
+			= hoppingAmplitudeSet.cbegin();
+		iterator != hoppingAmplitudeSet.cend();
+		++iterator
+	){
+		std::complex<double> amplitude = (*iterator).getAmplitude();
+		//Skip the on-site amplitudes used to set up the Model.
+		if(real(amplitude) == 100)
+			continue;
+
+		result.push_back(
+			std::make_tuple(
+				lattice.model.getBasisIndex(
+					(*iterator).getToIndex()
+				),
+				lattice.model.getBasisIndex(
+					(*iterator).getFromIndex()
+				),
+				std::lround(1e6*real(amplitude)),
+				std::lround(1e6*imag(amplitude))
+			)
+		);
+	}
+	std::sort(result.begin(), result.end());
+
+	EXPECT_EQ(result, expected);
+}
+
+};
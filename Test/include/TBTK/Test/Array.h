@@ -0,0 +1,313 @@
+#include "TBTK/Array.h"
+
+#include "gtest/gtest.h"
+
+#include <complex>
+
+namespace TBTK{
+
+//Create an Array with the ranges {2, 3, 4} and the elements
+//{a, b, c} = offset + 12*a + 4*b + c.
+Array<double> createTestArray(double offset = 0){
+	Array<double> array({2, 3, 4});
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int b = 0; b < 3; b++)
+			for(unsigned int c = 0; c < 4; c++)
+				array[{a, b, c}] = offset + 12*a + 4*b + c;
+
+	return array;
+}
+
+TEST(Array, Constructor){
+	Array<double> array0;
+	EXPECT_EQ(array0.getSize(), 0);
+	EXPECT_EQ(array0.getRanges().size(), 0);
+
+	Array<double> array1({2, 3, 4}, 7);
+	ASSERT_EQ(array1.getSize(), 24);
+	ASSERT_EQ(array1.getRanges().size(), 3);
+	EXPECT_EQ(array1.getRanges()[0], 2);
+	EXPECT_EQ(array1.getRanges()[1], 3);
+	EXPECT_EQ(array1.getRanges()[2], 4);
+	for(unsigned int n = 0; n < array1.getSize(); n++)
+		EXPECT_DOUBLE_EQ(array1[n], 7);
+
+	//Zero ranges are not allowed.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			Array<double> array({2, 0});
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Array, Expressions){
+	Array<double> a = createTestArray(1);
+	Array<double> b = createTestArray(2);
+	Array<double> c = createTestArray(3);
+
+	//Mixed expressions are evaluated element-wise.
+	Array<double> result = a + 2.*b - c/4. + b*3.;
+	ASSERT_EQ(result.getRanges(), a.getRanges());
+	for(unsigned int n = 0; n < result.getSize(); n++){
+		double expected = (n + 1) + 2*(n + 2) - (n + 3)/4. + 3*(n + 2);
+		EXPECT_DOUBLE_EQ(result[n], expected);
+	}
+
+	//Expressions with complex elements.
+	Array<std::complex<double>> z0({2}, std::complex<double>(1, 2));
+	Array<std::complex<double>> z1({2}, std::complex<double>(0, 1));
+	Array<std::complex<double>> z2
+		= std::complex<double>(0, 1)*z0 - z1/std::complex<double>(2, 0);
+	for(unsigned int n = 0; n < 2; n++){
+		EXPECT_DOUBLE_EQ(real(z2[n]), -2);
+		EXPECT_DOUBLE_EQ(imag(z2[n]), 0.5);
+	}
+
+	//Incompatible ranges.
+	Array<double> d({2, 3, 5}, 0);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			Array<double> e = a + d;
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Array, CompoundAssignment){
+	Array<double> a = createTestArray(1);
+	Array<double> b = createTestArray(2);
+
+	a += b;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], 2*n + 3);
+
+	a -= 2.*b;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], -1.);
+
+	a += b - b/2.;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], -1 + (n + 2)/2.);
+
+	a *= 4.;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], -4 + 2.*(n + 2));
+
+	a /= 2.;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], -2 + (n + 2.));
+
+	//Aliasing.
+	a += a;
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], 2.*n);
+
+	//Incompatible ranges.
+	Array<double> c({2, 3, 5}, 0);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			a += c;
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Array, getStrides){
+	Array<double> array = createTestArray();
+	std::vector<unsigned int> strides = array.getStrides();
+	ASSERT_EQ(strides.size(), 3);
+	EXPECT_EQ(strides[0], 12);
+	EXPECT_EQ(strides[1], 4);
+	EXPECT_EQ(strides[2], 1);
+	for(unsigned int a = 0; a < 2; a++){
+		for(unsigned int b = 0; b < 3; b++){
+			for(unsigned int c = 0; c < 4; c++){
+				EXPECT_DOUBLE_EQ(
+					array.getData()[
+						strides[0]*a + strides[1]*b
+						+ strides[2]*c
+					],
+					(array[{a, b, c}])
+				);
+			}
+		}
+	}
+}
+
+TEST(Array, getSlice){
+	Array<double> array = createTestArray();
+
+	Array<double> slice0 = array.getSlice({1, IDX_ALL, 2});
+	ASSERT_EQ(slice0.getRanges().size(), 1);
+	EXPECT_EQ(slice0.getRanges()[0], 3);
+	for(unsigned int b = 0; b < 3; b++)
+		EXPECT_DOUBLE_EQ(slice0[b], 12 + 4*b + 2);
+
+	Array<double> slice1 = array.getSlice({IDX_ALL, 1, IDX_ALL});
+	ASSERT_EQ(slice1.getRanges().size(), 2);
+	EXPECT_EQ(slice1.getRanges()[0], 2);
+	EXPECT_EQ(slice1.getRanges()[1], 4);
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_DOUBLE_EQ((slice1[{a, c}]), 12*a + 4 + c);
+
+	//The slice is a copy.
+	slice1[{0, 0}] = -1;
+	EXPECT_DOUBLE_EQ((array[{0, 1, 0}]), 4);
+
+	//Invalid indices.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			array.getSlice({0, 1});
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			array.getSlice({0, 3, 0});
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			array.getSlice({0, -2, 0});
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Array, getSliceView){
+	Array<double> array = createTestArray();
+
+	ArraySlice<double> view = array.getSliceView({IDX_ALL, 2, IDX_ALL});
+	ASSERT_EQ(view.getRanges().size(), 2);
+	EXPECT_EQ(view.getRanges()[0], 2);
+	EXPECT_EQ(view.getRanges()[1], 4);
+	EXPECT_EQ(view.getStrides()[0], 12);
+	EXPECT_EQ(view.getStrides()[1], 1);
+	EXPECT_EQ(view.getSize(), 8);
+	EXPECT_EQ(view.getData(), array.getData() + 8);
+	for(unsigned int a = 0; a < 2; a++){
+		for(unsigned int c = 0; c < 4; c++){
+			EXPECT_DOUBLE_EQ((view[{a, c}]), 12*a + 8 + c);
+			EXPECT_DOUBLE_EQ(view[4*a + c], 12*a + 8 + c);
+		}
+	}
+
+	//The view refers to the elements of the Array.
+	view[{1, 3}] = -1;
+	EXPECT_DOUBLE_EQ((array[{1, 2, 3}]), -1);
+	view *= 2.;
+	EXPECT_DOUBLE_EQ((array[{1, 2, 3}]), -2);
+	EXPECT_DOUBLE_EQ((array[{0, 2, 0}]), 16);
+	EXPECT_DOUBLE_EQ((array[{0, 1, 0}]), 4);
+	view /= 2.;
+	EXPECT_DOUBLE_EQ((array[{0, 2, 0}]), 8);
+
+	//Assignment to a view writes to the Array.
+	Array<double> other = array.getSlice({IDX_ALL, 0, IDX_ALL});
+	view = other;
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_DOUBLE_EQ((array[{a, 2, c}]), 12*a + c);
+	view += 2.*other;
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_DOUBLE_EQ((array[{a, 2, c}]), 3*(12*a + c));
+	view -= other;
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_DOUBLE_EQ((array[{a, 2, c}]), 2*(12*a + c));
+
+	//Views can be used in expressions.
+	Array<double> sum = array.getSliceView({IDX_ALL, 0, IDX_ALL})
+		+ array.getSliceView({IDX_ALL, 1, IDX_ALL});
+	ASSERT_EQ(sum.getSize(), 8);
+	for(unsigned int a = 0; a < 2; a++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_DOUBLE_EQ((sum[{a, c}]), 2*(12*a + c) + 4);
+
+	//Const views.
+	const Array<double> &constArray = array;
+	ArraySlice<const double> constView
+		= constArray.getSliceView({0, IDX_ALL, IDX_ALL});
+	EXPECT_EQ(constView.getSize(), 12);
+	EXPECT_DOUBLE_EQ((constView[{1, 3}]), 7);
+
+	//Incompatible ranges.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			view = array.getSliceView({0, IDX_ALL, IDX_ALL});
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Array, Assignment){
+	//In place assignment with the same ranges.
+	Array<double> a = createTestArray(1);
+	Array<double> b = createTestArray(2);
+	const double *data = a.getData();
+	a = b/2.;
+	EXPECT_EQ(a.getData(), data);
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], (n + 2)/2.);
+
+	//Aliasing with the same ranges.
+	a = a + a;
+	EXPECT_EQ(a.getData(), data);
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], n + 2.);
+	a = 3.*a - a/2.;
+	EXPECT_EQ(a.getData(), data);
+	for(unsigned int n = 0; n < a.getSize(); n++)
+		EXPECT_DOUBLE_EQ(a[n], 2.5*(n + 2));
+
+	//Reallocating assignment with different ranges.
+	Array<double> c({5}, 1);
+	c = a + b;
+	ASSERT_EQ(c.getRanges(), a.getRanges());
+	ASSERT_EQ(c.getSize(), 24);
+	for(unsigned int n = 0; n < c.getSize(); n++)
+		EXPECT_DOUBLE_EQ(c[n], 3.5*(n + 2));
+
+	//Aliasing with different ranges.
+	c = 2.*c.getSliceView({1, IDX_ALL, IDX_ALL});
+	ASSERT_EQ(c.getRanges().size(), 2);
+	EXPECT_EQ(c.getRanges()[0], 3);
+	EXPECT_EQ(c.getRanges()[1], 4);
+	for(unsigned int n = 0; n < c.getSize(); n++)
+		EXPECT_DOUBLE_EQ(c[n], 7*(n + 14.));
+
+	//Copy and move assignment.
+	Array<double> d;
+	d = b;
+	EXPECT_NE(d.getData(), b.getData());
+	for(unsigned int n = 0; n < d.getSize(); n++)
+		EXPECT_DOUBLE_EQ(d[n], n + 2);
+	const double *bData = b.getData();
+	d = std::move(b);
+	EXPECT_EQ(d.getData(), bData);
+	for(unsigned int n = 0; n < d.getSize(); n++)
+		EXPECT_DOUBLE_EQ(d[n], n + 2);
+	d = d;
+	EXPECT_EQ(d.getData(), bData);
+	EXPECT_DOUBLE_EQ(d[5], 7);
+}
+
+};	//End of namespace TBTK
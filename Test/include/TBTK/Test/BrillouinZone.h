@@ -0,0 +1,169 @@
+#include "TBTK/BrillouinZone.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace TBTK{
+
+const double EPSILON_100 = 100*std::numeric_limits<double>::epsilon();
+
+//Returns the symmetry operations rounded to integers and stored as
+//{M(0, 0), M(0, 1), M(1, 0), M(1, 1)}, after checking that every element
+//is 0 or +-1.
+std::set<std::vector<int>> getIntegerSymmetryOperations2D(
+	const BrillouinZone &brillouinZone
+){
+	const std::vector<Matrix<double>> &symmetryOperations
+		= brillouinZone.getSymmetryOperations();
+
+	std::set<std::vector<int>> result;
+	for(unsigned int n = 0; n < symmetryOperations.size(); n++){
+		EXPECT_EQ(symmetryOperations[n].getNumRows(), 2);
+		EXPECT_EQ(symmetryOperations[n].getNumCols(), 2);
+		std::vector<int> operation;
+		for(unsigned int row = 0; row < 2; row++){
+			for(unsigned int col = 0; col < 2; col++){
+				double element = symmetryOperations[n].at(row, col);
+				operation.push_back((int)std::round(element));
+				EXPECT_NEAR(element, operation.back(), EPSILON_100);
+			}
+		}
+		result.insert(operation);
+	}
+
+	return result;
+}
+
+TEST(BrillouinZone, DetectSymmetryOperationsSquare){
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, 2*M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	brillouinZone.detectSymmetryOperations();
+
+	//The point group of the square lattice is C4v, which consists of the
+	//identity, the rotations by 90, 180, and 270 degrees, and the
+	//reflections in the x- and y-axes and the two diagonals.
+	std::set<std::vector<int>> C4v = {
+		{1, 0, 0, 1},
+		{0, -1, 1, 0},
+		{-1, 0, 0, -1},
+		{0, 1, -1, 0},
+		{1, 0, 0, -1},
+		{-1, 0, 0, 1},
+		{0, 1, 1, 0},
+		{0, -1, -1, 0}
+	};
+	EXPECT_EQ(brillouinZone.getSymmetryOperations().size(), 8);
+	EXPECT_EQ(getIntegerSymmetryOperations2D(brillouinZone), C4v);
+
+	//The first operation is the identity.
+	const Matrix<double> &identity
+		= brillouinZone.getSymmetryOperations()[0];
+	EXPECT_NEAR(identity.at(0, 0), 1, EPSILON_100);
+	EXPECT_NEAR(identity.at(0, 1), 0, EPSILON_100);
+	EXPECT_NEAR(identity.at(1, 0), 0, EPSILON_100);
+	EXPECT_NEAR(identity.at(1, 1), 1, EPSILON_100);
+}
+
+TEST(BrillouinZone, DetectSymmetryOperationsRectangular){
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	brillouinZone.detectSymmetryOperations();
+
+	//The point group of the rectangular lattice is C2v.
+	std::set<std::vector<int>> C2v = {
+		{1, 0, 0, 1},
+		{-1, 0, 0, -1},
+		{1, 0, 0, -1},
+		{-1, 0, 0, 1}
+	};
+	EXPECT_EQ(brillouinZone.getSymmetryOperations().size(), 4);
+	EXPECT_EQ(getIntegerSymmetryOperations2D(brillouinZone), C2v);
+}
+
+TEST(BrillouinZone, DetectSymmetryOperationsHexagonal){
+	BrillouinZone brillouinZone(
+		{{1, 0}, {1/2., sqrt(3)/2}},
+		SpacePartition::MeshType::Nodal
+	);
+	brillouinZone.detectSymmetryOperations();
+
+	//The point group of the hexagonal lattice is C6v.
+	EXPECT_EQ(brillouinZone.getSymmetryOperations().size(), 12);
+}
+
+TEST(BrillouinZone, getIrreducibleMesh){
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, 2*M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	std::vector<unsigned int> numMeshPoints = {12, 12};
+	std::vector<std::vector<double>> mesh
+		= brillouinZone.getMinorMesh(numMeshPoints);
+
+	//Without symmetry reduction every mesh point is irreducible.
+	BrillouinZone::IrreducibleMesh fullMesh
+		= brillouinZone.getIrreducibleMesh(numMeshPoints);
+	EXPECT_EQ(fullMesh.getNumMeshPoints(), mesh.size());
+	EXPECT_EQ(fullMesh.getNumPoints(), mesh.size());
+
+	brillouinZone.detectSymmetryOperations();
+	BrillouinZone::IrreducibleMesh irreducibleMesh
+		= brillouinZone.getIrreducibleMesh(numMeshPoints);
+	ASSERT_EQ(irreducibleMesh.getNumMeshPoints(), mesh.size());
+	EXPECT_LT(irreducibleMesh.getNumPoints(), mesh.size()/4);
+
+	//The weights sum to the full mesh size when multiplied by the number
+	//of mesh points and every irreducible point represents as many mesh
+	//points as its weight says.
+	std::vector<unsigned int> multiplicities(
+		irreducibleMesh.getNumPoints(),
+		0
+	);
+	for(unsigned int n = 0; n < mesh.size(); n++)
+		multiplicities[irreducibleMesh.getIrreduciblePoint(n)]++;
+	double weightSum = 0;
+	for(unsigned int n = 0; n < irreducibleMesh.getNumPoints(); n++){
+		weightSum += irreducibleMesh.getWeight(n);
+		EXPECT_NEAR(
+			irreducibleMesh.getWeight(n)*mesh.size(),
+			multiplicities[n],
+			EPSILON_100*mesh.size()
+		);
+	}
+	EXPECT_NEAR(weightSum*mesh.size(), mesh.size(), EPSILON_100*mesh.size());
+
+	//Every mesh point is the image of its irreducible point under its
+	//symmetry operation, modulo reciprocal lattice vectors.
+	const std::vector<Matrix<double>> &symmetryOperations
+		= brillouinZone.getSymmetryOperations();
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		const std::vector<double> &k = mesh[
+			irreducibleMesh.getPoint(
+				irreducibleMesh.getIrreduciblePoint(n)
+			)
+		];
+		const Matrix<double> &R = symmetryOperations[
+			irreducibleMesh.getSymmetryOperation(n)
+		];
+		for(unsigned int row = 0; row < 2; row++){
+			double Rk = 0;
+			for(unsigned int col = 0; col < 2; col++)
+				Rk += R.at(row, col)*k[col];
+			double difference = (Rk - mesh[n][row])/(2*M_PI);
+			EXPECT_NEAR(
+				difference,
+				std::round(difference),
+				EPSILON_100
+			);
+		}
+	}
+}
+
+};
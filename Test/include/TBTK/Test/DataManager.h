@@ -0,0 +1,218 @@
+#include "TBTK/DataManager.h"
+#include "TBTK/Property/DOS.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace TBTK{
+
+//Create an empty temporary directory.
+std::string createDataManagerTestDirectory(){
+	char directory[] = "/tmp/TBTKTestDataManagerXXXXXX";
+	EXPECT_TRUE(mkdtemp(directory) != nullptr);
+
+	return std::string(directory) + "/";
+}
+
+//Remove a temporary directory and the files in it.
+void removeDataManagerTestDirectory(const std::string &directory){
+	DIR *dir = opendir(directory.c_str());
+	if(dir == nullptr)
+		return;
+
+	struct dirent *entry;
+	while((entry = readdir(dir)) != nullptr){
+		std::string name = entry->d_name;
+		if(name.compare(".") != 0 && name.compare("..") != 0)
+			remove((directory + name).c_str());
+	}
+	closedir(dir);
+	rmdir(directory.c_str());
+}
+
+TEST(DataManager, Journal){
+	std::string directory = createDataManagerTestDirectory();
+	std::string journal = directory + "journal";
+
+	DataManager dataManager0({0}, {1}, {4}, {"x"});
+	dataManager0.addDataType("A", DataManager::FileType::Custom);
+	dataManager0.setJournal(journal);
+	EXPECT_EQ(dataManager0.reserveDataPoint("A"), 0);
+	EXPECT_EQ(dataManager0.reserveDataPoint("A"), 1);
+	dataManager0.markCompleted("A", 0);
+
+	//A second DataManager replaying the journal skips the completed data
+	//point and the data point that is reserved by a running process.
+	DataManager dataManager1({0}, {1}, {4}, {"x"});
+	dataManager1.addDataType("A", DataManager::FileType::Custom);
+	dataManager1.setJournal(journal);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 2);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 3);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), -1);
+
+	//Reservations and completions made by the second DataManager are
+	//seen by the first.
+	dataManager1.markCompleted("A", 2);
+	EXPECT_EQ(dataManager0.reserveDataPoint("A"), -1);
+	dataManager0.markCompleted("A", 1);
+	dataManager1.markCompleted("A", 3);
+
+	//A restarted sweep finds every data point completed.
+	DataManager dataManager2({0}, {1}, {4}, {"x"});
+	dataManager2.addDataType("A", DataManager::FileType::Custom);
+	dataManager2.setJournal(journal);
+	EXPECT_EQ(dataManager2.reserveDataPoint("A"), -1);
+
+	removeDataManagerTestDirectory(directory);
+}
+
+TEST(DataManager, JournalStaleReservation){
+	std::string directory = createDataManagerTestDirectory();
+	std::string journal = directory + "journal";
+
+	//Reserve a data point from a process that exits without completing
+	//it.
+	pid_t processID = fork();
+	ASSERT_NE(processID, -1);
+	if(processID == 0){
+		DataManager dataManager({0}, {1}, {4}, {"x"});
+		dataManager.addDataType("A", DataManager::FileType::Custom);
+		dataManager.setJournal(journal);
+		_exit(dataManager.reserveDataPoint("A") == 0 ? 0 : 1);
+	}
+	int status;
+	ASSERT_EQ(waitpid(processID, &status, 0), processID);
+	ASSERT_TRUE(WIFEXITED(status));
+	ASSERT_EQ(WEXITSTATUS(status), 0);
+
+	//The reservation of the process that no longer is running is
+	//re-issued.
+	DataManager dataManager0({0}, {1}, {4}, {"x"});
+	dataManager0.addDataType("A", DataManager::FileType::Custom);
+	dataManager0.setJournal(journal);
+	EXPECT_EQ(dataManager0.reserveDataPoint("A"), 0);
+
+	//Reservations that have timed out are re-issued.
+	DataManager dataManager1({0}, {1}, {4}, {"x"});
+	dataManager1.addDataType("A", DataManager::FileType::Custom);
+	dataManager1.setJournal(journal, 0.2);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 1);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 2);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 3);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), -1);
+	usleep(400000);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 0);
+
+	//Renewed reservations are kept.
+	dataManager0.renewReservation("A", 1);
+	EXPECT_EQ(dataManager1.reserveDataPoint("A"), 2);
+
+	removeDataManagerTestDirectory(directory);
+}
+
+//Store a DOS for every data point using DataManager::complete() and check
+//that the results can be read back, both from the DataManager that wrote
+//them and from a new DataManager using the same path.
+void testDataManagerRoundTrip(DataManager::FileType fileType){
+	std::string directory = createDataManagerTestDirectory();
+
+	DataManager dataManager0({0}, {1}, {10}, {"x"}, "DataManager");
+	dataManager0.setPath(directory);
+	dataManager0.addDataType("DOS", fileType);
+	dataManager0.setBatchSize(4);
+	int id;
+	while((id = dataManager0.reserveDataPoint("DOS")) != -1){
+		double data[3] = {(double)id, sqrt(2.)*id, 1/3.};
+		dataManager0.complete(
+			Property::DOS(-1, 1, 3, data),
+			"DOS",
+			id
+		);
+	}
+	//Results written in a later batch replace earlier results.
+	double data[3] = {-1, -2, -3};
+	dataManager0.complete(Property::DOS(-1, 1, 3, data), "DOS", 5);
+	dataManager0.close();
+
+	DataManager dataManager1({0}, {1}, {10}, {"x"}, "DataManager");
+	dataManager1.setPath(directory);
+	dataManager1.addDataType("DOS", fileType);
+	for(unsigned int n = 0; n < 10; n++){
+		for(unsigned int c = 0; c < 2; c++){
+			DataManager &dataManager
+				= (c == 0 ? dataManager0 : dataManager1);
+			Property::DOS dos(
+				dataManager.getSerialization("DOS", n),
+				dataManager.getSerializationMode("DOS")
+			);
+			ASSERT_EQ(dos.getResolution(), 3);
+			if(n == 5){
+				EXPECT_EQ(dos(0), -1);
+				EXPECT_EQ(dos(1), -2);
+				EXPECT_EQ(dos(2), -3);
+			}
+			else{
+				EXPECT_EQ(dos(0), n);
+				EXPECT_EQ(dos(1), sqrt(2.)*n);
+				EXPECT_EQ(dos(2), 1/3.);
+			}
+		}
+	}
+
+	removeDataManagerTestDirectory(directory);
+}
+
+TEST(DataManager, RoundTripBinary){
+	testDataManagerRoundTrip(DataManager::FileType::SerializableBinary);
+
+	//The record headers are stored in little-endian byte order.
+	std::string directory = createDataManagerTestDirectory();
+	DataManager dataManager({0}, {1}, {300}, {"x"}, "DataManager");
+	dataManager.setPath(directory);
+	dataManager.addDataType(
+		"DOS",
+		DataManager::FileType::SerializableBinary
+	);
+	double data[3] = {1, 2, 3};
+	dataManager.complete(Property::DOS(-1, 1, 3, data), "DOS", 258);
+	dataManager.close();
+
+	std::string serialization = dataManager.getSerialization("DOS", 258);
+	std::ifstream fin(
+		directory + dataManager.getFilename("DOS", 258),
+		std::ios::binary
+	);
+	unsigned char header[16];
+	fin.read((char*)header, sizeof(header));
+	ASSERT_TRUE((bool)fin);
+	EXPECT_EQ(header[0], 2);
+	EXPECT_EQ(header[1], 1);
+	for(unsigned int n = 2; n < 8; n++)
+		EXPECT_EQ(header[n], 0);
+	for(unsigned int n = 0; n < 8; n++){
+		EXPECT_EQ(
+			header[8 + n],
+			(serialization.size() >> 8*n) & 0xFF
+		);
+	}
+	fin.close();
+
+	removeDataManagerTestDirectory(directory);
+}
+
+#ifdef TBTK_HDF5_ENABLED
+TEST(DataManager, RoundTripHDF5){
+	testDataManagerRoundTrip(DataManager::FileType::SerializableHDF5);
+}
+#endif
+
+};
@@ -0,0 +1,259 @@
+#include "TBTK/EnergyMesh.h"
+#include "TBTK/Streams.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace TBTK{
+
+const double EPSILON_100 = 100*std::numeric_limits<double>::epsilon();
+
+//Check that the energies are strictly increasing.
+void checkStrictlyIncreasing(const std::vector<double> &mesh){
+	for(unsigned int n = 1; n < mesh.size(); n++)
+		EXPECT_LT(mesh[n-1], mesh[n]);
+}
+
+//Check that the Matsubara energy indices are strictly increasing, include
+//the bounds, have the parity of the bounds, and are mirrored around zero
+//inside the range that is symmetric around zero.
+void checkSparseMatsubaraEnergyIndices(
+	const std::vector<int> &indices,
+	int lowerMatsubaraEnergyIndex,
+	int upperMatsubaraEnergyIndex
+){
+	ASSERT_GT(indices.size(), 0);
+	EXPECT_EQ(indices.front(), lowerMatsubaraEnergyIndex);
+	EXPECT_EQ(indices.back(), upperMatsubaraEnergyIndex);
+	for(unsigned int n = 1; n < indices.size(); n++)
+		EXPECT_LT(indices[n-1], indices[n]);
+
+	int parity = abs(lowerMatsubaraEnergyIndex%2);
+	int symmetricBound = std::min(
+		abs(lowerMatsubaraEnergyIndex),
+		abs(upperMatsubaraEnergyIndex)
+	);
+	for(unsigned int n = 0; n < indices.size(); n++){
+		EXPECT_EQ(abs(indices[n]%2), parity);
+		if(
+			abs(indices[n]) < symmetricBound
+			|| (
+				abs(indices[n]) == symmetricBound
+				&& lowerMatsubaraEnergyIndex
+					== -upperMatsubaraEnergyIndex
+			)
+		){
+			EXPECT_TRUE(
+				std::binary_search(
+					indices.begin(),
+					indices.end(),
+					-indices[n]
+				)
+			);
+		}
+	}
+}
+
+TEST(EnergyMesh, generateLogarithmicMesh){
+	std::vector<double> mesh
+		= EnergyMesh::generateLogarithmicMesh(-5, 5, 0.3, 1e-3, 8);
+	ASSERT_EQ(mesh.size(), 17);
+	checkStrictlyIncreasing(mesh);
+	EXPECT_EQ(mesh.front(), -5);
+	EXPECT_EQ(mesh[8], 0.3);
+	EXPECT_EQ(mesh.back(), 5);
+	EXPECT_NEAR(mesh[7], 0.3 - 1e-3, EPSILON_100);
+	EXPECT_NEAR(mesh[9], 0.3 + 1e-3, EPSILON_100);
+
+	//The distance to the center grows geometrically.
+	for(unsigned int n = 10; n < mesh.size(); n++){
+		EXPECT_NEAR(
+			(mesh[n] - 0.3)/(mesh[n-1] - 0.3),
+			(mesh[10] - 0.3)/(mesh[9] - 0.3),
+			1e-10
+		);
+	}
+
+	//Center at the bound.
+	mesh = EnergyMesh::generateLogarithmicMesh(-1, 1, -1, 1e-2, 5);
+	ASSERT_EQ(mesh.size(), 6);
+	checkStrictlyIncreasing(mesh);
+	EXPECT_EQ(mesh.front(), -1);
+	EXPECT_EQ(mesh.back(), 1);
+
+	//Fail for center outside the bounds.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyMesh::generateLogarithmicMesh(-1, 1, 2, 1e-2, 5);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyMesh, generateAdaptiveMesh){
+	//Bounds and features are included, the spacing stays between the
+	//minimum and maximum spacing, and it grows with the distance to the
+	//closest feature. Steps that end on a feature or on the upper bound
+	//may deviate from the limits by at most half the minimum spacing.
+	double minimumSpacing = 0.01;
+	double maximumSpacing = 0.5;
+	std::vector<double> features = {0.3, -4, 7};
+	std::vector<double> mesh = EnergyMesh::generateAdaptiveMesh(
+		-5,
+		5,
+		features,
+		minimumSpacing,
+		maximumSpacing
+	);
+	checkStrictlyIncreasing(mesh);
+	EXPECT_EQ(mesh.front(), -5);
+	EXPECT_EQ(mesh.back(), 5);
+	EXPECT_TRUE(std::binary_search(mesh.begin(), mesh.end(), -4.));
+	EXPECT_TRUE(std::binary_search(mesh.begin(), mesh.end(), 0.3));
+	for(unsigned int n = 1; n < mesh.size(); n++){
+		double spacing = mesh[n] - mesh[n-1];
+		if(mesh[n] == -4 || mesh[n] == 0.3 || n == mesh.size() - 1){
+			EXPECT_GE(spacing, minimumSpacing/2);
+			EXPECT_LE(spacing, maximumSpacing + minimumSpacing/2);
+		}
+		else{
+			EXPECT_GE(spacing, minimumSpacing*(1 - EPSILON_100));
+			EXPECT_LE(spacing, maximumSpacing*(1 + EPSILON_100));
+		}
+	}
+	//Dense close to the features and sparse far away from them.
+	unsigned int feature = std::lower_bound(
+		mesh.begin(),
+		mesh.end(),
+		0.3
+	) - mesh.begin();
+	EXPECT_NEAR(
+		mesh[feature + 1] - mesh[feature],
+		minimumSpacing,
+		EPSILON_100
+	);
+	EXPECT_NEAR(mesh[1] - mesh[0], maximumSpacing, EPSILON_100);
+
+	//A feature that lies closer than half the minimum spacing to the
+	//next point is snapped to, and the last point is moved to the upper
+	//bound rather than adding a point closer than half the minimum
+	//spacing.
+	mesh = EnergyMesh::generateAdaptiveMesh(0, 10, {5.8}, 1, 1);
+	std::vector<double> expected
+		= {0, 1, 2, 3, 4, 5, 5.8, 6.8, 7.8, 8.8, 10};
+	ASSERT_EQ(mesh.size(), expected.size());
+	for(unsigned int n = 0; n < mesh.size(); n++)
+		EXPECT_NEAR(mesh[n], expected[n], EPSILON_100);
+	EXPECT_EQ(mesh[6], 5.8);
+
+	//The last point is not merged with the upper bound if it is a
+	//feature.
+	mesh = EnergyMesh::generateAdaptiveMesh(0, 10, {9.8}, 1, 1);
+	expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9.8, 10};
+	ASSERT_EQ(mesh.size(), expected.size());
+	for(unsigned int n = 0; n < mesh.size(); n++)
+		EXPECT_NEAR(mesh[n], expected[n], EPSILON_100);
+	EXPECT_EQ(mesh[10], 9.8);
+
+	//Fail for invalid spacings.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyMesh::generateAdaptiveMesh(0, 1, {}, 0.5, 0.1);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyMesh, generateSparseMatsubaraEnergyIndices){
+	//Fermionic.
+	std::vector<int> indices
+		= EnergyMesh::generateSparseMatsubaraEnergyIndices(
+			-1999,
+			1999,
+			4,
+			5
+		);
+	checkSparseMatsubaraEnergyIndices(indices, -1999, 1999);
+	for(int n = -7; n <= 7; n += 2){
+		EXPECT_TRUE(
+			std::binary_search(indices.begin(), indices.end(), n)
+		);
+	}
+	EXPECT_FALSE(std::binary_search(indices.begin(), indices.end(), 9));
+	//Roughly the requested number of Matsubara energies per decade.
+	unsigned int numInDecade = 0;
+	for(unsigned int n = 0; n < indices.size(); n++)
+		if(indices[n] >= 100 && indices[n] < 1000)
+			numInDecade++;
+	EXPECT_GE(numInDecade, 4);
+	EXPECT_LE(numInDecade, 6);
+
+	//Bosonic.
+	indices = EnergyMesh::generateSparseMatsubaraEnergyIndices(
+		-200,
+		200,
+		3,
+		10
+	);
+	checkSparseMatsubaraEnergyIndices(indices, -200, 200);
+	for(int n = -4; n <= 4; n += 2){
+		EXPECT_TRUE(
+			std::binary_search(indices.begin(), indices.end(), n)
+		);
+	}
+
+	//Asymmetric bounds.
+	indices = EnergyMesh::generateSparseMatsubaraEnergyIndices(
+		-9,
+		201,
+		4,
+		5
+	);
+	checkSparseMatsubaraEnergyIndices(indices, -9, 201);
+
+	//Without contiguous Matsubara energies, the Matsubara energies
+	//closest to zero are still included.
+	indices = EnergyMesh::generateSparseMatsubaraEnergyIndices(-4, 4, 0, 5);
+	checkSparseMatsubaraEnergyIndices(indices, -4, 4);
+	EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), 0));
+	indices = EnergyMesh::generateSparseMatsubaraEnergyIndices(
+		-101,
+		101,
+		0,
+		5
+	);
+	checkSparseMatsubaraEnergyIndices(indices, -101, 101);
+	EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), 1));
+	EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), -1));
+
+	//Only the bounds.
+	indices = EnergyMesh::generateSparseMatsubaraEnergyIndices(3, 3, 4, 5);
+	ASSERT_EQ(indices.size(), 1);
+	EXPECT_EQ(indices[0], 3);
+
+	//Fail for bounds with different parity.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyMesh::generateSparseMatsubaraEnergyIndices(
+				-3,
+				4,
+				2,
+				5
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+};
@@ -0,0 +1,162 @@
+#include "TBTK/FileReader.h"
+#include "TBTK/FileWriter.h"
+#include "TBTK/IndexTree.h"
+#include "TBTK/LazyLDOS.h"
+#include "TBTK/Property/LDOS.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace TBTK{
+
+//Create a temporary directory and return the name of a file in it that
+//does not exist yet.
+std::string getLazyLDOSTestFilename(){
+	char directory[] = "/tmp/TBTKTestLazyLDOSXXXXXX";
+	EXPECT_TRUE(mkdtemp(directory) != nullptr);
+
+	return std::string(directory) + "/LDOS.h5";
+}
+
+//Remove the file and the temporary directory it is in.
+void removeLazyLDOSTestFile(const std::string &filename){
+	remove(filename.c_str());
+	rmdir(filename.substr(0, filename.rfind('/')).c_str());
+}
+
+//Data that is unique for each element.
+std::vector<double> getLazyLDOSTestData(unsigned int size){
+	std::vector<double> data;
+	for(unsigned int n = 0; n < size; n++)
+		data.push_back(sin(n) + n/7.);
+
+	return data;
+}
+
+TEST(LazyLDOS, Ranges){
+	std::string filename = getLazyLDOSTestFilename();
+	const int RANGES[3] = {5, 7, 3};
+	const int RESOLUTION = 11;
+	std::vector<double> data
+		= getLazyLDOSTestData(5*7*3*RESOLUTION);
+	Property::LDOS ldos(3, RANGES, -2, 3, RESOLUTION, data.data());
+	FileWriter::setFileName(filename);
+	FileWriter::writeLDOS(ldos);
+
+	//A small block and cache size ensures that blocks are evicted and
+	//read again.
+	FileReader::setFileName(filename);
+	LazyLDOS lazyLDOS("LDOS", "/", 2*7*3*RESOLUTION, 2);
+	EXPECT_EQ(lazyLDOS.getFormat(), IndexDescriptor::Format::Ranges);
+	ASSERT_EQ(lazyLDOS.getRanges().size(), 3);
+	for(unsigned int n = 0; n < 3; n++)
+		EXPECT_EQ(lazyLDOS.getRanges()[n], RANGES[n]);
+	EXPECT_EQ(lazyLDOS.getLowerBound(), ldos.getLowerBound());
+	EXPECT_EQ(lazyLDOS.getUpperBound(), ldos.getUpperBound());
+	EXPECT_EQ(lazyLDOS.getResolution(), RESOLUTION);
+	EXPECT_EQ(lazyLDOS.getNumSites(), 5*7*3);
+
+	std::vector<std::vector<double>> dataAtEnergies;
+	for(int e = 0; e < RESOLUTION; e++)
+		dataAtEnergies.push_back(lazyLDOS.getDataAtEnergy(e));
+	for(int pass = 0; pass < 2; pass++){
+		for(int x = 0; x < RANGES[0]; x++){
+			for(int y = 0; y < RANGES[1]; y++){
+				for(int z = 0; z < RANGES[2]; z++){
+					unsigned int site
+						= (x*RANGES[1] + y)*RANGES[2]
+							+ z;
+					EXPECT_EQ(
+						lazyLDOS.getSite({x, y, z}),
+						site
+					);
+					std::vector<double> siteData
+						= lazyLDOS.getData({x, y, z});
+					ASSERT_EQ(siteData.size(), RESOLUTION);
+					for(int e = 0; e < RESOLUTION; e++){
+						double reference
+							= ldos.getData()[
+								site*RESOLUTION
+								+ e
+							];
+						EXPECT_EQ(
+							lazyLDOS({x, y, z}, e),
+							reference
+						);
+						EXPECT_EQ(
+							siteData[e],
+							reference
+						);
+						EXPECT_EQ(
+							dataAtEnergies[e][site],
+							reference
+						);
+					}
+				}
+			}
+		}
+	}
+
+	removeLazyLDOSTestFile(filename);
+}
+
+TEST(LazyLDOS, Custom){
+	std::string filename = getLazyLDOSTestFilename();
+	IndexTree indexTree;
+	std::vector<Index> indices;
+	for(int x = 0; x < 4; x++){
+		for(int y = 0; y < 3; y++){
+			indices.push_back({x, y, 0});
+			indices.push_back({x, y, 1});
+		}
+	}
+	indices.push_back({7, 1});
+	for(unsigned int n = 0; n < indices.size(); n++)
+		indexTree.add(indices[n]);
+	indexTree.generateLinearMap();
+	const int RESOLUTION = 13;
+	std::vector<double> data
+		= getLazyLDOSTestData(indices.size()*RESOLUTION);
+	Property::LDOS ldos(indexTree, -1, 1, RESOLUTION, data.data());
+	FileWriter::setFileName(filename);
+	FileWriter::writeLDOS(ldos, "LDOSCustom");
+
+	FileReader::setFileName(filename);
+	LazyLDOS lazyLDOS("LDOSCustom", "/", 3*RESOLUTION, 2);
+	EXPECT_EQ(lazyLDOS.getFormat(), IndexDescriptor::Format::Custom);
+	EXPECT_EQ(lazyLDOS.getLowerBound(), -1);
+	EXPECT_EQ(lazyLDOS.getUpperBound(), 1);
+	EXPECT_EQ(lazyLDOS.getResolution(), RESOLUTION);
+	EXPECT_EQ(lazyLDOS.getNumSites(), indices.size());
+
+	for(int pass = 0; pass < 2; pass++){
+		for(unsigned int n = 0; n < indices.size(); n++){
+			//Access the sites in an order that differs from the
+			//storage order.
+			const Index &index
+				= indices[(7*n + pass)%indices.size()];
+			unsigned int site = lazyLDOS.getSite(index);
+			std::vector<double> siteData = lazyLDOS.getData(index);
+			ASSERT_EQ(siteData.size(), RESOLUTION);
+			for(int e = 0; e < RESOLUTION; e++){
+				EXPECT_EQ(lazyLDOS(index, e), ldos(index, e));
+				EXPECT_EQ(siteData[e], ldos(index, e));
+				EXPECT_EQ(
+					lazyLDOS.getDataAtEnergy(e)[site],
+					ldos(index, e)
+				);
+			}
+		}
+	}
+
+	removeLazyLDOSTestFile(filename);
+}
+
+};
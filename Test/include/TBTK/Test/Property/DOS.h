@@ -45,6 +45,23 @@ TEST(DOS, SerializeToJSON){
 		EXPECT_DOUBLE_EQ(data[n], n);
 }
 
+TEST(DOS, SerializeToBinary){
+	double dataInput[1000];
+	for(unsigned int n = 0; n < 1000; n++)
+		dataInput[n] = n;
+	DOS dos0(-10, 10, 1000, dataInput);
+	DOS dos1(
+		dos0.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	EXPECT_EQ(dos1.getLowerBound(), -10);
+	EXPECT_EQ(dos1.getUpperBound(), 10);
+	ASSERT_EQ(dos1.getResolution(), 1000);
+	const std::vector<double> &data = dos1.getData();
+	for(unsigned int n = 0; n < data.size(); n++)
+		EXPECT_DOUBLE_EQ(data[n], n);
+}
+
 TEST(DOS, getLowerBound){
 	//Already tested through
 	//DOS::Constructor0
@@ -64,7 +81,7 @@ TEST(DOS, getEnergyResolution){
 }
 
 TEST(DOS, serialize){
-	//Already tested through SerializeToJSON.
+	//Already tested through SerializeToJSON and SerializeToBinary.
 }
 
 };	//End of namespace Property
@@ -458,6 +458,210 @@ TEST(EnergyResolvedProperty, Constructor3){
 	}
 }
 
+TEST(EnergyResolvedProperty, Constructor4){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	EnergyResolvedProperty<int> energyResolvedProperty(
+		indexTree,
+		{-10, -1, 0, 2, 10}
+	);
+	EXPECT_EQ(
+		energyResolvedProperty.getEnergyType(),
+		EnergyResolvedProperty<int>::EnergyType::Real
+	);
+	EXPECT_EQ(energyResolvedProperty.getLowerBound(), -10);
+	EXPECT_EQ(energyResolvedProperty.getUpperBound(), 10);
+	EXPECT_EQ(energyResolvedProperty.getResolution(), 5);
+
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 5; c++)
+			EXPECT_EQ(energyResolvedProperty({n}, c), 0);
+
+	//Fail for empty energies.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				indexTree,
+				std::vector<double>()
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+
+	//Fail for energies that are not strictly increasing.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				indexTree,
+				{-10, 1, 1, 10}
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyResolvedProperty, Constructor5){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	int data[3*5];
+	for(unsigned int n = 0; n < 3*5; n++)
+		data[n] = n;
+	EnergyResolvedProperty<int> energyResolvedProperty(
+		indexTree,
+		{-10, -1, 0, 2, 10},
+		data
+	);
+	EXPECT_EQ(
+		energyResolvedProperty.getEnergyType(),
+		EnergyResolvedProperty<int>::EnergyType::Real
+	);
+	EXPECT_EQ(energyResolvedProperty.getResolution(), 5);
+
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 5; c++)
+			EXPECT_EQ(energyResolvedProperty({n}, c), 5*n + c);
+}
+
+TEST(EnergyResolvedProperty, Constructor6){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+
+	//EnergyType::FermionicMatsubara.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+		indexTree,
+		{-21, -3, -1, 1, 3, 21},
+		2
+	);
+	EXPECT_EQ(
+		energyResolvedProperty0.getEnergyType(),
+		EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara
+	);
+	EXPECT_EQ(energyResolvedProperty0.getLowerMatsubaraEnergyIndex(), -21);
+	EXPECT_EQ(energyResolvedProperty0.getUpperMatsubaraEnergyIndex(), 21);
+	EXPECT_EQ(energyResolvedProperty0.getNumMatsubaraEnergies(), 6);
+	EXPECT_EQ(
+		energyResolvedProperty0.getFundamentalMatsubaraEnergy(),
+		2
+	);
+
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 6; c++)
+			EXPECT_EQ(energyResolvedProperty0({n}, c), 0);
+
+	//EnergyType::BosonicMatsubara.
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, -2, 0, 2, 20},
+		2
+	);
+	EXPECT_EQ(
+		energyResolvedProperty1.getEnergyType(),
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara
+	);
+	EXPECT_EQ(energyResolvedProperty1.getLowerMatsubaraEnergyIndex(), -20);
+	EXPECT_EQ(energyResolvedProperty1.getUpperMatsubaraEnergyIndex(), 20);
+	EXPECT_EQ(energyResolvedProperty1.getNumMatsubaraEnergies(), 5);
+
+	//Fail for EnergyType::Real.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				EnergyResolvedProperty<int>::EnergyType::Real,
+				indexTree,
+				{-20, 0, 20},
+				2
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+
+	//Fail for even fermionic Matsubara energy indices.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+				indexTree,
+				{-3, 0, 3},
+				2
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+
+	//Fail for odd bosonic Matsubara energy indices.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+				indexTree,
+				{-2, 1, 2},
+				2
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+
+	//Fail for Matsubara energy indices that are not strictly
+	//increasing.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+				indexTree,
+				{-2, 2, 0},
+				2
+			);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyResolvedProperty, Constructor7){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	int data[3*5];
+	for(unsigned int n = 0; n < 3*5; n++)
+		data[n] = n;
+	EnergyResolvedProperty<int> energyResolvedProperty(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, -2, 0, 2, 20},
+		2,
+		data
+	);
+	EXPECT_EQ(energyResolvedProperty.getNumMatsubaraEnergies(), 5);
+
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 5; c++)
+			EXPECT_EQ(energyResolvedProperty({n}, c), 5*n + c);
+}
+
 TEST(EnergyResolvedProerty, SerializeToJSON){
 	//EnergyType::Real.
 	IndexTree indexTree;
@@ -615,6 +819,113 @@ TEST(EnergyResolvedProerty, SerializeToJSON){
 			EXPECT_EQ(energyResolvedProperty5({n}, c), 11*n + c);
 		}
 	}
+
+	//Non-uniform EnergyType::Real.
+	int data6[3*4];
+	for(unsigned int n = 0; n < 3*4; n++)
+		data6[n] = n;
+	EnergyResolvedProperty<int> energyResolvedProperty6(
+		indexTree,
+		{-10, -1, 2, 10},
+		data6
+	);
+	EnergyResolvedProperty<int> energyResolvedProperty7(
+		energyResolvedProperty6.serialize(Serializable::Mode::JSON),
+		Serializable::Mode::JSON
+	);
+	EXPECT_FALSE(energyResolvedProperty7.isUniform());
+	EXPECT_EQ(energyResolvedProperty7.getResolution(), 4);
+	EXPECT_DOUBLE_EQ(energyResolvedProperty7.getEnergy(1), -1);
+	EXPECT_DOUBLE_EQ(energyResolvedProperty7.getEnergy(2), 2);
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_EQ(energyResolvedProperty7({n}, c), 4*n + c);
+
+	//Sparse EnergyType::BosonicMatsubara.
+	EnergyResolvedProperty<int> energyResolvedProperty8(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, -2, 0, 2},
+		2,
+		data6
+	);
+	EnergyResolvedProperty<int> energyResolvedProperty9(
+		energyResolvedProperty8.serialize(Serializable::Mode::JSON),
+		Serializable::Mode::JSON
+	);
+	EXPECT_EQ(
+		energyResolvedProperty9.getEnergyType(),
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara
+	);
+	EXPECT_FALSE(energyResolvedProperty9.isUniform());
+	EXPECT_EQ(energyResolvedProperty9.getNumMatsubaraEnergies(), 4);
+	EXPECT_EQ(energyResolvedProperty9.getMatsubaraEnergyIndex(0), -20);
+	EXPECT_EQ(energyResolvedProperty9.getMatsubaraEnergyIndex(3), 2);
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_EQ(energyResolvedProperty9({n}, c), 4*n + c);
+}
+
+TEST(EnergyResolvedProperty, SerializeToBinary){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	int data[3*4];
+	for(unsigned int n = 0; n < 3*4; n++)
+		data[n] = n;
+
+	//Non-uniform EnergyType::Real.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		indexTree,
+		{-10, -1, 2, 10},
+		data
+	);
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		energyResolvedProperty0.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	EXPECT_FALSE(energyResolvedProperty1.isUniform());
+	EXPECT_EQ(energyResolvedProperty1.getResolution(), 4);
+	EXPECT_DOUBLE_EQ(energyResolvedProperty1.getEnergy(1), -1);
+	EXPECT_DOUBLE_EQ(energyResolvedProperty1.getEnergy(2), 2);
+
+	//Sparse EnergyType::FermionicMatsubara.
+	EnergyResolvedProperty<int> energyResolvedProperty2(
+		EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+		indexTree,
+		{-21, -1, 1, 21},
+		2,
+		data
+	);
+	EnergyResolvedProperty<int> energyResolvedProperty3(
+		energyResolvedProperty2.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	EXPECT_FALSE(energyResolvedProperty3.isUniform());
+	EXPECT_EQ(energyResolvedProperty3.getNumMatsubaraEnergies(), 4);
+	EXPECT_EQ(energyResolvedProperty3.getMatsubaraEnergyIndex(1), -1);
+	EXPECT_EQ(energyResolvedProperty3.getUpperMatsubaraEnergyIndex(), 21);
+	for(int n = 0; n < 3; n++)
+		for(unsigned int c = 0; c < 4; c++)
+			EXPECT_EQ(energyResolvedProperty3({n}, c), 4*n + c);
+
+	//Uniform energies remain uniform.
+	EnergyResolvedProperty<int> energyResolvedProperty4(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		-4,
+		2,
+		2,
+		data
+	);
+	EnergyResolvedProperty<int> energyResolvedProperty5(
+		energyResolvedProperty4.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	EXPECT_TRUE(energyResolvedProperty5.isUniform());
+	EXPECT_EQ(energyResolvedProperty5.getNumMatsubaraEnergies(), 4);
 }
 
 TEST(EnergyResolvedProperty, getEnergyType){
@@ -1102,6 +1413,236 @@ TEST(EnergyResolvedProperty, getMatsubaraEnergy){
 	}
 }
 
+TEST(EnergyResolvedProperty, getEnergies){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.generateLinearMap();
+
+	//Uniform energies.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		indexTree,
+		-10,
+		10,
+		5
+	);
+	std::vector<double> energies0 = energyResolvedProperty0.getEnergies();
+	EXPECT_EQ(energies0.size(), 5);
+	for(unsigned int n = 0; n < energies0.size(); n++)
+		EXPECT_DOUBLE_EQ(energies0[n], -10 + 5*(int)n);
+
+	//Non-uniform energies.
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		indexTree,
+		{-10, -1, 0, 2, 10}
+	);
+	std::vector<double> energies1 = energyResolvedProperty1.getEnergies();
+	EXPECT_EQ(energies1.size(), 5);
+	EXPECT_DOUBLE_EQ(energies1[1], -1);
+	EXPECT_DOUBLE_EQ(energies1[3], 2);
+	EXPECT_DOUBLE_EQ(energyResolvedProperty1.getEnergy(3), 2);
+
+	//Fail for EnergyType::BosonicMatsubara.
+	EXPECT_EXIT(
+		{
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+				indexTree,
+				-10,
+				10,
+				2
+			);
+			Streams::setStdMuteErr();
+			energyResolvedProperty.getEnergies();
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyResolvedProperty, isUniform){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.generateLinearMap();
+
+	EXPECT_TRUE(
+		EnergyResolvedProperty<int>(indexTree, -10, 10, 5).isUniform()
+	);
+	EXPECT_FALSE(
+		EnergyResolvedProperty<int>(
+			indexTree,
+			{-10, 0, 10}
+		).isUniform()
+	);
+	EXPECT_TRUE(
+		EnergyResolvedProperty<int>(
+			EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+			indexTree,
+			-9,
+			9,
+			2
+		).isUniform()
+	);
+	EXPECT_FALSE(
+		EnergyResolvedProperty<int>(
+			EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+			indexTree,
+			{-9, 1, 9},
+			2
+		).isUniform()
+	);
+}
+
+TEST(EnergyResolvedProperty, getMatsubaraEnergyIndex){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.generateLinearMap();
+
+	//Uniform Matsubara energies.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+		indexTree,
+		-9,
+		9,
+		2.2
+	);
+	for(unsigned int n = 0; n < 10; n++){
+		EXPECT_EQ(
+			energyResolvedProperty0.getMatsubaraEnergyIndex(n),
+			-9 + 2*(int)n
+		);
+	}
+
+	//Sparse Matsubara energies.
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, -2, 0, 2, 20},
+		2.2
+	);
+	EXPECT_EQ(energyResolvedProperty1.getMatsubaraEnergyIndex(0), -20);
+	EXPECT_EQ(energyResolvedProperty1.getMatsubaraEnergyIndex(2), 0);
+	EXPECT_EQ(energyResolvedProperty1.getMatsubaraEnergyIndex(4), 20);
+	EXPECT_DOUBLE_EQ(
+		imag(energyResolvedProperty1.getMatsubaraEnergy(4)),
+		20*2.2
+	);
+	EXPECT_DOUBLE_EQ(
+		energyResolvedProperty1.getLowerMatsubaraEnergy(),
+		-20*2.2
+	);
+	EXPECT_DOUBLE_EQ(
+		energyResolvedProperty1.getUpperMatsubaraEnergy(),
+		20*2.2
+	);
+
+	//Fail for EnergyType::Real.
+	EXPECT_EXIT(
+		{
+			EnergyResolvedProperty<int> energyResolvedProperty(
+				indexTree,
+				-10,
+				10,
+				1000
+			);
+			Streams::setStdMuteErr();
+			energyResolvedProperty.getMatsubaraEnergyIndex(0);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(EnergyResolvedProperty, getMatsubaraEnergyIndices){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.generateLinearMap();
+
+	//Uniform Matsubara energies.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		-4,
+		4,
+		2
+	);
+	std::vector<int> matsubaraEnergyIndices0
+		= energyResolvedProperty0.getMatsubaraEnergyIndices();
+	EXPECT_EQ(matsubaraEnergyIndices0, std::vector<int>({-4, -2, 0, 2, 4}));
+
+	//Sparse Matsubara energies.
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, 0, 6},
+		2
+	);
+	std::vector<int> matsubaraEnergyIndices1
+		= energyResolvedProperty1.getMatsubaraEnergyIndices();
+	EXPECT_EQ(matsubaraEnergyIndices1, std::vector<int>({-20, 0, 6}));
+}
+
+TEST(EnergyResolvedProperty, getMatsubaraSummationWeight){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.generateLinearMap();
+
+	//Uniform Matsubara energies.
+	EnergyResolvedProperty<int> energyResolvedProperty0(
+		EnergyResolvedProperty<int>::EnergyType::FermionicMatsubara,
+		indexTree,
+		-9,
+		9,
+		2
+	);
+	for(unsigned int n = 0; n < 10; n++){
+		EXPECT_DOUBLE_EQ(
+			energyResolvedProperty0.getMatsubaraSummationWeight(n),
+			1
+		);
+	}
+
+	//Sparse Matsubara energies. The weights add up to the number of
+	//Matsubara energies between the lowest and highest Matsubara energy.
+	EnergyResolvedProperty<int> energyResolvedProperty1(
+		EnergyResolvedProperty<int>::EnergyType::BosonicMatsubara,
+		indexTree,
+		{-20, -2, 0, 2, 4, 30},
+		2
+	);
+	EXPECT_DOUBLE_EQ(
+		energyResolvedProperty1.getMatsubaraSummationWeight(0),
+		0.5 + 18/4.
+	);
+	EXPECT_DOUBLE_EQ(
+		energyResolvedProperty1.getMatsubaraSummationWeight(2),
+		1
+	);
+	EXPECT_DOUBLE_EQ(
+		energyResolvedProperty1.getMatsubaraSummationWeight(4),
+		2/4. + 26/4.
+	);
+	double totalWeight = 0;
+	for(unsigned int n = 0; n < 6; n++){
+		totalWeight
+			+= energyResolvedProperty1.getMatsubaraSummationWeight(
+				n
+			);
+	}
+	EXPECT_DOUBLE_EQ(totalWeight, 26);
+
+	//Sparse Matsubara energies give the exact sum for a summand that
+	//is linear in the Matsubara energy index.
+	double sum = 0;
+	for(unsigned int n = 0; n < 6; n++){
+		sum += energyResolvedProperty1.getMatsubaraSummationWeight(n)
+			*energyResolvedProperty1.getMatsubaraEnergyIndex(n);
+	}
+	double exactSum = 0;
+	for(int m = -20; m <= 30; m += 2)
+		exactSum += m;
+	EXPECT_DOUBLE_EQ(sum, exactSum);
+}
+
 TEST(EnergyResolvedProperty, serialize){
 	//Already tested through EnergyResolvedProperty::SerializatToJSON().
 }
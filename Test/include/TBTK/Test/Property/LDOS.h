@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+
 namespace TBTK{
 namespace Property{
 
@@ -127,6 +129,111 @@ TEST(LDOS, SerializeToJSON){
 	}
 }
 
+TEST(LDOS, SerializeToBinary){
+	//IndexDescriptor::Format::Ranges.
+	int ranges[3] = {2, 3, 4};
+	double dataInput0[1000*2*3*4];
+	for(unsigned int n = 0; n < 1000*2*3*4; n++)
+		dataInput0[n] = n;
+	LDOS ldos0(3, ranges, -10, 10, 1000, dataInput0);
+	LDOS ldos1(
+		ldos0.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	ASSERT_EQ(ldos1.getDimensions(), 3);
+	EXPECT_EQ(ldos1.getRanges()[0], 2);
+	EXPECT_EQ(ldos1.getRanges()[1], 3);
+	EXPECT_EQ(ldos1.getRanges()[2], 4);
+	EXPECT_DOUBLE_EQ(ldos1.getLowerBound(), -10);
+	EXPECT_DOUBLE_EQ(ldos1.getUpperBound(), 10);
+	ASSERT_EQ(ldos1.getResolution(), 1000);
+	ASSERT_EQ(ldos1.getSize(), 1000*2*3*4);
+	const std::vector<double> &data1 = ldos1.getData();
+	for(unsigned int n = 0; n < data1.size(); n++)
+		EXPECT_DOUBLE_EQ(data1[n], n);
+
+	//IndexDescriptor::Format::Custom
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	double dataInput2[1000*3];
+	for(unsigned int n = 0; n < 1000*3; n++)
+		dataInput2[n] = n;
+	LDOS ldos2(indexTree, -10, 10, 1000, dataInput2);
+	LDOS ldos3(
+		ldos2.serialize(Serializable::Mode::Binary),
+		Serializable::Mode::Binary
+	);
+	EXPECT_DOUBLE_EQ(ldos3.getLowerBound(), -10);
+	EXPECT_DOUBLE_EQ(ldos3.getUpperBound(), 10);
+	ASSERT_EQ(ldos3.getResolution(), 1000);
+	ASSERT_EQ(ldos3.getSize(), 1000*3);
+	for(int n = 0; n < ldos3.getResolution(); n++){
+		EXPECT_DOUBLE_EQ(ldos3({0}, n), n);
+		EXPECT_DOUBLE_EQ(ldos3({1}, n), n+1000);
+		EXPECT_DOUBLE_EQ(ldos3({2}, n), n+2000);
+	}
+}
+
+TEST(LDOS, MapToFile){
+	IndexTree indexTree;
+	indexTree.add({0});
+	indexTree.add({1});
+	indexTree.add({2});
+	indexTree.generateLinearMap();
+	double dataInput[1000*3];
+	for(unsigned int n = 0; n < 1000*3; n++)
+		dataInput[n] = n;
+	LDOS ldos0(indexTree, -10, 10, 1000, dataInput);
+	ldos0.mapToFile("TBTKTestLDOSMapToFile");
+	EXPECT_TRUE(ldos0.getIsMemoryMapped());
+	ASSERT_EQ(ldos0.getSize(), 1000*3);
+	EXPECT_DOUBLE_EQ(ldos0({1}, 10), 1010);
+	ldos0({1}, 10) = -1;
+	ldos0.syncMemoryMappedFile();
+
+	LDOS ldos1 = openMemoryMapped<LDOS>("TBTKTestLDOSMapToFile");
+	EXPECT_TRUE(ldos1.getIsMemoryMapped());
+	EXPECT_DOUBLE_EQ(ldos1.getLowerBound(), -10);
+	EXPECT_DOUBLE_EQ(ldos1.getUpperBound(), 10);
+	ASSERT_EQ(ldos1.getResolution(), 1000);
+	ASSERT_EQ(ldos1.getSize(), 1000*3);
+	const double *data1 = ldos1.getDataPointer();
+	for(unsigned int n = 0; n < ldos1.getSize(); n++){
+		if(n == 1010)
+			EXPECT_DOUBLE_EQ(data1[n], -1);
+		else
+			EXPECT_DOUBLE_EQ(data1[n], n);
+	}
+
+	//Files opened as read only cannot be modified.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			ldos1({1}, 10) = 0;
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			ldos1.getDataPointerRW();
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+
+	//Copies store the data in memory.
+	LDOS ldos2 = ldos1;
+	EXPECT_FALSE(ldos2.getIsMemoryMapped());
+	EXPECT_DOUBLE_EQ(ldos2.getData()[1010], -1);
+
+	std::remove("TBTKTestLDOSMapToFile");
+}
+
 TEST(LDOS, getLowerBound){
 	//Already tested through
 	//LDOS::Constructor0
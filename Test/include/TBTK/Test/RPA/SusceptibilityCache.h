@@ -0,0 +1,234 @@
+#include "TBTK/RPA/SusceptibilityCache.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace TBTK{
+
+//Create an empty temporary directory.
+std::string createSusceptibilityCacheTestDirectory(){
+	char directory[] = "/tmp/TBTKTestSusceptibilityCacheXXXXXX";
+	EXPECT_TRUE(mkdtemp(directory) != nullptr);
+
+	return directory;
+}
+
+//Get the paths to the files in a directory.
+std::vector<std::string> getFilesInDirectory(const std::string &directory){
+	std::vector<std::string> files;
+	DIR *dir = opendir(directory.c_str());
+	EXPECT_TRUE(dir != nullptr);
+	if(dir == nullptr)
+		return files;
+
+	struct dirent *entry;
+	while((entry = readdir(dir)) != nullptr){
+		std::string name = entry->d_name;
+		if(name.compare(".") != 0 && name.compare("..") != 0)
+			files.push_back(directory + "/" + name);
+	}
+	closedir(dir);
+
+	return files;
+}
+
+//Get the size of a file.
+long getFileSize(const std::string &filename){
+	struct stat status;
+	EXPECT_EQ(stat(filename.c_str(), &status), 0);
+
+	return status.st_size;
+}
+
+//Data that is unique for each entry and that is not exactly representable
+//in decimal form, such that the test can check that the data is restored
+//bit by bit.
+std::vector<std::complex<double>> getSusceptibilityCacheTestData(
+	int entry,
+	unsigned int size = 100
+){
+	std::vector<std::complex<double>> data;
+	for(unsigned int n = 0; n < size; n++){
+		data.push_back(
+			std::complex<double>(
+				sqrt(2.)*(entry + 1)/(n + 3.),
+				exp(-(double)n/(entry + 7.))/3.
+			)
+		);
+	}
+
+	return data;
+}
+
+TEST(SusceptibilityCache, EvictAndSpill){
+	//Without a spill directory the least recently used entries are
+	//discarded.
+	SusceptibilityCache cache0(1);
+	cache0.setMaxSizeInBytes(5000);
+	for(int n = 0; n < 10; n++)
+		cache0.add(getSusceptibilityCacheTestData(n), {n});
+	EXPECT_LE(cache0.getSizeInBytes(), 5000);
+	std::vector<std::complex<double>> data;
+	EXPECT_FALSE(cache0.get(data, {0}));
+	EXPECT_TRUE(data.empty());
+	EXPECT_TRUE(cache0.get(data, {9}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(9));
+
+	//With a spill directory every entry is read back exactly.
+	std::string directory = createSusceptibilityCacheTestDirectory();
+	SusceptibilityCache cache1(1);
+	cache1.setSpillDirectory(directory);
+	EXPECT_EQ(cache1.getSpillDirectory(), directory);
+	cache1.setMaxSizeInBytes(5000);
+	EXPECT_EQ(cache1.getMaxSizeInBytes(), 5000);
+	for(int n = 0; n < 10; n++)
+		cache1.add(getSusceptibilityCacheTestData(n), {n});
+	EXPECT_LE(cache1.getSizeInBytes(), 5000);
+	EXPECT_EQ(getFilesInDirectory(directory).size(), 1);
+	for(int n = 0; n < 10; n++){
+		EXPECT_TRUE(cache1.get(data, {n}));
+		EXPECT_EQ(data, getSusceptibilityCacheTestData(n));
+		EXPECT_LE(cache1.getSizeInBytes(), 5000);
+	}
+
+	//Spilled entries are included in the IndexedDataTree.
+	IndexedDataTree<SerializableVector<std::complex<double>>>
+		indexedDataTree = cache1.getIndexedDataTree();
+	for(int n = 0; n < 10; n++){
+		SerializableVector<std::complex<double>> entry;
+		EXPECT_TRUE(indexedDataTree.get(entry, {n}));
+		EXPECT_EQ(
+			std::vector<std::complex<double>>(
+				entry.begin(),
+				entry.end()
+			),
+			getSusceptibilityCacheTestData(n)
+		);
+	}
+
+	//Clearing the cache removes the entries and the spill file.
+	cache1.clear();
+	EXPECT_EQ(cache1.getSizeInBytes(), 0);
+	EXPECT_FALSE(cache1.get(data, {0}));
+	EXPECT_EQ(getFilesInDirectory(directory).size(), 0);
+	rmdir(directory.c_str());
+}
+
+TEST(SusceptibilityCache, Respill){
+	//Only the most recently used entry is kept in memory.
+	std::string directory = createSusceptibilityCacheTestDirectory();
+	SusceptibilityCache cache(1);
+	cache.setSpillDirectory(directory);
+	cache.setMaxSizeInBytes(1);
+
+	std::vector<std::complex<double>> data;
+	cache.add(getSusceptibilityCacheTestData(0), {0});
+	cache.add(getSusceptibilityCacheTestData(1), {1});
+	std::vector<std::string> files = getFilesInDirectory(directory);
+	ASSERT_EQ(files.size(), 1);
+	long slotSize = getFileSize(files[0]);
+	EXPECT_GT(slotSize, 0);
+
+	//Reloading {0} spills {1}.
+	EXPECT_TRUE(cache.get(data, {0}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(0));
+	EXPECT_EQ(getFileSize(files[0]), 2*slotSize);
+
+	//Entries that are unchanged since they were spilled are not written
+	//again.
+	for(unsigned int n = 0; n < 4; n++){
+		EXPECT_TRUE(cache.get(data, {(int)n%2}));
+		EXPECT_EQ(data, getSusceptibilityCacheTestData(n%2));
+	}
+	EXPECT_EQ(getFileSize(files[0]), 2*slotSize);
+
+	//A modified entry of the same size reuses its old slot.
+	cache.add(getSusceptibilityCacheTestData(2), {0});
+	EXPECT_TRUE(cache.get(data, {1}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(1));
+	EXPECT_TRUE(cache.get(data, {0}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(2));
+	EXPECT_TRUE(cache.get(data, {1}));
+	EXPECT_EQ(getFileSize(files[0]), 2*slotSize);
+
+	//A modified entry with a different size is appended and leaves its
+	//old slot free for another entry with the same size.
+	cache.add(getSusceptibilityCacheTestData(3, 50), {0});
+	EXPECT_TRUE(cache.get(data, {1}));
+	long fileSize = getFileSize(files[0]);
+	EXPECT_GT(fileSize, 2*slotSize);
+	cache.add(getSusceptibilityCacheTestData(4), {2});
+	EXPECT_TRUE(cache.get(data, {0}));
+	EXPECT_EQ(getFileSize(files[0]), fileSize);
+
+	EXPECT_TRUE(cache.get(data, {0}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(3, 50));
+	EXPECT_TRUE(cache.get(data, {1}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(1));
+	EXPECT_TRUE(cache.get(data, {2}));
+	EXPECT_EQ(data, getSusceptibilityCacheTestData(4));
+
+	cache.clear();
+	rmdir(directory.c_str());
+}
+
+TEST(SusceptibilityCache, Concurrency){
+	std::string directory = createSusceptibilityCacheTestDirectory();
+	SusceptibilityCache cache(4);
+	cache.setSpillDirectory(directory);
+	cache.setMaxSizeInBytes(20000);
+
+	//The data for an Index is always the same, which makes the result
+	//independent of the order in which the threads access the cache.
+	const int NUM_ENTRIES = 100;
+	int numErrors = 0;
+	#pragma omp parallel for reduction(+:numErrors)
+	for(int n = 0; n < 20*NUM_ENTRIES; n++){
+		int entry = (7*n)%NUM_ENTRIES;
+		std::vector<std::complex<double>> data;
+		if(cache.get(data, {entry})){
+			if(data != getSusceptibilityCacheTestData(entry))
+				numErrors++;
+		}
+		else{
+			cache.add(getSusceptibilityCacheTestData(entry), {entry});
+		}
+	}
+	EXPECT_EQ(numErrors, 0);
+	EXPECT_LE(cache.getSizeInBytes(), 20000);
+
+	for(int n = 0; n < NUM_ENTRIES; n++){
+		std::vector<std::complex<double>> data;
+		EXPECT_TRUE(cache.get(data, {n}));
+		EXPECT_EQ(data, getSusceptibilityCacheTestData(n));
+	}
+
+	cache.clear();
+	rmdir(directory.c_str());
+}
+
+TEST(SusceptibilityCache, Destructor){
+	std::string directory = createSusceptibilityCacheTestDirectory();
+	{
+		SusceptibilityCache cache(4);
+		cache.setSpillDirectory(directory);
+		cache.setMaxSizeInBytes(1);
+		for(int n = 0; n < 20; n++)
+			cache.add(getSusceptibilityCacheTestData(n), {n});
+		EXPECT_GT(getFilesInDirectory(directory).size(), 0);
+	}
+	EXPECT_EQ(getFilesInDirectory(directory).size(), 0);
+	rmdir(directory.c_str());
+}
+
+};	//End of namespace TBTK
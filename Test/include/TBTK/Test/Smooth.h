@@ -0,0 +1,310 @@
+#include "TBTK/Smooth.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace TBTK{
+
+const double EPSILON_10000 = 10000*std::numeric_limits<double>::epsilon();
+
+//Naive O(N*W) Gaussian convolution of a single block, where sigma is given
+//in units of the spacing between the data points. The kernel is normalized
+//over the full window and the points outside of the block are treated as
+//zero.
+std::vector<double> naiveGaussian(
+	const std::vector<double> &data,
+	double sigma,
+	int windowSize
+){
+	int halfWindow = windowSize/2;
+	double normalization = 0;
+	for(int c = -halfWindow; c <= halfWindow; c++)
+		normalization += exp(-c*c/(2*sigma*sigma));
+
+	std::vector<double> result(data.size(), 0);
+	for(int n = 0; n < (int)data.size(); n++){
+		for(int c = -halfWindow; c <= halfWindow; c++){
+			if(n + c < 0 || n + c >= (int)data.size())
+				continue;
+
+			result[n] += exp(-c*c/(2*sigma*sigma))/normalization
+				*data[n + c];
+		}
+	}
+
+	return result;
+}
+
+//Irregular test data that is different for every block.
+std::vector<double> getSmoothTestData(unsigned int size, int block = 0){
+	std::vector<double> data;
+	for(unsigned int n = 0; n < size; n++)
+		data.push_back(sin(0.37*n*n + 1.3*block) + 0.1*block);
+
+	return data;
+}
+
+//Window sizes that are smaller than, equal to, and larger than the block
+//size of 'blockSize' points, including wide windows for which the FFT
+//convolution is used when TBTK is built with FFTW3.
+std::vector<int> getSmoothTestWindowSizes(unsigned int blockSize){
+	return {1, 3, 11, 2*(int)(blockSize/2) + 1, 2*(int)blockSize + 1, 101};
+}
+
+TEST(Smooth, gaussianVector){
+	for(unsigned int size : {1, 10, 64, 200}){
+		std::vector<double> data = getSmoothTestData(size);
+		for(int windowSize : getSmoothTestWindowSizes(size)){
+			for(double sigma : {0.5, 3., 40.}){
+				std::vector<double> result = Smooth::gaussian(
+					data,
+					sigma,
+					windowSize
+				);
+				std::vector<double> expected = naiveGaussian(
+					data,
+					sigma,
+					windowSize
+				);
+				ASSERT_EQ(result.size(), expected.size());
+				for(unsigned int n = 0; n < size; n++){
+					EXPECT_NEAR(
+						result[n],
+						expected[n],
+						EPSILON_10000
+					);
+				}
+			}
+		}
+	}
+
+	//The pointer version.
+	std::vector<double> data = getSmoothTestData(20);
+	std::vector<double> result = Smooth::gaussian(
+		data.data(),
+		data.size(),
+		2,
+		7
+	);
+	std::vector<double> expected = naiveGaussian(data, 2, 7);
+	for(unsigned int n = 0; n < data.size(); n++)
+		EXPECT_NEAR(result[n], expected[n], EPSILON_10000);
+
+	//Invalid window sizes.
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			Smooth::gaussian(data, 2, 0);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+	EXPECT_EXIT(
+		{
+			Streams::setStdMuteErr();
+			Smooth::gaussian(data, 2, 4);
+		},
+		::testing::ExitedWithCode(1),
+		""
+	);
+}
+
+TEST(Smooth, gaussianArray){
+	//An odd number of blocks tests both the pairs of blocks that are
+	//convolved together and the remaining single block.
+	const unsigned int NUM_BLOCKS[2] = {3, 2};
+	const unsigned int BLOCK_SIZE = 40;
+	Array<double> data({NUM_BLOCKS[0], NUM_BLOCKS[1], BLOCK_SIZE});
+	for(unsigned int block = 0; block < 6; block++){
+		std::vector<double> blockData = getSmoothTestData(
+			BLOCK_SIZE,
+			block
+		);
+		for(unsigned int n = 0; n < BLOCK_SIZE; n++)
+			data[block*BLOCK_SIZE + n] = blockData[n];
+	}
+	Array<double> oddData({5, BLOCK_SIZE});
+	for(unsigned int n = 0; n < oddData.getSize(); n++)
+		oddData[n] = data[n];
+
+	for(int windowSize : getSmoothTestWindowSizes(BLOCK_SIZE)){
+		Array<double> result = Smooth::gaussian(data, 4, windowSize);
+		Array<double> oddResult = Smooth::gaussian(
+			oddData,
+			4,
+			windowSize
+		);
+		ASSERT_EQ(result.getRanges(), data.getRanges());
+		ASSERT_EQ(oddResult.getRanges(), oddData.getRanges());
+		for(unsigned int block = 0; block < 6; block++){
+			std::vector<double> expected = naiveGaussian(
+				getSmoothTestData(BLOCK_SIZE, block),
+				4,
+				windowSize
+			);
+			for(unsigned int n = 0; n < BLOCK_SIZE; n++){
+				EXPECT_NEAR(
+					result[block*BLOCK_SIZE + n],
+					expected[n],
+					EPSILON_10000
+				);
+				if(block < 5){
+					EXPECT_NEAR(
+						oddResult[block*BLOCK_SIZE + n],
+						expected[n],
+						EPSILON_10000
+					);
+				}
+			}
+		}
+	}
+}
+
+TEST(Smooth, gaussianDOS){
+	const int RESOLUTION = 100;
+	std::vector<double> data = getSmoothTestData(RESOLUTION);
+	Property::DOS dos(-5, 5, RESOLUTION, data.data());
+	for(int windowSize : getSmoothTestWindowSizes(RESOLUTION)){
+		//Sigma is given in units of energy, which is 0.1 per point.
+		Property::DOS result = Smooth::gaussian(dos, 0.5, windowSize);
+		EXPECT_DOUBLE_EQ(result.getLowerBound(), -5);
+		EXPECT_DOUBLE_EQ(result.getUpperBound(), 5);
+		ASSERT_EQ(result.getResolution(), RESOLUTION);
+		std::vector<double> expected = naiveGaussian(
+			data,
+			0.5/10.*RESOLUTION,
+			windowSize
+		);
+		for(int n = 0; n < RESOLUTION; n++)
+			EXPECT_NEAR(result(n), expected[n], EPSILON_10000);
+	}
+}
+
+TEST(Smooth, gaussianLDOS){
+	//An odd number of sites tests both the pairs of blocks that are
+	//convolved together and the remaining single block.
+	const int RESOLUTION = 50;
+	const int NUM_SITES = 3;
+	IndexTree indexTree;
+	for(int n = 0; n < NUM_SITES; n++)
+		indexTree.add({n});
+	indexTree.generateLinearMap();
+	std::vector<double> data;
+	for(int n = 0; n < NUM_SITES; n++){
+		std::vector<double> blockData = getSmoothTestData(
+			RESOLUTION,
+			n
+		);
+		data.insert(data.end(), blockData.begin(), blockData.end());
+	}
+	Property::LDOS ldos(indexTree, -1, 1, RESOLUTION, data.data());
+	for(int windowSize : getSmoothTestWindowSizes(RESOLUTION)){
+		//Sigma is given in units of energy, which is 0.04 per point.
+		Property::LDOS result = Smooth::gaussian(ldos, 0.1, windowSize);
+		ASSERT_EQ(result.getResolution(), RESOLUTION);
+		for(int site = 0; site < NUM_SITES; site++){
+			std::vector<double> expected = naiveGaussian(
+				getSmoothTestData(RESOLUTION, site),
+				0.1/2.*RESOLUTION,
+				windowSize
+			);
+			for(int n = 0; n < RESOLUTION; n++){
+				EXPECT_NEAR(
+					result({site}, n),
+					expected[n],
+					EPSILON_10000
+				);
+			}
+		}
+	}
+}
+
+TEST(Smooth, gaussianSpinPolarizedLDOS){
+	const int RESOLUTION = 30;
+	const int NUM_SITES = 2;
+	IndexTree indexTree;
+	for(int n = 0; n < NUM_SITES; n++)
+		indexTree.add({n});
+	indexTree.generateLinearMap();
+
+	//Each of the eight real channels of a SpinMatrix has its own data.
+	std::vector<SpinMatrix> data(NUM_SITES*RESOLUTION);
+	for(int site = 0; site < NUM_SITES; site++){
+		for(unsigned int c = 0; c < 4; c++){
+			std::vector<double> realData = getSmoothTestData(
+				RESOLUTION,
+				8*site + 2*c
+			);
+			std::vector<double> imagData = getSmoothTestData(
+				RESOLUTION,
+				8*site + 2*c + 1
+			);
+			for(int n = 0; n < RESOLUTION; n++){
+				data[site*RESOLUTION + n].at(c/2, c%2)
+					= std::complex<double>(
+						realData[n],
+						imagData[n]
+					);
+			}
+		}
+	}
+	Property::SpinPolarizedLDOS spinPolarizedLDOS(
+		indexTree,
+		-1,
+		1,
+		RESOLUTION,
+		data.data()
+	);
+	for(int windowSize : getSmoothTestWindowSizes(RESOLUTION)){
+		Property::SpinPolarizedLDOS result = Smooth::gaussian(
+			spinPolarizedLDOS,
+			0.2,
+			windowSize
+		);
+		ASSERT_EQ(result.getResolution(), RESOLUTION);
+		for(int site = 0; site < NUM_SITES; site++){
+			for(unsigned int c = 0; c < 4; c++){
+				std::vector<double> expectedReal
+					= naiveGaussian(
+						getSmoothTestData(
+							RESOLUTION,
+							8*site + 2*c
+						),
+						0.2/2.*RESOLUTION,
+						windowSize
+					);
+				std::vector<double> expectedImag
+					= naiveGaussian(
+						getSmoothTestData(
+							RESOLUTION,
+							8*site + 2*c + 1
+						),
+						0.2/2.*RESOLUTION,
+						windowSize
+					);
+				for(int n = 0; n < RESOLUTION; n++){
+					std::complex<double> element = result(
+						{site},
+						n
+					).at(c/2, c%2);
+					EXPECT_NEAR(
+						real(element),
+						expectedReal[n],
+						EPSILON_10000
+					);
+					EXPECT_NEAR(
+						imag(element),
+						expectedImag[n],
+						EPSILON_10000
+					);
+				}
+			}
+		}
+	}
+}
+
+};	//End of namespace TBTK
@@ -132,6 +132,49 @@ TEST(ArnoldiIterator, run){
 	//ArnoldiIterator::getAmplitude()
 }
 
+TEST(ArnoldiIterator, runSpectrumSlicing){
+	Model model;
+	model.setVerbose(false);
+	model << HoppingAmplitude(1, {1}, {0}) + HC;
+	model << HoppingAmplitude(2, {2}, {2});
+	model << HoppingAmplitude(3, {3}, {3});
+	model << HoppingAmplitude(3, {4}, {4});
+	model << HoppingAmplitude(0.1, {4}, {3}) + HC;
+	model << HoppingAmplitude(5, {5}, {5});
+	model << HoppingAmplitude(6, {6}, {6});
+	model.construct();
+	model.constructCOO();
+
+	ArnoldiIterator solver;
+	solver.setVerbose(false);
+	solver.setModel(model);
+	solver.setNumEigenValues(3);
+	solver.setNumLanczosVectors(6);
+	solver.setMaxIterations(10);
+	solver.setCalculateEigenVectors(true);
+
+	//The eigenvalue 2 is found both by the slice [0, 2) and the slice [2,
+	//4] and should only be included once.
+	solver.runSpectrumSlicing(-2, 4, 3);
+	EXPECT_EQ(solver.getNumCalculatedEigenValues(), 5);
+	EXPECT_NEAR(solver.getEigenValue(0), -1, 1e-5);
+	EXPECT_NEAR(solver.getEigenValue(1), 1, 1e-5);
+	EXPECT_NEAR(solver.getEigenValue(2), 2, 1e-5);
+	EXPECT_NEAR(solver.getEigenValue(3), 2.9, 1e-5);
+	EXPECT_NEAR(solver.getEigenValue(4), 3.1, 1e-5);
+	EXPECT_NEAR(abs(solver.getAmplitude(2, {2})), 1, 1e-5);
+	EXPECT_NEAR(
+		real(solver.getAmplitude(3, {3})/solver.getAmplitude(3, {4})),
+		-1,
+		1e-5
+	);
+}
+
+TEST(ArnoldiIterator, getNumCalculatedEigenValues){
+	//Already tested through
+	//ArnoldiIterator::runSpectrumSlicing()
+}
+
 TEST(ArnoldiIterator, getEigenValues){
 	Model model;
 	model.setVerbose(false);
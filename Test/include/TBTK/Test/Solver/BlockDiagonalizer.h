@@ -273,6 +273,83 @@ TEST(BlockDiagonalizer, getLastStateInBlock){
 	}
 }
 
+TEST(BlockDiagonalizer, getNumStatesInBlock){
+	Model model;
+	model.setVerbose(false);
+	model << HoppingAmplitude(1, {0, 1}, {0, 0}) + HC;
+	model << HoppingAmplitude(2, {1, 0}, {1, 0});
+	model << HoppingAmplitude(3, {2, 1}, {2, 0}) + HC;
+	model.construct();
+
+	BlockDiagonalizer solver;
+	solver.setVerbose(false);
+	solver.setModel(model);
+	solver.run();
+
+	EXPECT_EQ(solver.getNumStatesInBlock(0), 2);
+	EXPECT_EQ(solver.getNumStatesInBlock(1), 2);
+	EXPECT_EQ(solver.getNumStatesInBlock(2), 1);
+	EXPECT_EQ(solver.getNumStatesInBlock(3), 2);
+	EXPECT_EQ(solver.getNumStatesInBlock(4), 2);
+}
+
+TEST(BlockDiagonalizer, getEigenValuesInBlock){
+	Model model;
+	model.setVerbose(false);
+	model << HoppingAmplitude(1, {0, 1}, {0, 0}) + HC;
+	model << HoppingAmplitude(2, {1, 0}, {1, 0});
+	model << HoppingAmplitude(3, {2, 1}, {2, 0}) + HC;
+	model.construct();
+
+	BlockDiagonalizer solver;
+	solver.setVerbose(false);
+	solver.setModel(model);
+	solver.run();
+
+	EXPECT_DOUBLE_EQ(solver.getEigenValuesInBlock(0)[0], -1);
+	EXPECT_DOUBLE_EQ(solver.getEigenValuesInBlock(1)[1], 1);
+	EXPECT_DOUBLE_EQ(solver.getEigenValuesInBlock(2)[0], 2);
+	EXPECT_DOUBLE_EQ(solver.getEigenValuesInBlock(4)[0], -3);
+	EXPECT_DOUBLE_EQ(solver.getEigenValuesInBlock(3)[1], 3);
+}
+
+TEST(BlockDiagonalizer, getEigenVectorsInBlock){
+	Model model;
+	model.setVerbose(false);
+	model << HoppingAmplitude(1, {0, 1}, {0, 0}) + HC;
+	model << HoppingAmplitude(2, {1, 0}, {1, 0});
+	model << HoppingAmplitude(3, {2, 1}, {2, 0}) + HC;
+	model.construct();
+
+	BlockDiagonalizer solver;
+	solver.setVerbose(false);
+	solver.setModel(model);
+	solver.run();
+
+	for(unsigned int state = 0; state < 5; state++){
+		unsigned int firstState = solver.getFirstStateInBlock(
+			model.getHoppingAmplitudeSet().getPhysicalIndex(state)
+		);
+		unsigned int numStates = solver.getNumStatesInBlock(state);
+		const std::complex<double> *eigenVectors
+			= solver.getEigenVectorsInBlock(state);
+		for(unsigned int n = 0; n < numStates; n++){
+			for(unsigned int m = 0; m < numStates; m++){
+				EXPECT_EQ(
+					eigenVectors[n*numStates + m],
+					solver.getAmplitude(
+						firstState + n,
+						model.getHoppingAmplitudeSet(
+						).getPhysicalIndex(
+							firstState + m
+						)
+					)
+				);
+			}
+		}
+	}
+}
+
 TEST(BlockDiagonalizer, setParallelExecution){
 	//Tested through all other implemented tests.
 }
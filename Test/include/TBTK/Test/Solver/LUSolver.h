@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 
+#include <limits>
+
 namespace TBTK{
 namespace Solver{
 
@@ -101,6 +103,23 @@ TEST(LUSolver, getMatrixDataType){
 	EXPECT_EQ(solver.getMatrixDataType(), LUSolver::DataType::Double);
 }
 
+TEST(LUSolver, setReuseSymbolicFactorization){
+	//Tested through LUSolver::getReuseSymbolicFactorization().
+}
+
+TEST(LUSolver, getReuseSymbolicFactorization){
+	LUSolver solver;
+
+	//Enabled by default.
+	EXPECT_TRUE(solver.getReuseSymbolicFactorization());
+
+	solver.setReuseSymbolicFactorization(false);
+	EXPECT_FALSE(solver.getReuseSymbolicFactorization());
+
+	solver.setReuseSymbolicFactorization(true);
+	EXPECT_TRUE(solver.getReuseSymbolicFactorization());
+}
+
 //TODO
 //...
 TEST(LUSolver, solve){
@@ -173,5 +192,107 @@ TEST(LUSolver, solve){
 	EXPECT_DOUBLE_EQ(imag(b1.at(1, 0)), -0.2);
 }
 
+TEST(LUSolver, solveMultipleRightHandSides){
+	const double EPSILON_100 = 100*std::numeric_limits<double>::epsilon();
+
+	LUSolver solver;
+
+	SparseMatrix<double> sparseMatrix(
+		SparseMatrix<double>::StorageFormat::CSC
+	);
+	sparseMatrix.add(0, 0, 1);
+	sparseMatrix.add(0, 1, 2);
+	sparseMatrix.add(1, 0, 3);
+	sparseMatrix.add(1, 1, 4);
+	sparseMatrix.constructCSX();
+	solver.setMatrix(sparseMatrix);
+
+	//Matrix with two columns.
+	Matrix<double> b0(2, 2);
+	b0.at(0, 0) = 2;
+	b0.at(1, 0) = 1;
+	b0.at(0, 1) = 1;
+	b0.at(1, 1) = 0;
+	solver.solve(b0);
+	EXPECT_NEAR(b0.at(0, 0), -3, EPSILON_100);
+	EXPECT_NEAR(b0.at(1, 0), 2.5, EPSILON_100);
+	EXPECT_NEAR(b0.at(0, 1), -2, EPSILON_100);
+	EXPECT_NEAR(b0.at(1, 1), 1.5, EPSILON_100);
+
+	//Raw arrays with two right hand sides.
+	double b1[4] = {2, 1, 1, 0};
+	solver.solve(b1, 2);
+	EXPECT_NEAR(b1[0], -3, EPSILON_100);
+	EXPECT_NEAR(b1[1], 2.5, EPSILON_100);
+	EXPECT_NEAR(b1[2], -2, EPSILON_100);
+	EXPECT_NEAR(b1[3], 1.5, EPSILON_100);
+
+	std::complex<double> b2[4] = {
+		1,
+		std::complex<double>(0, 1),
+		std::complex<double>(2, 1),
+		1
+	};
+	solver.solve(b2, 2);
+	EXPECT_NEAR(real(b2[0]), -2, EPSILON_100);
+	EXPECT_NEAR(imag(b2[0]), 1, EPSILON_100);
+	EXPECT_NEAR(real(b2[1]), 1.5, EPSILON_100);
+	EXPECT_NEAR(imag(b2[1]), -0.5, EPSILON_100);
+	EXPECT_NEAR(real(b2[2]), -3, EPSILON_100);
+	EXPECT_NEAR(imag(b2[2]), -2, EPSILON_100);
+	EXPECT_NEAR(real(b2[3]), 2.5, EPSILON_100);
+	EXPECT_NEAR(imag(b2[3]), 1.5, EPSILON_100);
+}
+
+TEST(LUSolver, solveSamePattern){
+	const double EPSILON_100 = 100*std::numeric_limits<double>::epsilon();
+
+	LUSolver solver;
+
+	//Factorize two matrices with the same sparsity pattern, where the
+	//second matrix requires a different row permutation.
+	SparseMatrix<double> sparseMatrix0(
+		SparseMatrix<double>::StorageFormat::CSC
+	);
+	sparseMatrix0.add(0, 0, 1);
+	sparseMatrix0.add(0, 1, 2);
+	sparseMatrix0.add(1, 0, 3);
+	sparseMatrix0.add(1, 1, 4);
+	sparseMatrix0.constructCSX();
+	solver.setMatrix(sparseMatrix0);
+
+	SparseMatrix<double> sparseMatrix1(
+		SparseMatrix<double>::StorageFormat::CSC
+	);
+	sparseMatrix1.add(0, 0, 2);
+	sparseMatrix1.add(0, 1, 1);
+	sparseMatrix1.add(1, 0, 1);
+	sparseMatrix1.add(1, 1, 3);
+	sparseMatrix1.constructCSX();
+	solver.setMatrix(sparseMatrix1);
+
+	Matrix<double> b(2, 1);
+	b.at(0, 0) = 1;
+	b.at(1, 0) = 2;
+	solver.solve(b);
+	EXPECT_NEAR(b.at(0, 0), 0.2, EPSILON_100);
+	EXPECT_NEAR(b.at(1, 0), 0.6, EPSILON_100);
+
+	//Change the sparsity pattern.
+	SparseMatrix<double> sparseMatrix2(
+		SparseMatrix<double>::StorageFormat::CSC
+	);
+	sparseMatrix2.add(0, 0, 2);
+	sparseMatrix2.add(1, 1, 4);
+	sparseMatrix2.constructCSX();
+	solver.setMatrix(sparseMatrix2);
+
+	b.at(0, 0) = 1;
+	b.at(1, 0) = 2;
+	solver.solve(b);
+	EXPECT_NEAR(b.at(0, 0), 0.5, EPSILON_100);
+	EXPECT_NEAR(b.at(1, 0), 0.5, EPSILON_100);
+}
+
 };	//End of namespace Solver
 };	//End of namespace TBTK
@@ -0,0 +1,131 @@
+#include "TBTK/BrillouinZone.h"
+#include "TBTK/Model.h"
+#include "TBTK/RPA/MomentumSpaceContext.h"
+#include "TBTK/Solver/LindhardSusceptibility.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+namespace TBTK{
+namespace Solver{
+
+const double EPSILON_10000 = 10000*std::numeric_limits<double>::epsilon();
+
+TEST(LindhardSusceptibility, calculateSusceptibilityAllOrbitals){
+	//Setup a two orbital model with hybridized orbitals on a rectangular
+	//mesh.
+	std::vector<unsigned int> numMeshPoints = {4, 3};
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, 2*M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	std::vector<std::vector<double>> mesh
+		= brillouinZone.getMinorMesh(numMeshPoints);
+	Model model;
+	model.setVerbose(false);
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index kIndex = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		for(int orbital = 0; orbital < 2; orbital++){
+			model << HoppingAmplitude(
+				-2*(cos(mesh[n][0]) + cos(mesh[n][1])) + orbital,
+				{kIndex[0], kIndex[1], orbital},
+				{kIndex[0], kIndex[1], orbital}
+			);
+		}
+		model << HoppingAmplitude(
+			std::complex<double>(0.5, 0.2*sin(mesh[n][0])),
+			{kIndex[0], kIndex[1], 0},
+			{kIndex[0], kIndex[1], 1}
+		) + HC;
+	}
+	model.construct();
+	model.setTemperature(3000);
+	model.setChemicalPotential(-0.5);
+
+	MomentumSpaceContext momentumSpaceContext;
+	momentumSpaceContext.setModel(model);
+	momentumSpaceContext.setBrillouinZone(brillouinZone);
+	momentumSpaceContext.setNumMeshPoints(numMeshPoints);
+	momentumSpaceContext.setNumOrbitals(2);
+	momentumSpaceContext.init();
+
+	//The real energy zero makes the pole-safe expression necessary.
+	std::vector<std::complex<double>> energies = {
+		0,
+		std::complex<double>(0, 0.1),
+		std::complex<double>(0.5, 0.1)
+	};
+
+	LindhardSusceptibility perOrbitalSolver(momentumSpaceContext);
+	LindhardSusceptibility allOrbitalsSolver(momentumSpaceContext);
+	allOrbitalsSolver.setCalculateAllOrbitals(true);
+	EXPECT_FALSE(perOrbitalSolver.getCalculateAllOrbitals());
+	EXPECT_TRUE(allOrbitalsSolver.getCalculateAllOrbitals());
+
+	for(unsigned int kx = 0; kx < numMeshPoints[0]; kx++){
+		for(unsigned int ky = 0; ky < numMeshPoints[1]; ky++){
+			Index k({(int)kx, (int)ky});
+			std::vector<std::complex<double>> tensor
+				= allOrbitalsSolver.calculateSusceptibilityAllOrbitals(
+					k,
+					energies
+				);
+			ASSERT_EQ(tensor.size(), 2*2*2*2*energies.size());
+
+			for(unsigned int n = 0; n < 2*2*2*2; n++){
+				int o[4] = {
+					(int)(n/8),
+					(int)((n/4)%2),
+					(int)((n/2)%2),
+					(int)(n%2)
+				};
+				Index index({k, {o[0]}, {o[1]}, {o[2]}, {o[3]}});
+				std::vector<std::complex<double>> reference
+					= perOrbitalSolver.calculateSusceptibility(
+						index,
+						energies
+					);
+				std::vector<std::complex<double>> cached
+					= allOrbitalsSolver.calculateSusceptibility(
+						index,
+						energies
+					);
+				ASSERT_EQ(reference.size(), energies.size());
+				ASSERT_EQ(cached.size(), energies.size());
+				for(unsigned int e = 0; e < energies.size(); e++){
+					std::complex<double> element
+						= tensor[n*energies.size() + e];
+					EXPECT_NEAR(
+						real(element),
+						real(reference[e]),
+						EPSILON_10000
+					);
+					EXPECT_NEAR(
+						imag(element),
+						imag(reference[e]),
+						EPSILON_10000
+					);
+					EXPECT_NEAR(
+						real(cached[e]),
+						real(reference[e]),
+						EPSILON_10000
+					);
+					EXPECT_NEAR(
+						imag(cached[e]),
+						imag(reference[e]),
+						EPSILON_10000
+					);
+				}
+			}
+		}
+	}
+}
+
+};	//End of namespace Solver
+};	//End of namespace TBTK
@@ -0,0 +1,218 @@
+#include "TBTK/BrillouinZone.h"
+#include "TBTK/Model.h"
+#include "TBTK/Property/GreensFunction.h"
+#include "TBTK/RPA/MomentumSpaceContext.h"
+#include "TBTK/Solver/MatsubaraSusceptibility.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+namespace TBTK{
+namespace Solver{
+
+const double EPSILON_10000 = 10000*std::numeric_limits<double>::epsilon();
+
+//Calculates -(kT/N)\sum_{p,n}G_{da}(p, i\nu_n)G_{bc}(p+k, i\nu_n + i\omega_m)
+//by direct summation for the bosonic Matsubara energy indices
+//-2(N_{\nu}-1), ..., 2(N_{\nu}-1).
+std::vector<std::complex<double>> calculateMatsubaraSusceptibilityDirectly(
+	const Property::GreensFunction &greensFunction,
+	const std::vector<unsigned int> &numMeshPoints,
+	const Index &k,
+	const Index intraBlockIndices[4]
+){
+	int numFermionicMatsubaraEnergies
+		= greensFunction.getNumMatsubaraEnergies();
+	double kT = greensFunction.getFundamentalMatsubaraEnergy()/M_PI;
+	int numMeshPointsTotal = numMeshPoints[0]*numMeshPoints[1];
+
+	std::vector<std::complex<double>> result(
+		2*numFermionicMatsubaraEnergies - 1,
+		0
+	);
+	for(int m = 0; m < (int)result.size(); m++){
+		int shift = m - (numFermionicMatsubaraEnergies - 1);
+		for(unsigned int px = 0; px < numMeshPoints[0]; px++){
+			for(unsigned int py = 0; py < numMeshPoints[1]; py++){
+				Index p({(int)px, (int)py});
+				Index pPlusK({
+					(int)((px + k[0])%numMeshPoints[0]),
+					(int)((py + k[1])%numMeshPoints[1])
+				});
+				for(
+					int n = 0;
+					n < numFermionicMatsubaraEnergies;
+					n++
+				){
+					if(
+						n + shift < 0
+						|| n + shift
+							>= numFermionicMatsubaraEnergies
+					){
+						continue;
+					}
+
+					result[m] -= kT/numMeshPointsTotal*greensFunction(
+						{
+							Index(p, intraBlockIndices[3]),
+							Index(p, intraBlockIndices[0])
+						},
+						n
+					)*greensFunction(
+						{
+							Index(pPlusK, intraBlockIndices[1]),
+							Index(pPlusK, intraBlockIndices[2])
+						},
+						n + shift
+					);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+TEST(MatsubaraSusceptibility, calculateSusceptibility){
+	//Setup a two orbital model on a rectangular mesh. The mesh has
+	//different sizes in the two directions to make the test sensitive to
+	//the order of the momentum dimensions.
+	std::vector<unsigned int> numMeshPoints = {4, 3};
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, 2*M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	std::vector<std::vector<double>> mesh
+		= brillouinZone.getMinorMesh(numMeshPoints);
+	Model model;
+	model.setVerbose(false);
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index kIndex = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		for(int orbital = 0; orbital < 2; orbital++){
+			model << HoppingAmplitude(
+				-2*(cos(mesh[n][0]) + cos(mesh[n][1])) + orbital,
+				{kIndex[0], kIndex[1], orbital},
+				{kIndex[0], kIndex[1], orbital}
+			);
+		}
+		model << HoppingAmplitude(
+			0.5,
+			{kIndex[0], kIndex[1], 0},
+			{kIndex[0], kIndex[1], 1}
+		) + HC;
+	}
+	model.construct();
+	model.setTemperature(1000);
+
+	MomentumSpaceContext momentumSpaceContext;
+	momentumSpaceContext.setModel(model);
+	momentumSpaceContext.setBrillouinZone(brillouinZone);
+	momentumSpaceContext.setNumMeshPoints(numMeshPoints);
+	momentumSpaceContext.setNumOrbitals(2);
+	momentumSpaceContext.init();
+
+	//Setup a Green's function with data that varies with all of its
+	//arguments.
+	IndexTree indexTree;
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index kIndex = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		for(int to = 0; to < 2; to++){
+			for(int from = 0; from < 2; from++){
+				indexTree.add({
+					Index(kIndex, {to}),
+					Index(kIndex, {from})
+				});
+			}
+		}
+	}
+	indexTree.generateLinearMap();
+	Property::GreensFunction greensFunction(indexTree, -7, 7, 0.1);
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index kIndex = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		for(int to = 0; to < 2; to++){
+			for(int from = 0; from < 2; from++){
+				for(
+					unsigned int e = 0;
+					e < greensFunction.getNumMatsubaraEnergies();
+					e++
+				){
+					greensFunction(
+						{
+							Index(kIndex, {to}),
+							Index(kIndex, {from})
+						},
+						e
+					) = 1./(
+						greensFunction.getMatsubaraEnergy(e)
+						- cos(mesh[n][0] + to)
+						- 0.5*sin(mesh[n][1] + 2*from)
+						- std::complex<double>(0, 0.1*to*from)
+					);
+				}
+			}
+		}
+	}
+
+	//Compare the solver with the direct summation for two sets of intra
+	//block Indices, which also checks that the cache is invalidated when
+	//the intra block Indices change.
+	MatsubaraSusceptibility solver(momentumSpaceContext, greensFunction);
+	Index intraBlockIndicesList[2][4] = {
+		{{0}, {1}, {1}, {0}},
+		{{1}, {1}, {0}, {1}}
+	};
+	for(unsigned int n = 0; n < 2; n++){
+		const Index *intraBlockIndices = intraBlockIndicesList[n];
+		for(unsigned int kx = 0; kx < numMeshPoints[0]; kx++){
+			for(unsigned int ky = 0; ky < numMeshPoints[1]; ky++){
+				Index k({(int)kx, (int)ky});
+				std::vector<std::complex<double>> susceptibility
+					= solver.calculateSusceptibility({
+						k,
+						intraBlockIndices[0],
+						intraBlockIndices[1],
+						intraBlockIndices[2],
+						intraBlockIndices[3]
+					});
+				std::vector<std::complex<double>> reference
+					= calculateMatsubaraSusceptibilityDirectly(
+						greensFunction,
+						numMeshPoints,
+						k,
+						intraBlockIndices
+					);
+				ASSERT_EQ(
+					susceptibility.size(),
+					reference.size()
+				);
+				for(unsigned int m = 0; m < reference.size(); m++){
+					EXPECT_NEAR(
+						real(susceptibility[m]),
+						real(reference[m]),
+						EPSILON_10000
+					);
+					EXPECT_NEAR(
+						imag(susceptibility[m]),
+						imag(reference[m]),
+						EPSILON_10000
+					);
+				}
+			}
+		}
+	}
+}
+
+};	//End of namespace Solver
+};	//End of namespace TBTK
@@ -0,0 +1,142 @@
+#include "TBTK/BrillouinZone.h"
+#include "TBTK/EnergyMesh.h"
+#include "TBTK/Model.h"
+#include "TBTK/Property/InteractionVertex.h"
+#include "TBTK/RPA/MomentumSpaceContext.h"
+#include "TBTK/Solver/SelfEnergy.h"
+#include "TBTK/UnitHandler.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace TBTK{
+namespace Solver{
+
+TEST(SelfEnergy, calculateSelfEnergySparseMatsubaraEnergies){
+	//Setup a one orbital model on a square mesh.
+	std::vector<unsigned int> numMeshPoints = {8, 8};
+	BrillouinZone brillouinZone(
+		{{2*M_PI, 0}, {0, 2*M_PI}},
+		SpacePartition::MeshType::Nodal
+	);
+	std::vector<std::vector<double>> mesh
+		= brillouinZone.getMinorMesh(numMeshPoints);
+	Model model;
+	model.setVerbose(false);
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index k = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		model << HoppingAmplitude(
+			-2*(cos(mesh[n][0]) + cos(mesh[n][1])),
+			{k[0], k[1], 0},
+			{k[0], k[1], 0}
+		);
+	}
+	model.construct();
+	model.setTemperature(300);
+	model.setChemicalPotential(-0.5);
+
+	MomentumSpaceContext momentumSpaceContext;
+	momentumSpaceContext.setModel(model);
+	momentumSpaceContext.setBrillouinZone(brillouinZone);
+	momentumSpaceContext.setNumMeshPoints(numMeshPoints);
+	momentumSpaceContext.setNumOrbitals(1);
+	momentumSpaceContext.init();
+
+	IndexTree indexTree;
+	for(unsigned int n = 0; n < mesh.size(); n++){
+		Index k = brillouinZone.getMinorCellIndex(
+			mesh[n],
+			numMeshPoints
+		);
+		indexTree.add({k, {0}, {0}, {0}, {0}});
+	}
+	indexTree.generateLinearMap();
+
+	//Interaction vertex that decays slowly with the Matsubara energy, on
+	//the full and on a sparse set of bosonic Matsubara energies.
+	double kT = UnitHandler::getK_BB()*UnitHandler::convertTemperatureNtB(
+		model.getTemperature()
+	);
+	double fundamentalMatsubaraEnergy = M_PI*kT;
+	int maxMatsubaraEnergyIndex = 800;
+	Property::InteractionVertex interactionVertices[2] = {
+		Property::InteractionVertex(
+			indexTree,
+			-maxMatsubaraEnergyIndex,
+			maxMatsubaraEnergyIndex,
+			fundamentalMatsubaraEnergy
+		),
+		Property::InteractionVertex(
+			indexTree,
+			EnergyMesh::generateSparseMatsubaraEnergyIndices(
+				-maxMatsubaraEnergyIndex,
+				maxMatsubaraEnergyIndex,
+				24,
+				20
+			),
+			fundamentalMatsubaraEnergy
+		)
+	};
+	EXPECT_LT(
+		5*interactionVertices[1].getNumMatsubaraEnergies(),
+		interactionVertices[0].getNumMatsubaraEnergies()
+	);
+	for(unsigned int c = 0; c < 2; c++){
+		Property::InteractionVertex &interactionVertex
+			= interactionVertices[c];
+		for(unsigned int n = 0; n < mesh.size(); n++){
+			Index k = brillouinZone.getMinorCellIndex(
+				mesh[n],
+				numMeshPoints
+			);
+			unsigned int offset = interactionVertex.getOffset(
+				{k, {0}, {0}, {0}, {0}}
+			);
+			for(
+				unsigned int e = 0;
+				e < interactionVertex.getNumMatsubaraEnergies();
+				e++
+			){
+				double energy = imag(
+					interactionVertex.getMatsubaraEnergy(e)
+				);
+				interactionVertex.getDataRW()[offset + e]
+					= (1 + 0.3*cos(mesh[n][0]))*(
+						0.5 + 2/(1 + energy*energy)
+					);
+			}
+		}
+	}
+
+	//The self-energy calculated from the sparse set of Matsubara
+	//energies agrees with the one calculated from the full set.
+	std::vector<std::complex<double>> energies;
+	for(int m = 1; m < 40; m += 6)
+		energies.push_back(std::complex<double>(0, m*kT*M_PI));
+	Index k = brillouinZone.getMinorCellIndex(mesh[9], numMeshPoints);
+	std::vector<std::complex<double>> selfEnergies[2];
+	for(unsigned int c = 0; c < 2; c++){
+		SelfEnergy solver(momentumSpaceContext, interactionVertices[c]);
+		solver.setModel(model);
+		solver.init();
+		selfEnergies[c] = solver.calculateSelfEnergy(
+			{k, {0}, {0}},
+			energies
+		);
+	}
+	for(unsigned int n = 0; n < energies.size(); n++){
+		EXPECT_LT(
+			abs(selfEnergies[1][n] - selfEnergies[0][n]),
+			0.005*abs(selfEnergies[0][n])
+		);
+	}
+}
+
+};	//End of namespace Solver
+};	//End of namespace TBTK
@@ -0,0 +1,9 @@
+#include "gtest/gtest.h"
+
+#include "TBTK/Test/Array.h"
+
+int main(int argc, char **argv){
+	::testing::InitGoogleTest(&argc, argv);
+
+	return RUN_ALL_TESTS();
+}